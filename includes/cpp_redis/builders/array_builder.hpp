@@ -47,13 +47,19 @@ public:
 
 public:
   //!
-  //! take data as parameter which is consumed to build the reply
-  //! every bytes used to build the reply must be removed from the buffer passed as parameter
+  //! take data as parameter which is consumed, starting at the given position, to build the reply
+  //! the buffer is left untouched: the position is advanced past every byte used to build the reply
   //!
-  //! \param data data to be consumed
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
   //! \return current instance
   //!
-  builder_iface& operator<<(std::string& data);
+  builder_iface& consume(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! \return number of bytes still required by the row currently being built, if known
+  //!
+  std::size_t pending_size(void) const;
 
   //!
   //! \return whether the reply could be built
@@ -65,24 +71,31 @@ public:
   //!
   reply get_reply(void) const;
 
+  //!
+  //! \return reply object, moved out of the builder
+  //!
+  reply take_reply(void);
+
 private:
   //!
   //! take data as parameter which is consumed to determine array size
-  //! every bytes used to build size is removed from the buffer passed as parameter
+  //! the position is advanced past every byte used to build size
   //!
-  //! \param buffer data to be consumer
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer
   //! \return true if the size could be found
   //!
-  bool fetch_array_size(std::string& buffer);
+  bool fetch_array_size(const std::string& buffer, std::size_t& pos);
 
   //!
   //! take data as parameter which is consumed to build an array row
-  //! every bytes used to build row is removed from the buffer passed as parameter
+  //! the position is advanced past every byte used to build row
   //!
-  //! \param buffer data to be consumer
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer
   //! \return true if the row could be built
   //!
-  bool build_row(std::string& buffer);
+  bool build_row(const std::string& buffer, std::size_t& pos);
 
 private:
   //!
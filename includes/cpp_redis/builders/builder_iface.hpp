@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -45,7 +46,23 @@ public:
   //! \param data data to be consumed
   //! \return current instance
   //!
-  virtual builder_iface& operator<<(std::string& data) = 0;
+  builder_iface& operator<<(std::string& data);
+
+  //!
+  //! take data as parameter which is consumed, starting at the given position, to build the reply
+  //! the buffer is left untouched: the position is advanced past every byte used to build the reply
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \return current instance
+  //!
+  virtual builder_iface& consume(const std::string& buffer, std::size_t& pos) = 0;
+
+  //!
+  //! \return number of bytes, starting at the current position, the builder knows it still needs to build the reply
+  //! (0 if unknown, for example while the size of a bulk string has not been read yet)
+  //!
+  virtual std::size_t pending_size(void) const;
 
   //!
   //! \return whether the reply could be built
@@ -56,6 +73,14 @@ public:
   //! \return reply object
   //!
   virtual reply get_reply(void) const = 0;
+
+  //!
+  //! same as get_reply, but the reply is moved out of the builder instead of being copied
+  //! the builder should not be used anymore afterwards
+  //!
+  //! \return reply object
+  //!
+  virtual reply take_reply(void);
 };
 
 } // namespace builders
@@ -0,0 +1,158 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <cpp_redis/builders/reply_handler_iface.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! reply handler streaming the content of bulk strings to a sink (callback or output stream) in chunks, as they are
+//! received, so that large values (GET of a big blob for instance) are never buffered entirely
+//! to be passed to client::send along with the command:
+//!
+//!   client.send({"GET", "blob"}, std::make_shared<cpp_redis::builders::bulk_sink>(file));
+//!
+//! null and error replies are recorded and can be checked once the reply has been received
+//!
+class bulk_sink : public reply_handler_iface {
+public:
+  //!
+  //! chunk callback, called for each part of a bulk string received
+  //! the chunk points into the receive buffer: it is only valid during the call
+  //! last is set for the last part of each bulk string
+  //!
+  typedef std::function<void(const string_ref& chunk, bool last)> chunk_callback_t;
+
+public:
+  //!
+  //! ctor
+  //!
+  //! \param callback callback receiving the chunks
+  //!
+  explicit bulk_sink(const chunk_callback_t& callback);
+
+  //!
+  //! ctor
+  //!
+  //! \param os stream the chunks are written to, must outlive the sink
+  //!
+  explicit bulk_sink(std::ostream& os);
+
+  //! dtor
+  ~bulk_sink(void) = default;
+
+  //! copy ctor
+  bulk_sink(const bulk_sink&) = delete;
+  //! assignment operator
+  bulk_sink& operator=(const bulk_sink&) = delete;
+
+public:
+  //!
+  //! pass the chunk to the sink
+  //!
+  void on_bulk(const string_ref& chunk, bool last) override;
+
+  //!
+  //! simple strings are passed to the sink as a single chunk
+  //!
+  void on_simple_string(const string_ref& value) override;
+
+  //!
+  //! record the error
+  //!
+  void on_error(const string_ref& value) override;
+
+  //!
+  //! record the null reply
+  //!
+  void on_null(void) override;
+
+public:
+  //!
+  //! \return number of bytes passed to the sink
+  //!
+  std::size_t size(void) const;
+
+  //!
+  //! \return number of bulk strings completely passed to the sink
+  //!
+  std::size_t count(void) const;
+
+  //!
+  //! \return whether a null reply has been received
+  //!
+  bool is_null(void) const;
+
+  //!
+  //! \return whether an error has been received
+  //!
+  bool is_error(void) const;
+
+  //!
+  //! \return the last error received (empty if none)
+  //!
+  const std::string& error(void) const;
+
+private:
+  //!
+  //! callback receiving the chunks
+  //!
+  chunk_callback_t  m_callbackChunk;
+
+  //!
+  //! number of bytes passed to the sink
+  //!
+  std::size_t       m_uSize;
+
+  //!
+  //! number of bulk strings completely passed to the sink
+  //!
+  std::size_t       m_uCount;
+
+  //!
+  //! whether a null reply has been received
+  //!
+  bool              m_bNull;
+
+  //!
+  //! whether an error has been received
+  //!
+  bool              m_bError;
+
+  //!
+  //! last error received
+  //!
+  std::string       m_sError;
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
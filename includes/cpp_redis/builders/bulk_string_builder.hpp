@@ -47,13 +47,19 @@ public:
 
 public:
   //!
-  //! take data as parameter which is consumed to build the reply
-  //! every bytes used to build the reply must be removed from the buffer passed as parameter
+  //! take data as parameter which is consumed, starting at the given position, to build the reply
+  //! the buffer is left untouched: the position is advanced past every byte used to build the reply
   //!
-  //! \param data data to be consumed
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
   //! \return current instance
   //!
-  builder_iface& operator<<(std::string& data);
+  builder_iface& consume(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! \return number of bytes (string and end sequence) still required once the size has been read, 0 otherwise
+  //!
+  std::size_t pending_size(void) const;
 
   //!
   //! \return whether the reply could be built
@@ -65,6 +71,11 @@ public:
   //!
   reply get_reply(void) const;
 
+  //!
+  //! \return reply object, moved out of the builder
+  //!
+  reply take_reply(void);
+
   //!
   //! \return the parsed bulk string
   //!
@@ -77,8 +88,8 @@ public:
 
 private:
   void build_reply(void);
-  bool fetch_size(std::string& str);
-  void fetch_str(std::string& str);
+  bool fetch_size(const std::string& buffer, std::size_t& pos);
+  void fetch_str(const std::string& buffer, std::size_t& pos);
 
 private:
   //!
@@ -47,13 +47,14 @@ public:
 
 public:
   //!
-  //! take data as parameter which is consumed to build the reply
-  //! every bytes used to build the reply must be removed from the buffer passed as parameter
+  //! take data as parameter which is consumed, starting at the given position, to build the reply
+  //! the buffer is left untouched: the position is advanced past every byte used to build the reply
   //!
-  //! \param data data to be consumed
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
   //! \return current instance
   //!
-  builder_iface& operator<<(std::string& data);
+  builder_iface& consume(const std::string& buffer, std::size_t& pos);
 
   //!
   //! \return whether the reply could be built
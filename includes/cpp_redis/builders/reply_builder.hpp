@@ -22,20 +22,29 @@
 
 #pragma once
 
+#include <cstddef>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
 
-#include <cpp_redis/builders/builder_iface.hpp>
+#include <cpp_redis/builders/reply_handler_iface.hpp>
+#include <cpp_redis/builders/reply_parser.hpp>
+#include <cpp_redis/builders/reply_pool.hpp>
 #include <cpp_redis/core/reply.hpp>
+#include <cpp_redis/core/reply_view.hpp>
+
+#ifndef __CPP_REDIS_BUFFER_COMPACT_THRESHOLD
+#define __CPP_REDIS_BUFFER_COMPACT_THRESHOLD 4096
+#endif /* __CPP_REDIS_BUFFER_COMPACT_THRESHOLD */
 
 namespace cpp_redis {
 
 namespace builders {
 
 //!
-//! class coordinating the several builders and the builder factory to build all the replies returned by redis server
+//! class buffering the data received from redis server and using a reply_parser to build all the replies it contains
 //!
 class reply_builder {
 public:
@@ -49,6 +58,20 @@ public:
   //! assignment operator
   reply_builder& operator=(const reply_builder&) = delete;
 
+public:
+  //!
+  //! predicate deciding, when a reply starts being received, whether it should be kept as a view instead of being built
+  //! takes as parameter the number of replies available before it (not popped yet)
+  //!
+  typedef std::function<bool(std::size_t)> view_predicate_t;
+
+  //!
+  //! selector returning, when a reply starts being received, the handler to which its content should be passed as
+  //! events instead of being built (nullptr to build it)
+  //! takes as parameter the number of replies available before it (not popped yet)
+  //!
+  typedef std::function<reply_handler_iface*(std::size_t)> handler_selector_t;
+
 public:
   //!
   //! add data to reply builder
@@ -56,9 +79,33 @@ public:
   //!
   //! \param data data to be used for building replies
   //! \return current instance
+  //! \throw redis_error if the data is not a valid redis reply
   //!
   reply_builder& operator<<(const std::string& data);
 
+  //!
+  //! same as operator<<, but invalid data is reported through the returned value instead of an exception
+  //! the replies built before the invalid data remain available
+  //!
+  //! \param data data to be used for building replies
+  //! \return false if the data is not a valid redis reply (see get_error), the builder must then be reset
+  //!
+  bool try_append(const std::string& data);
+
+  //!
+  //! same as the other try_append method, for a range of bytes appended as is, without an intermediate string
+  //!
+  //! \param data first byte of the data to be used for building replies
+  //! \param size number of bytes
+  //! \return false if the data is not a valid redis reply (see get_error), the builder must then be reset
+  //!
+  bool try_append(const char* pData, std::size_t uSize);
+
+  //!
+  //! \return description of the error that made the received data invalid, or nullptr if no error occured since the last reset
+  //!
+  const char* get_error(void) const;
+
   //!
   //! similar as get_front, store reply in the passed parameter
   //!
@@ -68,14 +115,37 @@ public:
 
   //!
   //! \return the first available reply
+  //! throws if the first available reply is a view (see set_view_predicate)
   //!
   const reply& get_front(void) const;
 
+  //!
+  //! \return whether the first available reply has been kept as a view instead of being built
+  //!
+  bool front_is_view(void) const;
+
+  //!
+  //! view on the first available reply, pointing into the internal buffer
+  //! the view remains valid until data is added to the builder, or until the builder is reset
+  //! throws if the first available reply has been built (is not a view)
+  //!
+  //! \return view on the first available reply
+  //!
+  reply_view get_front_view(void) const;
+
   //!
   //! pop the first available reply
   //!
   void pop_front(void);
 
+  //!
+  //! pop the first available reply and return it, moved out of the builder instead of being copied
+  //! replies kept as views are built on the fly
+  //!
+  //! \return the first available reply
+  //!
+  reply take_front(void);
+
   //!
   //! \return whether a reply is available
   //!
@@ -86,14 +156,130 @@ public:
   //!
   void reset(void);
 
+  //!
+  //! enable or disable the reply pool
+  //! when enabled, replies given back through recycle() have their strings and row vectors reused to build
+  //! the next replies, instead of allocating new ones
+  //!
+  //! \param enabled whether the pool should be used
+  //!
+  void set_pool_enabled(bool enabled);
+
+  //!
+  //! \return whether the reply pool is enabled
+  //!
+  bool is_pool_enabled(void) const;
+
+  //!
+  //! set the limits bounding the memory used to receive replies
+  //! data exceeding them is reported as invalid (see try_append and get_error)
+  //!
+  //! \param limits limits to be applied
+  //!
+  void set_limits(const reply_limits& limits);
+
+  //!
+  //! give back a reply that is not needed anymore so that its storage is reused by the next replies
+  //! does nothing if the reply pool is disabled
+  //!
+  //! \param reply reply to be recycled, set to null on return
+  //!
+  void recycle(reply& reply);
+
+  //!
+  //! set the predicate deciding which replies are kept as views
+  //! views are only framed by the parser: their content stays in the internal buffer and no reply is built for them
+  //!
+  //! \param predicate predicate to be used, or nullptr to build every reply
+  //!
+  void set_view_predicate(const view_predicate_t& predicate);
+
+  //!
+  //! set the selector deciding which replies are passed as events to a handler
+  //! the events of a reply are emitted as its bytes are received, without keeping them in the buffer;
+  //! once the reply is complete, a null reply is made available in its place so that the replies are still popped
+  //! in order. To preserve the order of the events and of the preceding replies, the parsing stops before a reply
+  //! passed as events as long as preceding replies are available: resume() continues it once they have been popped
+  //!
+  //! \param selector selector to be used, or nullptr to build every reply
+  //!
+  void set_handler_selector(const handler_selector_t& selector);
+
+  //!
+  //! continue building the data already received, when the parsing has been stopped before a reply passed as events
+  //! (see set_handler_selector); does nothing if replies are still available
+  //! \throw redis_error if the data is not a valid redis reply
+  //!
+  void resume(void);
+
+  //!
+  //! same as resume, but invalid data is reported through the returned value instead of an exception
+  //!
+  //! \return false if the data is not a valid redis reply (see get_error), the builder must then be reset
+  //!
+  bool try_resume(void);
+
 private:
   //!
-  //! build reply using m_sBuffer content
+  //! build reply using m_sBuffer content, starting at m_uBufferPos
   //!
   //! \return whether the reply has been fully built or not
   //!
   bool build_reply(void);
 
+  //!
+  //! release the bytes of m_sBuffer that have already been consumed by the parser and are not referenced by views
+  //! this is done only once everything has been consumed or once the consumed part reaches
+  //! __CPP_REDIS_BUFFER_COMPACT_THRESHOLD bytes, unless bForce is set
+  //!
+  //! \param bForce whether the consumed bytes should be released whatever their size
+  //!
+  void compact(bool bForce);
+
+  //!
+  //! when the parser knows how many bytes it still needs (bulk string with a known size),
+  //! reserve the buffer once so that following reads do not reallocate it several times
+  //!
+  void reserve_pending(void);
+
+  //!
+  //! check that the bytes kept in m_sBuffer (not parsed yet, or referenced by views) do not exceed the limit
+  //!
+  //! \return false if they do (m_szError is then set)
+  //!
+  bool check_buffer_size(void);
+
+  //!
+  //! release the storage of m_sBuffer if it is empty and its capacity exceeds the shrink threshold
+  //!
+  void shrink(void);
+
+private:
+  //!
+  //! reply available in the builder
+  //!
+  struct available_reply {
+    //!
+    //! built reply (null for views and for replies passed as events)
+    //!
+    reply       value;
+
+    //!
+    //! whether the reply has been kept as a view
+    //!
+    bool        bView;
+
+    //!
+    //! for views, position of the first byte of the reply in m_sBuffer
+    //!
+    std::size_t uBegin;
+
+    //!
+    //! for views, position following the last byte of the reply in m_sBuffer
+    //!
+    std::size_t uEnd;
+  };
+
 private:
   //!
   //! buffer to be used to build data
@@ -101,14 +287,69 @@ private:
   std::string                       m_sBuffer;
 
   //!
-  //! current builder used to build current reply
+  //! position of the first byte of m_sBuffer that has not been consumed yet by the parser
+  //!
+  std::size_t                       m_uBufferPos;
+
+  //!
+  //! parser used to build replies, keeping the state of the reply currently being built
+  //!
+  reply_parser                      m_parser;
+
+  //!
+  //! pool of recycled storage used by the parser when enabled
+  //!
+  reply_pool                        m_pool;
+
+  //!
+  //! whether m_pool is used
+  //!
+  bool                              m_bPoolEnabled;
+
+  //!
+  //! predicate deciding which replies are kept as views (may be empty)
+  //!
+  view_predicate_t                  m_fnViewPredicate;
+
+  //!
+  //! whether the parser is in the middle of a reply
+  //!
+  bool                              m_bReplyStarted;
+
+  //!
+  //! whether the reply in progress is kept as a view
+  //!
+  bool                              m_bReplyIsView;
+
+  //!
+  //! selector deciding which replies are passed as events (may be empty)
+  //!
+  handler_selector_t                m_fnHandlerSelector;
+
+  //!
+  //! handler receiving the events of the reply in progress (null if the reply is built or kept as a view)
+  //!
+  reply_handler_iface*              m_ptrReplyHandler;
+
+  //!
+  //! position in m_sBuffer of the first byte of the reply in progress
+  //!
+  std::size_t                       m_uReplyBegin;
+
+  //!
+  //! queue of available replies
+  //!
+  std::deque<available_reply>       m_deqAvailableReplies;
+
+  //!
+  //! limits bounding the memory used to receive replies
   //!
-  std::unique_ptr<builder_iface>    m_ptrBuilder;
+  reply_limits                      m_limits;
 
   //!
-  //! queue of available (built) replies
+  //! error detected by the builder itself (limit exceeded), parsing errors are kept by the parser
   //!
-  std::deque<reply>                 m_deqAvailableReplies;
+  const char*                       m_szError;
 };
 
 } // namespace builders
@@ -0,0 +1,108 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <cpp_redis/builders/reply_handler_iface.hpp>
+#include <cpp_redis/builders/reply_parser.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! push parser passing the replies it is fed with to a reply_handler_iface, as a sequence of events
+//! unlike reply_builder, replies are never built nor kept in memory: only an incomplete header line is buffered
+//! between two calls, so that replies of any size are consumed with constant memory
+//!
+class reply_event_parser {
+public:
+  //!
+  //! ctor
+  //!
+  //! \param handler handler receiving the events, must outlive the parser
+  //!
+  explicit reply_event_parser(reply_handler_iface& handler);
+  //! dtor
+  ~reply_event_parser(void) = default;
+
+  //! copy ctor
+  reply_event_parser(const reply_event_parser&) = delete;
+  //! assignment operator
+  reply_event_parser& operator=(const reply_event_parser&) = delete;
+
+public:
+  //!
+  //! parse data, passing the events it contains to the handler
+  //!
+  //! \param data data received from the redis server
+  //! \return current instance
+  //!
+  reply_event_parser& operator<<(const std::string& data);
+
+  //!
+  //! \return number of replies fully parsed since the creation of the parser (or since the last reset)
+  //!
+  std::size_t replies_count(void) const;
+
+  //!
+  //! reset the parser to its initial state (drop any partially parsed reply)
+  //!
+  void reset(void);
+
+private:
+  //!
+  //! emit the events available in buffer, starting at pos
+  //!
+  //! \param buffer data to be parsed
+  //! \param pos position of the first byte not parsed yet, updated to the first byte that has not been used
+  //!
+  void parse(const std::string& buffer, std::size_t& pos);
+
+private:
+  //!
+  //! handler receiving the events
+  //!
+  reply_handler_iface&  m_handler;
+
+  //!
+  //! parser emitting the events
+  //!
+  reply_parser          m_parser;
+
+  //!
+  //! bytes received but not parsed yet (incomplete header line or end sequence)
+  //!
+  std::string           m_sBuffer;
+
+  //!
+  //! number of replies fully parsed
+  //!
+  std::size_t           m_uRepliesCount;
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
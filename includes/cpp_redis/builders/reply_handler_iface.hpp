@@ -0,0 +1,105 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+#include <cpp_redis/misc/string_ref.hpp>
+
+#include <stdint.h>
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! interface receiving the content of a reply as a sequence of events, emitted as the bytes of the reply are received
+//! (instead of a reply tree built once the complete reply has been received)
+//! strings are passed as string_ref pointing into the receive buffer: they are only valid during the call
+//! every method does nothing by default
+//!
+class reply_handler_iface {
+public:
+  //! ctor
+  reply_handler_iface(void) = default;
+  //! dtor
+  virtual ~reply_handler_iface(void) = default;
+
+  //! copy ctor
+  reply_handler_iface(const reply_handler_iface&) = default;
+  //! assignment operator
+  reply_handler_iface& operator=(const reply_handler_iface&) = default;
+
+public:
+  //!
+  //! an array starts, its elements follow, then on_array_end
+  //!
+  //! \param size number of elements of the array
+  //!
+  virtual void on_array_begin(std::size_t size);
+
+  //!
+  //! the last element of the current array has been received
+  //!
+  virtual void on_array_end(void);
+
+  //!
+  //! part of a bulk string has been received
+  //! the content of a bulk string is passed in as many chunks as required, the last one having last set
+  //! (an empty bulk string is passed as a single empty chunk)
+  //!
+  //! \param chunk received part of the bulk string
+  //! \param last whether this is the last part of the bulk string
+  //!
+  virtual void on_bulk(const string_ref& chunk, bool last);
+
+  //!
+  //! a simple string has been received
+  //!
+  //! \param value simple string
+  //!
+  virtual void on_simple_string(const string_ref& value);
+
+  //!
+  //! an error has been received
+  //!
+  //! \param value error message
+  //!
+  virtual void on_error(const string_ref& value);
+
+  //!
+  //! an integer has been received
+  //!
+  //! \param value integer
+  //!
+  virtual void on_integer(int64_t value);
+
+  //!
+  //! a null bulk string or a null array has been received
+  //!
+  virtual void on_null(void);
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
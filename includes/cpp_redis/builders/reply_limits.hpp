@@ -0,0 +1,85 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+//!
+//! default limits applied to the data received from the redis server (0 means unlimited)
+//!
+#ifndef __CPP_REDIS_MAX_BUFFER_SIZE
+#define __CPP_REDIS_MAX_BUFFER_SIZE 0
+#endif /* __CPP_REDIS_MAX_BUFFER_SIZE */
+
+#ifndef __CPP_REDIS_MAX_BULK_LENGTH
+#define __CPP_REDIS_MAX_BULK_LENGTH (512 * 1024 * 1024)
+#endif /* __CPP_REDIS_MAX_BULK_LENGTH */
+
+#ifndef __CPP_REDIS_MAX_ARRAY_SIZE
+#define __CPP_REDIS_MAX_ARRAY_SIZE 0
+#endif /* __CPP_REDIS_MAX_ARRAY_SIZE */
+
+#ifndef __CPP_REDIS_BUFFER_SHRINK_THRESHOLD
+#define __CPP_REDIS_BUFFER_SHRINK_THRESHOLD (1024 * 1024)
+#endif /* __CPP_REDIS_BUFFER_SHRINK_THRESHOLD */
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! limits bounding the memory used to receive replies
+//! a reply exceeding one of them is reported as invalid data, which makes the connection disconnect
+//!
+struct reply_limits {
+  //!
+  //! ctor, using the __CPP_REDIS_MAX_* and __CPP_REDIS_BUFFER_SHRINK_THRESHOLD defaults
+  //!
+  reply_limits(void);
+
+  //!
+  //! maximum number of received bytes kept in the receive buffer: not parsed yet, or referenced by reply views
+  //! (0 for no limit)
+  //!
+  std::size_t uMaxBufferSize;
+
+  //!
+  //! maximum length of a bulk string (0 for no limit)
+  //!
+  std::size_t uMaxBulkLength;
+
+  //!
+  //! maximum number of elements of an array (0 for no limit)
+  //!
+  std::size_t uMaxArraySize;
+
+  //!
+  //! capacity above which the receive buffer is released once all the data it contains has been used
+  //! (0 to always keep the capacity reached by the largest reply)
+  //!
+  std::size_t uShrinkThreshold;
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
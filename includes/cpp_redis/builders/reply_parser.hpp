@@ -0,0 +1,343 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cpp_redis/builders/reply_handler_iface.hpp>
+#include <cpp_redis/builders/reply_limits.hpp>
+#include <cpp_redis/builders/reply_pool.hpp>
+#include <cpp_redis/core/reply.hpp>
+
+#include <stdint.h>
+
+#ifndef __CPP_REDIS_MAX_NESTING_DEPTH
+#define __CPP_REDIS_MAX_NESTING_DEPTH 32
+#endif /* __CPP_REDIS_MAX_NESTING_DEPTH */
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! iterative parser for redis replies
+//! unlike the builders returned by create_builder, a single instance handles every reply type:
+//! nested arrays are tracked with a fixed-size stack of frames instead of one heap-allocated builder per row,
+//! and the instance is reused from one reply to the next
+//!
+class reply_parser {
+public:
+  //! ctor
+  reply_parser(void);
+  //! dtor
+  ~reply_parser(void) = default;
+
+  //! copy ctor
+  reply_parser(const reply_parser&) = delete;
+  //! assignment operator
+  reply_parser& operator=(const reply_parser&) = delete;
+
+public:
+  //!
+  //! outcome of a parsing call
+  //!
+  enum class status {
+    //! more data is required to reach the end of the reply
+    incomplete,
+    //! the end of the reply has been reached
+    complete,
+    //! the data is not a valid redis reply (see get_error), the parser must be reset before being used again
+    invalid
+  };
+
+public:
+  //!
+  //! take data as parameter which is consumed, starting at the given position, until a reply is fully built
+  //! the position is advanced past every byte used, the buffer itself is left untouched
+  //! if the reply is incomplete, the parsing state is kept and the next call resumes where this one stopped
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \return whether a reply has been fully built (and can be retrieved with get_reply)
+  //! \throw redis_error if the data is not a valid redis reply
+  //!
+  bool consume(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! same as consume, but only frame the reply: the data is validated and the position is advanced past the reply,
+  //! without building it (no copy, no allocation); get_reply is left untouched
+  //! a reply must be entirely consumed, or entirely skipped
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \return whether the end of the reply has been reached
+  //! \throw redis_error if the data is not a valid redis reply
+  //!
+  bool skip(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! same as consume, but the reply is not built: its content is passed to the handler as it is received
+  //! bulk strings are passed in chunks, without waiting for their complete content; get_reply is left untouched
+  //! a reply must be entirely consumed, skipped, or emitted
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \param handler handler receiving the events
+  //! \return whether the end of the reply has been reached
+  //! \throw redis_error if the data is not a valid redis reply
+  //!
+  bool emit(const std::string& buffer, std::size_t& pos, reply_handler_iface& handler);
+
+  //!
+  //! same as consume, but invalid data is reported through the returned status instead of an exception
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \return parsing status
+  //!
+  status try_consume(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! same as skip, but invalid data is reported through the returned status instead of an exception
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \return parsing status
+  //!
+  status try_skip(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! same as emit, but invalid data is reported through the returned status instead of an exception
+  //! (exceptions thrown by the handler itself are propagated)
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer, updated to the first byte that has not been used
+  //! \param handler handler receiving the events
+  //! \return parsing status
+  //!
+  status try_emit(const std::string& buffer, std::size_t& pos, reply_handler_iface& handler);
+
+  //!
+  //! \return description of the error that made the data invalid, or nullptr if no error occured since the last reset
+  //!
+  const char* get_error(void) const;
+
+  //!
+  //! \return last reply fully built by consume
+  //!
+  const reply& get_reply(void) const;
+
+  //!
+  //! same as get_reply, but the reply is moved out of the parser instead of being copied
+  //!
+  //! \return last reply fully built by consume
+  //!
+  reply take_reply(void);
+
+  //!
+  //! \return number of bytes, starting at the current position, known to be still required to complete the
+  //! current bulk string (0 if not reading a bulk string, or if emitting events)
+  //!
+  std::size_t pending_size(void) const;
+
+  //!
+  //! reset the parser to its initial state (drop any partially built reply)
+  //!
+  void reset(void);
+
+  //!
+  //! set the pool from which strings and row vectors of the built replies are taken
+  //!
+  //! \param pool pool to be used, or nullptr to allocate new storage for every reply
+  //!
+  void set_pool(reply_pool* pool);
+
+  //!
+  //! set the limits on the size of bulk strings and arrays (uMaxBufferSize and uShrinkThreshold are not used by the parser)
+  //! a bulk string or an array over the limits makes the data invalid as soon as its header is read
+  //!
+  //! \param limits limits to be applied
+  //!
+  void set_limits(const reply_limits& limits);
+
+private:
+  //!
+  //! parsing loop shared by consume, skip and emit, building values or emitting events depending on m_eMode
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer
+  //! \return parsing status
+  //!
+  status parse(const std::string& buffer, std::size_t& pos);
+
+  //!
+  //! record a parsing error, reported by parse as an invalid status
+  //!
+  //! \param error description of the error (string literal)
+  //! \return false, so that the readers can return fail(...) directly
+  //!
+  bool fail(const char* error);
+
+  //!
+  //! read a complete header line (type and content, up to the end sequence) and build the associated reply
+  //! nothing is consumed if the line is not complete yet
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer
+  //! \param value reply built from the line, if any
+  //! \return whether a value has been built (false if more data is required, if a header was consumed or on error)
+  //!
+  bool read_header(const std::string& buffer, std::size_t& pos, reply& value);
+
+  //!
+  //! read the content of a bulk string whose size has already been read
+  //!
+  //! \param buffer data to be consumed
+  //! \param pos position of the first unconsumed byte in buffer
+  //! \param value reply built from the bulk string
+  //! \return whether the bulk string has been fully read (false on error)
+  //!
+  bool read_bulk_string(const std::string& buffer, std::size_t& pos, reply& value);
+
+  //!
+  //! push a new array frame on the stack
+  //!
+  //! \param size number of elements of the array
+  //! \return false if the maximum nesting depth is reached
+  //!
+  bool push_frame(int64_t size);
+
+  //!
+  //! append a built value to the array currently being built, or store it as the final reply
+  //! completed arrays are popped and appended to their parent
+  //!
+  //! \param value built value
+  //! \return whether the top-level reply is complete
+  //!
+  bool add_value(reply& value);
+
+  //!
+  //! convert the given part of the buffer into an integer
+  //!
+  //! \param buffer buffer containing the integer
+  //! \param begin position of the first character
+  //! \param end position of the end sequence
+  //! \param value converted integer
+  //! \return false if the characters do not form a valid integer
+  //!
+  bool parse_integer(const std::string& buffer, std::size_t begin, std::size_t end, int64_t& value);
+
+  //!
+  //! copy the given part of the buffer into a string, taken from the pool if any
+  //!
+  //! \param buffer buffer containing the string
+  //! \param pos position of the first character
+  //! \param size size of the string
+  //! \return copied string
+  //!
+  std::string make_string(const std::string& buffer, std::size_t pos, std::size_t size);
+
+private:
+  //!
+  //! array being built
+  //!
+  struct frame {
+    //!
+    //! rows already built
+    //!
+    std::vector<reply>  vctRows;
+
+    //!
+    //! number of rows still to be built
+    //!
+    int64_t             nRemaining;
+  };
+
+  //!
+  //! stack of arrays being built, m_uDepth first entries are in use
+  //!
+  frame                 m_frames[__CPP_REDIS_MAX_NESTING_DEPTH];
+
+  //!
+  //! number of arrays being built
+  //!
+  std::size_t           m_uDepth;
+
+  //!
+  //! size of the bulk string being read, -1 when reading a header line
+  //!
+  int64_t               m_nBulkSize;
+
+  //!
+  //! number of bytes after the current position already scanned for an end sequence (incomplete header line)
+  //!
+  std::size_t           m_uScanned;
+
+  //!
+  //! what is done with the parsed values
+  //!
+  enum class mode {
+    //! build a reply (consume)
+    build,
+    //! only frame the reply (skip)
+    skip,
+    //! pass the values to m_ptrHandler (emit)
+    events
+  };
+
+  //!
+  //! current parsing mode
+  //!
+  mode                  m_eMode;
+
+  //!
+  //! handler receiving the events (emit)
+  //!
+  reply_handler_iface*  m_ptrHandler;
+
+  //!
+  //! last reply fully built
+  //!
+  reply                 m_reply;
+
+  //!
+  //! error that made the data invalid (nullptr if none)
+  //!
+  const char*           m_szError;
+
+  //!
+  //! pool to take strings and row vectors from (may be null)
+  //!
+  reply_pool*           m_ptrPool;
+
+  //!
+  //! limits on the size of bulk strings and arrays
+  //!
+  reply_limits          m_limits;
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
@@ -0,0 +1,94 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cpp_redis/core/reply.hpp>
+
+#ifndef __CPP_REDIS_REPLY_POOL_SIZE
+#define __CPP_REDIS_REPLY_POOL_SIZE 1024
+#endif /* __CPP_REDIS_REPLY_POOL_SIZE */
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! pool of strings and row vectors recycled from replies that are not needed anymore
+//! once a reply has been handed to its callback, its whole tree can be released to the pool in one shot:
+//! the next replies built by the parser then reuse the already allocated storage instead of allocating again
+//!
+class reply_pool {
+public:
+  //! ctor
+  reply_pool(void) = default;
+  //! dtor
+  ~reply_pool(void) = default;
+
+  //! copy ctor
+  reply_pool(const reply_pool&) = delete;
+  //! assignment operator
+  reply_pool& operator=(const reply_pool&) = delete;
+
+public:
+  //!
+  //! \return an empty string, reusing the storage of a released string if any
+  //!
+  std::string acquire_string(void);
+
+  //!
+  //! \return an empty row vector, reusing the storage of a released array if any
+  //!
+  std::vector<reply> acquire_rows(void);
+
+  //!
+  //! release the storage of the given reply tree to the pool
+  //! at most __CPP_REDIS_REPLY_POOL_SIZE strings and row vectors are kept, the others are freed
+  //!
+  //! \param r reply to be released, set to null on return
+  //!
+  void release(reply& r);
+
+  //!
+  //! free all the storage kept by the pool
+  //!
+  void clear(void);
+
+private:
+  //!
+  //! released strings
+  //!
+  std::vector<std::string>          m_vctStrings;
+
+  //!
+  //! released row vectors
+  //!
+  std::vector<std::vector<reply>>   m_vctRows;
+};
+
+} // namespace builders
+
+} // namespace cpp_redis
@@ -0,0 +1,114 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+//!
+//! default watermarks bounding the commands waiting for their reply (0 means unlimited)
+//!
+#ifndef __CPP_REDIS_HIGH_WATERMARK_BYTES
+#define __CPP_REDIS_HIGH_WATERMARK_BYTES 0
+#endif /* __CPP_REDIS_HIGH_WATERMARK_BYTES */
+
+#ifndef __CPP_REDIS_LOW_WATERMARK_BYTES
+#define __CPP_REDIS_LOW_WATERMARK_BYTES 0
+#endif /* __CPP_REDIS_LOW_WATERMARK_BYTES */
+
+#ifndef __CPP_REDIS_HIGH_WATERMARK_COMMANDS
+#define __CPP_REDIS_HIGH_WATERMARK_COMMANDS 0
+#endif /* __CPP_REDIS_HIGH_WATERMARK_COMMANDS */
+
+#ifndef __CPP_REDIS_LOW_WATERMARK_COMMANDS
+#define __CPP_REDIS_LOW_WATERMARK_COMMANDS 0
+#endif /* __CPP_REDIS_LOW_WATERMARK_COMMANDS */
+
+namespace cpp_redis {
+
+//!
+//! commands sent by a client and still waiting for their reply: submitted, buffered, or written to the network
+//!
+struct pending_depth {
+  //!
+  //! size of the encoded commands
+  //!
+  std::size_t uBytes;
+
+  //!
+  //! number of commands
+  //!
+  std::size_t uCommands;
+};
+
+//!
+//! what happens to a command sent while the pending commands are above their high watermark
+//!
+enum class backpressure_policy {
+  //! the pending commands are committed, and the sender blocks until they fall below their low watermark
+  //! the commands sent from a reply callback are sent without blocking, as the replies would not be received meanwhile
+  block,
+  //! the command is not sent: its callback is called right away with an error reply
+  fail,
+  //! the command is sent: the user callback is notified when the high watermark is reached, and when the pending
+  //! commands fall below their low watermark
+  callback
+};
+
+//!
+//! watermarks bounding the memory used by the commands waiting for their reply
+//! once a high watermark is reached, the policy applies until both the size and the number of pending commands fall
+//! below their low watermark
+//! commands reaching a high watermark while the other pending commands are below their low watermark are sent anyway,
+//! as no reply would clear the saturation
+//!
+struct backpressure_limits {
+  //!
+  //! ctor, using the __CPP_REDIS_*_WATERMARK_* defaults, with the block policy
+  //!
+  backpressure_limits(void);
+
+  //!
+  //! size of the pending commands beyond which the policy applies (0 for no limit), and below which it stops applying
+  //!
+  std::size_t uHighBytes;
+  std::size_t uLowBytes;
+
+  //!
+  //! number of pending commands beyond which the policy applies (0 for no limit), and below which it stops applying
+  //!
+  std::size_t uHighCommands;
+  std::size_t uLowCommands;
+
+  //!
+  //! policy applied to the commands sent above the high watermark
+  //!
+  backpressure_policy ePolicy;
+
+  //!
+  //! callback of the callback policy, called with true once the high watermark is reached, and with false once
+  //! the pending commands fall below the low watermark (called from the sender or network thread, without any lock)
+  //!
+  std::function<void(bool bSaturated, const pending_depth& depth)> callback;
+};
+
+} // namespace cpp_redis
@@ -0,0 +1,132 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cpp_redis/core/command_table.hpp>
+
+namespace cpp_redis {
+
+//!
+//! commands prepared to be sent together by client::send_batch
+//! commands are encoded into the private buffer of the batch as they are added, without touching the client: a batch
+//! can be filled on any thread, and is then submitted with a single lock of the client and a single network write,
+//! its replies being delivered all at once
+//!
+class batch {
+public:
+  //! ctor & dtor
+  batch(void) = default;
+  ~batch(void) = default;
+
+  //! copy ctor & assignment operator
+  batch(const batch&) = default;
+  batch& operator=(const batch&) = default;
+
+  //! move ctor & assignment operator
+  batch(batch&&) = default;
+  batch& operator=(batch&&) = default;
+
+public:
+  //!
+  //! add the given command to the batch
+  //!
+  //! \param redis_cmd command to be added
+  //! \return current instance
+  //!
+  batch& send(const std::vector<std::string>& vctRedisCmd);
+
+  //!
+  //! add the given command to the batch, its arguments being serialized in place (see client::send_args)
+  //! any command of the client can be added this way, for example send_args(command_id::set, key, value)
+  //!
+  //! \param args arguments of the command, starting with its name
+  //! \return current instance
+  //!
+  template <typename... Args>
+  batch& send_args(Args&&... args);
+
+  //!
+  //! reserve room in the encode buffer, to avoid growing it while adding commands
+  //!
+  //! \param bytes expected size of the encoded commands
+  //! \param commands expected number of commands
+  //!
+  void reserve(std::size_t uBytes, std::size_t uCommands);
+
+  //!
+  //! remove all the commands of the batch, keeping its buffers allocated
+  //!
+  void clear(void);
+
+public:
+  //!
+  //! \return number of commands in the batch
+  //!
+  std::size_t size(void) const;
+
+  //!
+  //! \return whether the batch has no command
+  //!
+  bool empty(void) const;
+
+  //!
+  //! \return encoded commands, one after the other
+  //!
+  const std::vector<char>& get_buffer(void) const;
+
+  //!
+  //! \param index index of a command of the batch
+  //! \return position of the command in the buffer
+  //!
+  std::size_t get_offset(std::size_t uIndex) const;
+
+  //!
+  //! \param index index of a command of the batch
+  //! \return size of the encoded command
+  //!
+  std::size_t get_size(std::size_t uIndex) const;
+
+private:
+  //!
+  //! record the end of the command just encoded
+  //!
+  void end_command(void);
+
+private:
+  //!
+  //! encoded commands
+  //!
+  std::vector<char> m_vctBuffer;
+
+  //!
+  //! end of each command in the buffer
+  //!
+  std::vector<std::size_t> m_vctEnds;
+};
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/batch.ipp>
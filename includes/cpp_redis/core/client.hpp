@@ -23,21 +23,47 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include <cpp_redis/builders/reply_handler_iface.hpp>
+#include <cpp_redis/builders/reply_limits.hpp>
+#include <cpp_redis/core/backpressure.hpp>
+#include <cpp_redis/core/batch.hpp>
+#include <cpp_redis/core/command_table.hpp>
+#include <cpp_redis/core/reply_decoder.hpp>
+#include <cpp_redis/core/reply_view.hpp>
 #include <cpp_redis/core/sentinel.hpp>
 #include <cpp_redis/helpers/variadic_template.hpp>
 #include <cpp_redis/misc/logger.hpp>
+#include <cpp_redis/misc/mpsc_queue.hpp>
+#include <cpp_redis/misc/pooled_future.hpp>
+#include <cpp_redis/misc/ring_buffer.hpp>
+#include <cpp_redis/misc/unique_function.hpp>
 #include <cpp_redis/network/redis_connection.hpp>
 #include <cpp_redis/network/tcp_client_iface.hpp>
 
+//!
+//! default limits beyond which the range overloads of bulk commands (mset, hmset, sadd, zadd, pfadd) split their
+//! elements into several commands: number of elements (pairs counting for two) and size of the encoded command
+//!
+#ifndef __CPP_REDIS_BULK_MAX_ARGS
+#define __CPP_REDIS_BULK_MAX_ARGS 1024
+#endif /* __CPP_REDIS_BULK_MAX_ARGS */
+
+#ifndef __CPP_REDIS_BULK_MAX_BYTES
+#define __CPP_REDIS_BULK_MAX_BYTES (1024 * 1024)
+#endif /* __CPP_REDIS_BULK_MAX_BYTES */
+
 namespace cpp_redis {
 
 //!
@@ -157,6 +183,78 @@ public:
   //!
   bool is_reconnecting(void) const;
 
+  //!
+  //! enable or disable the reply pool of the underlying connection
+  //! when enabled, the strings and arrays of a reply are recycled as soon as its callback returns and reused to
+  //! build the following replies, which avoids most allocations for large replies received at a high rate.
+  //! Callbacks must move out of the reply (std::move) whatever they want to keep after returning.
+  //! Replies delivered through std::future are moved to the future and are never recycled.
+  //!
+  //! \param enabled whether the reply pool should be used
+  //!
+  void set_reply_pool_enabled(bool bEnabled);
+
+  //!
+  //! set the limits bounding the memory used by the underlying connection to receive replies
+  //! (maximum buffered bytes, bulk string length and array size, and capacity above which the receive buffer is
+  //! released after a large reply). A reply exceeding them is logged as an error and the connection is dropped:
+  //! as for any disconnection, pending commands are then resent on reconnection or failed with an error reply
+  //!
+  //! \param limits limits to be applied
+  //!
+  void set_reply_limits(const builders::reply_limits& limits);
+
+  //!
+  //! set the limits beyond which the range overloads of bulk commands (mset, hmset, sadd, zadd, pfadd) split their
+  //! elements into several commands, so that huge inputs are streamed without being materialized, nor blocking the
+  //! server on a single huge command. Split commands are not atomic: an mset may then be partially applied.
+  //! to be called before sending commands
+  //!
+  //! \param max_args maximum number of elements per command, pairs counting for two (0 for no limit)
+  //! \param max_bytes size of an encoded command beyond which no more elements are added to it (0 for no limit)
+  //!
+  void set_bulk_split_limits(std::size_t uMaxArgs, std::size_t uMaxBytes);
+
+  //!
+  //! enable the auto commit mode: the submitted commands are committed without waiting for commit() once they
+  //! reach the given size or number, or once the given delay elapsed since the first of them was submitted
+  //! the commands of concurrent senders are thus coalesced into a single write, without committing each of them
+  //! commit() / sync_commit() can still be called to flush the commands right away
+  //! to be called before sending commands (all thresholds set to 0 disable the mode)
+  //!
+  //! \param max_bytes size of the encoded commands beyond which they are committed (0 for no limit)
+  //! \param max_commands number of commands beyond which they are committed (0 for no limit)
+  //! \param delay time after which the first submitted command is committed (0 for no delay)
+  //!
+  void set_auto_commit(std::size_t uMaxBytes, std::size_t uMaxCommands,
+      const std::chrono::microseconds& durDelay = std::chrono::microseconds(0));
+
+  //!
+  //! bound the commands waiting for their reply (submitted, buffered, or written to the network)
+  //! once the given high watermarks are reached, the commands sent are blocked, failed, or reported through a
+  //! callback, depending on the policy, until the pending commands fall below the low watermarks
+  //! with the block policy, the commands sent from inside a reply callback are sent without blocking
+  //! to be called before sending commands
+  //!
+  //! \param limits watermarks and policy to be applied
+  //!
+  void set_backpressure(const backpressure_limits& limits);
+
+  //!
+  //! select whether the commands pending when the connection is lost are replayed once reconnected (default)
+  //! in no-replay mode, a command only keeps its callback once written to the send buffer, its encoded form being
+  //! released: the commands pending when the connection is lost fail with an error instead of being replayed
+  //! to be called before sending commands
+  //!
+  //! \param enabled whether the pending commands are replayed on reconnection
+  //!
+  void set_replay_enabled(bool bEnabled);
+
+  //!
+  //! \return size and number of the commands waiting for their reply
+  //!
+  pending_depth get_pending_depth(void) const;
+
   //!
   //! stop any reconnect in progress
   //!
@@ -169,10 +267,53 @@ public:
   //!
   typedef std::function<void(reply&)> reply_callback_t;
 
+  //!
+  //! reply view callback called whenever a reply is received
+  //! takes as parameter a view on the received reply, pointing into the receive buffer
+  //! the view is only valid during the call: the callback must copy whatever it wants to keep
+  //!
+  typedef std::function<void(const reply_view&)> reply_view_callback_t;
+
+  //!
+  //! reply handler receiving the content of a reply as events, as it is received
+  //!
+  typedef std::shared_ptr<builders::reply_handler_iface> reply_handler_t;
+
+  //!
+  //! immutable value shared with the caller, written to the network without being copied when large enough
+  //!
+  typedef network::redis_connection::shared_value_t shared_value_t;
+
+  //!
+  //! storage of the callbacks of pending commands: move-only, callables up to __CPP_REDIS_CALLBACK_INLINE_SIZE bytes
+  //! (such as lambdas capturing a few pointers or strings) being stored without any allocation
+  //!
+  typedef unique_function<void(reply&)>            stored_reply_callback_t;
+  typedef unique_function<void(const reply_view&)> stored_reply_view_callback_t;
+
+  //!
+  //! future returned by the future-based command methods
+  //! defining __CPP_REDIS_USE_POOLED_FUTURES (USE_POOLED_FUTURES cmake option) switches them to pooled_future, which
+  //! recycles its shared state and waits by spinning before parking, instead of allocating a std::promise state with
+  //! its own mutex and condition variable for each command
+  //! once the pool is warm, the future and its callback add no allocation to the ones of the command itself (its
+  //! encoded frame), whereas std::promise allocates its shared state and its result for each command
+  //! (named commands with optional arguments add the shared ownership of their promise, see exec_cmd)
+  //! the macro must be defined identically when building cpp_redis and the code using it: the cmake option exports it
+  //! to the targets linking cpp_redis, and to the Cflags of its pkg-config file
+  //!
+#ifdef __CPP_REDIS_USE_POOLED_FUTURES
+  typedef pooled_future<reply> reply_future_t;
+#else
+  typedef std::future<reply> reply_future_t;
+#endif /* __CPP_REDIS_USE_POOLED_FUTURES */
+
   //!
   //! send the given command
   //! the command is actually pipelined and only buffered, so nothing is sent to the network
   //! please call commit() / sync_commit() to flush the buffer
+  //! the command is encoded on the calling thread and enqueued without taking any lock: concurrent senders do not
+  //! contend with each other, their commands being moved to the send buffer in submission order on commit
   //!
   //! \param redis_cmd command to be sent
   //! \param callback callback to be called on received reply
@@ -180,6 +321,42 @@ public:
   //!
   client& send(const std::vector<std::string>& vctRedisCmd, const reply_callback_t& callback);
 
+  //!
+  //! same as the other send method, without any callback
+  //! picks the reply_callback_t overload for a nullptr callback, which otherwise converts to the types of the other
+  //! callbacks (reply view callback, reply handler, shared value) as well
+  //!
+  //! \param redis_cmd command to be sent
+  //! \return current instance
+  //!
+  client& send(const std::vector<std::string>& vctRedisCmd, std::nullptr_t);
+
+  //!
+  //! same as the other send method, for any callable taking a reply&
+  //! the callable is stored as is with the pending command, without being converted to a std::function first
+  //!
+  //! \param redis_cmd command to be sent
+  //! \param callback callback to be called on received reply
+  //! \return current instance
+  //!
+  template <typename Callback,
+      typename std::enable_if<is_callable<typename std::decay<Callback>::type, reply&>::value, int>::type = 0>
+  client& send(const std::vector<std::string>& vctRedisCmd, Callback&& callback);
+
+  //!
+  //! same as the send method taking a reply view callback, for any callable taking a const reply_view&
+  //! the callable is stored as is with the pending command, without being converted to a std::function first
+  //!
+  //! \param redis_cmd command to be sent
+  //! \param callback callback to be called on received reply, with a view on it
+  //! \return current instance
+  //!
+  template <typename Callback,
+      typename std::enable_if<!is_callable<typename std::decay<Callback>::type, reply&>::value
+                              && is_callable<typename std::decay<Callback>::type, const reply_view&>::value,
+          int>::type = 0>
+  client& send(const std::vector<std::string>& vctRedisCmd, Callback&& callback);
+
   //!
   //! same as the other send method
   //! but future based: does not take any callback and return an std:;future to handle the reply
@@ -187,7 +364,121 @@ public:
   //! \param redis_cmd command to be sent
   //! \return std::future to handler redis reply
   //!
-  std::future<reply> send(const std::vector<std::string>& vctRedisCmd);
+  reply_future_t send(const std::vector<std::string>& vctRedisCmd);
+
+  //!
+  //! same as the other send method
+  //! but the reply is not built: the callback receives a view pointing into the receive buffer, which saves
+  //! the copy of every string of the reply when the callback decodes it into its own structures
+  //!
+  //! \param redis_cmd command to be sent
+  //! \param callback callback to be called on received reply, with a view only valid during the call
+  //! \return current instance
+  //!
+  client& send(const std::vector<std::string>& vctRedisCmd, const reply_view_callback_t& callback);
+
+  //!
+  //! same as the other send method
+  //! but the reply is never built nor buffered: its content is passed to the handler as events, as its bytes are
+  //! received (arrays of any size and bulk strings in chunks), so that huge replies are consumed with constant memory
+  //! sync_commit returns once the reply has been completely passed to the handler
+  //! on network failure, the handler receives an error event (possibly after part of the reply), and the events of
+  //! a command resent after a reconnection start over
+  //!
+  //! \param redis_cmd command to be sent
+  //! \param handler handler receiving the content of the reply
+  //! \return current instance
+  //!
+  client& send(const std::vector<std::string>& vctRedisCmd, const reply_handler_t& handler);
+
+  //!
+  //! same as the other send method
+  //! but the last argument of the command is a value shared with the caller: large values are written to the network
+  //! straight from the caller's memory, without being copied in the send buffer
+  //! the value must not be modified until the reply is received (it may be resent after a reconnection)
+  //!
+  //! \param redis_cmd command to be sent, except its last argument
+  //! \param value last argument of the command
+  //! \param callback callback to be called on received reply
+  //! \return current instance
+  //!
+  client& send(const std::vector<std::string>& vctRedisCmd, const shared_value_t& value,
+      const reply_callback_t& callback);
+
+  //!
+  //! same as the other send method
+  //! but future based: does not take any callback and return an std:;future to handle the reply
+  //!
+  //! \param redis_cmd command to be sent, except its last argument
+  //! \param value last argument of the command
+  //! \return std::future to handler redis reply
+  //!
+  reply_future_t send(const std::vector<std::string>& vctRedisCmd, const shared_value_t& value);
+
+  //!
+  //! same as the other send method
+  //! but the reply is decoded straight from the receive buffer into a T, using reply_decoder<T>, without building
+  //! the reply tree: for example send_as<int64_t>({"INCR", "k"}),
+  //! send_as<std::vector<std::pair<std::string, double>>>({"ZRANGE", "k", "0", "-1", "WITHSCORES"}) or
+  //! send_as<std::unordered_map<std::string, std::string>>({"HGETALL", "k"})
+  //! error replies, and replies that can not be decoded into a T, are reported through the future as redis_error
+  //!
+  //! \param redis_cmd command to be sent
+  //! \return std::future to handle the decoded reply
+  //!
+  template <typename T>
+  std::future<T> send_as(const std::vector<std::string>& vctRedisCmd);
+
+  //!
+  //! same as the other send method
+  //! but the command is given as typed arguments, serialized straight into its encoded form without building any
+  //! intermediate string: command_id values (pre-encoded name), strings (std::string, const char*, string_ref,
+  //! std::string_view), byte vectors (std::vector<char>, std::vector<unsigned char>), integers and floating point
+  //! numbers. For example send_args(callback, "EXPIRE", key, 60) or send_args(callback, command_id::zadd, key, 1.5, m)
+  //!
+  //! \param callback callback to be called on received reply (any callable taking a reply&, stored as is)
+  //! \param args arguments of the command, starting with its name
+  //! \return current instance
+  //!
+  template <typename Callback, typename... Args>
+  client& send_args(Callback&& callback, Args&&... args);
+
+  //!
+  //! same as send_args
+  //! but future based: does not take any callback and return an std:;future to handle the reply
+  //!
+  //! \param args arguments of the command, starting with its name
+  //! \return std::future to handler redis reply
+  //!
+  template <typename... Args>
+  reply_future_t send_args_future(Args&&... args);
+
+  //!
+  //! callback called once all the replies of a batch have been received, with one reply per command of the batch,
+  //! in the order of the commands
+  //!
+  typedef std::function<void(std::vector<reply>&)> batch_callback_t;
+
+  //!
+  //! send all the commands of the given batch at once, and commit them
+  //! the encoded commands are appended to the send buffer under a single lock, after the commands submitted before,
+  //! then written with a single network write: no other command can be interleaved with the ones of the batch
+  //! the batch is left untouched, and can be cleared and reused for the next batch
+  //!
+  //! \param commands commands to be sent
+  //! \param callback callback to be called with all the replies (also called, with no reply, for an empty batch)
+  //! \return current instance
+  //!
+  client& send_batch(const batch& commands, const batch_callback_t& callback);
+
+  //!
+  //! same as the other send_batch method
+  //! but future based: does not take any callback and return an std::future to handle all the replies
+  //!
+  //! \param commands commands to be sent
+  //! \return std::future to handle the replies, one per command of the batch, in order
+  //!
+  std::future<std::vector<reply>> send_batch(const batch& commands);
 
   //!
   //! Sends all the commands that have been stored by calling send() since the last commit() call to the redis server.
@@ -231,7 +522,7 @@ public:
     std::unique_lock<std::mutex> ulockCallback(m_mtxCallbacks);
     __CPP_REDIS_LOG(debug, "cpp_redis::client waiting for callbacks to complete");
     if (!m_cvSync.wait_for(ulockCallback, durTimeout, [=] {
-        return m_uRunningCallbacks_a == 0 && m_queCommands.empty();
+        return m_uRunningCallbacks_a == 0 && m_queCommands.empty() && m_queSubmissions.empty();
     })) {
       __CPP_REDIS_LOG(debug, "cpp_redis::client finished waiting for callback");
     } else {
@@ -247,11 +538,6 @@ private:
   //!
   bool should_reconnect(void) const;
 
-  //!
-  //! resend all pending commands that failed to be sent due to disconnection
-  //!
-  void resend_failed_commands(void);
-
   //!
   //! sleep between two reconnect attemps if necessary
   //!
@@ -276,12 +562,54 @@ private:
 private:
   //!
   //! unprotected send
-  //! same as send, but without any mutex lock
+  //! same as send_args, but without any mutex lock
   //!
-  //! \param redis_cmd cmd to be sent
   //! \param callback callback to be called whenever a reply is received
+  //! \param args arguments of the command, starting with its name
   //!
-  void unprotected_send(const std::vector<std::string>& redis_cmd, const reply_callback_t& callback);
+  template <typename... Args>
+  void unprotected_send_args(const reply_callback_t& callback, const Args&... args);
+
+  //!
+  //! send a command of the command table: its name is not stored nor encoded, its pre-encoded header being copied
+  //! in the send buffer instead
+  //!
+  //! \param command command to be sent
+  //! \param args arguments of the command, following its name (and subcommand)
+  //! \param callback callback to be called on received reply
+  //! \return current instance
+  //!
+  client& send(command_id eCommand, const std::vector<std::string>& vctArgs, const reply_callback_t& callback);
+
+  //!
+  //! same as the other send method, with a last argument shared with the caller
+  //!
+  //! \param command command to be sent
+  //! \param args arguments of the command, following its name (and subcommand), except the last one
+  //! \param value last argument of the command
+  //! \param callback callback to be called on received reply
+  //! \return current instance
+  //!
+  client& send(command_id eCommand, const std::vector<std::string>& vctArgs, const shared_value_t& value,
+      const reply_callback_t& callback);
+
+  //!
+  //! send a command already encoded with the redis protocol format
+  //!
+  //! \param frame encoded command
+  //! \param callback callback to be called on received reply
+  //! \return current instance
+  //!
+  client& send_encoded(std::vector<char>&& vctFrame, stored_reply_callback_t&& callback);
+
+  //!
+  //! same as the other send_encoded method
+  //! but future based: does not take any callback and return an std:;future to handle the reply
+  //!
+  //! \param frame encoded command
+  //! \return std::future to handler redis reply
+  //!
+  reply_future_t send_encoded(std::vector<char>&& vctFrame);
 
   //!
   //! unprotected auth
@@ -482,50 +810,50 @@ public:
 public:
   client&
   append(const std::string& key, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> append(const std::string& key, const std::string& value);
+  reply_future_t append(const std::string& key, const std::string& value);
 
   client& auth(const std::string& password, const reply_callback_t& reply_callback);
-  std::future<reply> auth(const std::string& password);
+  reply_future_t auth(const std::string& password);
 
   client& bgrewriteaof(const reply_callback_t& reply_callback);
-  std::future<reply> bgrewriteaof();
+  reply_future_t bgrewriteaof();
 
   client& bgsave(const reply_callback_t& reply_callback);
-  std::future<reply> bgsave();
+  reply_future_t bgsave();
 
   client& bitcount(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> bitcount(const std::string& key);
+  reply_future_t bitcount(const std::string& key);
 
   client& bitcount(const std::string& key, int start, int end, const reply_callback_t& reply_callback);
-  std::future<reply> bitcount(const std::string& key, int start, int end);
+  reply_future_t bitcount(const std::string& key, int start, int end);
 
   client& bitfield(const std::string& key, const std::vector<bitfield_operation>& operations,
       const reply_callback_t& reply_callback);
-  std::future<reply> bitfield(const std::string& key, const std::vector<bitfield_operation>& operations);
+  reply_future_t bitfield(const std::string& key, const std::vector<bitfield_operation>& operations);
 
   client& bitop(const std::string& operation, const std::string& destkey, const std::vector<std::string>& keys,
       const reply_callback_t& reply_callback);
-  std::future<reply> bitop(const std::string& operation, const std::string& destkey,
+  reply_future_t bitop(const std::string& operation, const std::string& destkey,
       const std::vector<std::string>& keys);
 
   client& bitpos(const std::string& key, int bit, const reply_callback_t& reply_callback);
-  std::future<reply> bitpos(const std::string& key, int bit);
+  reply_future_t bitpos(const std::string& key, int bit);
 
   client& bitpos(const std::string& key, int bit, int start, const reply_callback_t& reply_callback);
-  std::future<reply> bitpos(const std::string& key, int bit, int start);
+  reply_future_t bitpos(const std::string& key, int bit, int start);
 
   client& bitpos(const std::string& key, int bit, int start, int end, const reply_callback_t& reply_callback);
-  std::future<reply> bitpos(const std::string& key, int bit, int start, int end);
+  reply_future_t bitpos(const std::string& key, int bit, int start, int end);
 
   client& blpop(const std::vector<std::string>& keys, int timeout, const reply_callback_t& reply_callback);
-  std::future<reply> blpop(const std::vector<std::string>& keys, int timeout);
+  reply_future_t blpop(const std::vector<std::string>& keys, int timeout);
 
   client& brpop(const std::vector<std::string>& keys, int timeout, const reply_callback_t& reply_callback);
-  std::future<reply> brpop(const std::vector<std::string>& keys, int timeout);
+  reply_future_t brpop(const std::vector<std::string>& keys, int timeout);
 
   client& brpoplpush(const std::string& src, const std::string& dst, int timeout,
       const reply_callback_t& reply_callback);
-  std::future<reply> brpoplpush(const std::string& src, const std::string& dst, int timeout);
+  reply_future_t brpoplpush(const std::string& src, const std::string& dst, int timeout);
 
   template <typename T, typename... Ts>
   client& client_kill(const std::string& host, int port, const T& arg, const Ts&... args);
@@ -535,183 +863,183 @@ public:
   template <typename T, typename... Ts>
   client& client_kill(const T&, const Ts&...);
   template <typename T, typename... Ts>
-  std::future<reply> client_kill_future(const T, const Ts...);
+  reply_future_t client_kill_future(const T, const Ts...);
 
   client& client_list(const reply_callback_t& reply_callback);
-  std::future<reply> client_list();
+  reply_future_t client_list();
 
   client& client_getname(const reply_callback_t& reply_callback);
-  std::future<reply> client_getname();
+  reply_future_t client_getname();
 
   client& client_pause(int timeout, const reply_callback_t& reply_callback);
-  std::future<reply> client_pause(int timeout);
+  reply_future_t client_pause(int timeout);
 
   client& client_reply(const std::string& mode, const reply_callback_t& reply_callback);
-  std::future<reply> client_reply(const std::string& mode);
+  reply_future_t client_reply(const std::string& mode);
 
   client& client_setname(const std::string& name, const reply_callback_t& reply_callback);
-  std::future<reply> client_setname(const std::string& name);
+  reply_future_t client_setname(const std::string& name);
 
   client& cluster_addslots(const std::vector<std::string>& p_slots, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_addslots(const std::vector<std::string>& p_slots);
+  reply_future_t cluster_addslots(const std::vector<std::string>& p_slots);
 
   client& cluster_count_failure_reports(const std::string& node_id, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_count_failure_reports(const std::string& node_id);
+  reply_future_t cluster_count_failure_reports(const std::string& node_id);
 
   client& cluster_countkeysinslot(const std::string& slot, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_countkeysinslot(const std::string& slot);
+  reply_future_t cluster_countkeysinslot(const std::string& slot);
 
   client& cluster_delslots(const std::vector<std::string>& p_slots, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_delslots(const std::vector<std::string>& p_slots);
+  reply_future_t cluster_delslots(const std::vector<std::string>& p_slots);
 
   client& cluster_failover(const reply_callback_t& reply_callback);
-  std::future<reply> cluster_failover();
+  reply_future_t cluster_failover();
 
   client& cluster_failover(const std::string& mode, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_failover(const std::string& mode);
+  reply_future_t cluster_failover(const std::string& mode);
 
   client& cluster_forget(const std::string& node_id, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_forget(const std::string& node_id);
+  reply_future_t cluster_forget(const std::string& node_id);
 
   client& cluster_getkeysinslot(const std::string& slot, int count, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_getkeysinslot(const std::string& slot, int count);
+  reply_future_t cluster_getkeysinslot(const std::string& slot, int count);
 
   client& cluster_info(const reply_callback_t& reply_callback);
-  std::future<reply> cluster_info();
+  reply_future_t cluster_info();
 
   client& cluster_keyslot(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_keyslot(const std::string& key);
+  reply_future_t cluster_keyslot(const std::string& key);
 
   client& cluster_meet(const std::string& ip, int port, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_meet(const std::string& ip, int port);
+  reply_future_t cluster_meet(const std::string& ip, int port);
 
   client& cluster_nodes(const reply_callback_t& reply_callback);
-  std::future<reply> cluster_nodes();
+  reply_future_t cluster_nodes();
 
   client& cluster_replicate(const std::string& node_id, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_replicate(const std::string& node_id);
+  reply_future_t cluster_replicate(const std::string& node_id);
 
   client& cluster_reset(const reply_callback_t& reply_callback);
   client& cluster_reset(const std::string& mode, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_reset(const std::string& mode = "soft");
+  reply_future_t cluster_reset(const std::string& mode = "soft");
 
   client& cluster_saveconfig(const reply_callback_t& reply_callback);
-  std::future<reply> cluster_saveconfig();
+  reply_future_t cluster_saveconfig();
 
   client& cluster_set_config_epoch(const std::string& epoch, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_set_config_epoch(const std::string& epoch);
+  reply_future_t cluster_set_config_epoch(const std::string& epoch);
 
   client& cluster_setslot(const std::string& slot, const std::string& mode, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_setslot(const std::string& slot, const std::string& mode);
+  reply_future_t cluster_setslot(const std::string& slot, const std::string& mode);
 
   client& cluster_setslot(const std::string& slot, const std::string& mode, const std::string& node_id,
       const reply_callback_t& reply_callback);
-  std::future<reply> cluster_setslot(const std::string& slot, const std::string& mode, const std::string& node_id);
+  reply_future_t cluster_setslot(const std::string& slot, const std::string& mode, const std::string& node_id);
 
   client& cluster_slaves(const std::string& node_id, const reply_callback_t& reply_callback);
-  std::future<reply> cluster_slaves(const std::string& node_id);
+  reply_future_t cluster_slaves(const std::string& node_id);
 
   client& cluster_slots(const reply_callback_t& reply_callback);
-  std::future<reply> cluster_slots();
+  reply_future_t cluster_slots();
 
   client& command(const reply_callback_t& reply_callback);
-  std::future<reply> command();
+  reply_future_t command();
 
   client& command_count(const reply_callback_t& reply_callback);
-  std::future<reply> command_count();
+  reply_future_t command_count();
 
   client& command_getkeys(const reply_callback_t& reply_callback);
-  std::future<reply> command_getkeys();
+  reply_future_t command_getkeys();
 
   client& command_info(const std::vector<std::string>& command_name, const reply_callback_t& reply_callback);
-  std::future<reply> command_info(const std::vector<std::string>& command_name);
+  reply_future_t command_info(const std::vector<std::string>& command_name);
 
   client& config_get(const std::string& param, const reply_callback_t& reply_callback);
-  std::future<reply> config_get(const std::string& param);
+  reply_future_t config_get(const std::string& param);
 
   client& config_rewrite(const reply_callback_t& reply_callback);
-  std::future<reply> config_rewrite();
+  reply_future_t config_rewrite();
 
   client& config_set(const std::string& param, const std::string& val, const reply_callback_t& reply_callback);
-  std::future<reply> config_set(const std::string& param, const std::string& val);
+  reply_future_t config_set(const std::string& param, const std::string& val);
 
   client& config_resetstat(const reply_callback_t& reply_callback);
-  std::future<reply> config_resetstat();
+  reply_future_t config_resetstat();
 
   client& dbsize(const reply_callback_t& reply_callback);
-  std::future<reply> dbsize();
+  reply_future_t dbsize();
 
   client& debug_object(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> debug_object(const std::string& key);
+  reply_future_t debug_object(const std::string& key);
 
   client& debug_segfault(const reply_callback_t& reply_callback);
-  std::future<reply> debug_segfault();
+  reply_future_t debug_segfault();
 
   client& decr(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> decr(const std::string& key);
+  reply_future_t decr(const std::string& key);
 
   client& decrby(const std::string& key, int val, const reply_callback_t& reply_callback);
-  std::future<reply> decrby(const std::string& key, int val);
+  reply_future_t decrby(const std::string& key, int val);
 
   client& del(const std::vector<std::string>& key, const reply_callback_t& reply_callback);
-  std::future<reply> del(const std::vector<std::string>& key);
+  reply_future_t del(const std::vector<std::string>& key);
 
   client& discard(const reply_callback_t& reply_callback);
-  std::future<reply> discard();
+  reply_future_t discard();
 
   client& dump(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> dump(const std::string& key);
+  reply_future_t dump(const std::string& key);
 
   client& echo(const std::string& msg, const reply_callback_t& reply_callback);
-  std::future<reply> echo(const std::string& msg);
+  reply_future_t echo(const std::string& msg);
 
   client& eval(const std::string& script, int numkeys, const std::vector<std::string>& keys,
       const std::vector<std::string>& args, const reply_callback_t& reply_callback);
-  std::future<reply> eval(const std::string& script, int numkeys, const std::vector<std::string>& keys,
+  reply_future_t eval(const std::string& script, int numkeys, const std::vector<std::string>& keys,
       const std::vector<std::string>& args);
 
   client& evalsha(const std::string& sha1, int numkeys, const std::vector<std::string>& keys,
       const std::vector<std::string>& args, const reply_callback_t& reply_callback);
-  std::future<reply> evalsha(const std::string& sha1, int numkeys, const std::vector<std::string>& keys,
+  reply_future_t evalsha(const std::string& sha1, int numkeys, const std::vector<std::string>& keys,
       const std::vector<std::string>& args);
 
   client& exec(const reply_callback_t& reply_callback);
-  std::future<reply> exec();
+  reply_future_t exec();
 
   client& exists(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> exists(const std::vector<std::string>& keys);
+  reply_future_t exists(const std::vector<std::string>& keys);
 
   client& expire(const std::string& key, int seconds, const reply_callback_t& reply_callback);
-  std::future<reply> expire(const std::string& key, int seconds);
+  reply_future_t expire(const std::string& key, int seconds);
 
   client& expireat(const std::string& key, int timestamp, const reply_callback_t& reply_callback);
-  std::future<reply> expireat(const std::string& key, int timestamp);
+  reply_future_t expireat(const std::string& key, int timestamp);
 
   client& flushall(const reply_callback_t& reply_callback);
-  std::future<reply> flushall();
+  reply_future_t flushall();
 
   client& flushdb(const reply_callback_t& reply_callback);
-  std::future<reply> flushdb();
+  reply_future_t flushdb();
 
   client& geoadd(const std::string& key,
       const std::vector<std::tuple<std::string, std::string, std::string>>& long_lat_memb,
       const reply_callback_t& reply_callback);
-  std::future<reply> geoadd(const std::string& key,
+  reply_future_t geoadd(const std::string& key,
       const std::vector<std::tuple<std::string, std::string, std::string>>& long_lat_memb);
 
   client& geohash(const std::string& key, const std::vector<std::string>& members,
       const reply_callback_t& reply_callback);
-  std::future<reply> geohash(const std::string& key, const std::vector<std::string>& members);
+  reply_future_t geohash(const std::string& key, const std::vector<std::string>& members);
 
   client& geopos(const std::string& key, const std::vector<std::string>& members,
       const reply_callback_t& reply_callback);
-  std::future<reply> geopos(const std::string& key, const std::vector<std::string>& members);
+  reply_future_t geopos(const std::string& key, const std::vector<std::string>& members);
 
   client& geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
       const reply_callback_t& reply_callback);
   client& geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
       const std::string& unit, const reply_callback_t& reply_callback);
-  std::future<reply> geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
+  reply_future_t geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
       const std::string& unit = "m");
 
   client& georadius(const std::string& key, double longitude, double latitude, double radius, geo_unit unit,
@@ -731,7 +1059,7 @@ public:
   client& georadius(const std::string& key, double longitude, double latitude, double radius, geo_unit unit,
       bool with_coord, bool with_dist, bool with_hash, bool asc_order, std::size_t count, const std::string& store_key,
       const std::string& storedist_key, const reply_callback_t& reply_callback);
-  std::future<reply> georadius(const std::string& key, double longitude, double latitude, double radius, geo_unit unit,
+  reply_future_t georadius(const std::string& key, double longitude, double latitude, double radius, geo_unit unit,
       bool with_coord = false, bool with_dist = false, bool with_hash = false, bool asc_order = false,
       std::size_t count = 0, const std::string& store_key = "", const std::string& storedist_key = "");
 
@@ -752,753 +1080,802 @@ public:
   client& georadiusbymember(const std::string& key, const std::string& member, double radius, geo_unit unit,
       bool with_coord, bool with_dist, bool with_hash, bool asc_order, std::size_t count, const std::string& store_key,
       const std::string& storedist_key, const reply_callback_t& reply_callback);
-  std::future<reply> georadiusbymember(const std::string& key, const std::string& member, double radius, geo_unit unit,
+  reply_future_t georadiusbymember(const std::string& key, const std::string& member, double radius, geo_unit unit,
       bool with_coord = false, bool with_dist = false, bool with_hash = false, bool asc_order = false,
       std::size_t count = 0, const std::string& store_key = "", const std::string& storedist_key = "");
 
   client& get(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> get(const std::string& key);
+  reply_future_t get(const std::string& key);
 
   client& getbit(const std::string& key, int offset, const reply_callback_t& reply_callback);
-  std::future<reply> getbit(const std::string& key, int offset);
+  reply_future_t getbit(const std::string& key, int offset);
 
   client& getrange(const std::string& key, int start, int end, const reply_callback_t& reply_callback);
-  std::future<reply> getrange(const std::string& key, int start, int end);
+  reply_future_t getrange(const std::string& key, int start, int end);
 
   client& getset(const std::string& key, const std::string& val, const reply_callback_t& reply_callback);
-  std::future<reply> getset(const std::string& key, const std::string& val);
+  reply_future_t getset(const std::string& key, const std::string& val);
 
   client& hdel(const std::string& key, const std::vector<std::string>& fields, const reply_callback_t& reply_callback);
-  std::future<reply> hdel(const std::string& key, const std::vector<std::string>& fields);
+  reply_future_t hdel(const std::string& key, const std::vector<std::string>& fields);
 
   client& hexists(const std::string& key, const std::string& field, const reply_callback_t& reply_callback);
-  std::future<reply> hexists(const std::string& key, const std::string& field);
+  reply_future_t hexists(const std::string& key, const std::string& field);
 
   client& hget(const std::string& key, const std::string& field, const reply_callback_t& reply_callback);
-  std::future<reply> hget(const std::string& key, const std::string& field);
+  reply_future_t hget(const std::string& key, const std::string& field);
 
   client& hgetall(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> hgetall(const std::string& key);
+  reply_future_t hgetall(const std::string& key);
 
   client& hincrby(const std::string& key, const std::string& field, int incr, const reply_callback_t& reply_callback);
-  std::future<reply> hincrby(const std::string& key, const std::string& field, int incr);
+  reply_future_t hincrby(const std::string& key, const std::string& field, int incr);
 
   client& hincrbyfloat(const std::string& key, const std::string& field, float incr,
       const reply_callback_t& reply_callback);
-  std::future<reply> hincrbyfloat(const std::string& key, const std::string& field, float incr);
+  reply_future_t hincrbyfloat(const std::string& key, const std::string& field, float incr);
 
   client& hkeys(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> hkeys(const std::string& key);
+  reply_future_t hkeys(const std::string& key);
 
   client& hlen(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> hlen(const std::string& key);
+  reply_future_t hlen(const std::string& key);
 
   client& hmget(const std::string& key, const std::vector<std::string>& fields,
       const reply_callback_t& reply_callback);
-  std::future<reply> hmget(const std::string& key, const std::vector<std::string>& fields);
+  reply_future_t hmget(const std::string& key, const std::vector<std::string>& fields);
 
   client& hmset(const std::string& key, const std::vector<std::pair<std::string, std::string>>& field_val,
       const reply_callback_t& reply_callback);
-  std::future<reply> hmset(const std::string& key, const std::vector<std::pair<std::string, std::string>>& field_val);
+  reply_future_t hmset(const std::string& key, const std::vector<std::pair<std::string, std::string>>& field_val);
+
+  //! range overload: the elements are encoded as they are iterated, in commands of at most the limits given to
+  //! set_bulk_split_limits, and the callback receives the replies of these commands merged into one
+  template <typename InputIt>
+  client& hmset(const std::string& key, InputIt first, InputIt last, const reply_callback_t& reply_callback);
+  template <typename InputIt>
+  reply_future_t hmset(const std::string& key, InputIt first, InputIt last);
 
   client& hscan(const std::string& key, std::size_t cursor, const reply_callback_t& reply_callback);
-  std::future<reply> hscan(const std::string& key, std::size_t cursor);
+  reply_future_t hscan(const std::string& key, std::size_t cursor);
 
   client& hscan(const std::string& key, std::size_t cursor, const std::string& pattern,
       const reply_callback_t& reply_callback);
-  std::future<reply> hscan(const std::string& key, std::size_t cursor, const std::string& pattern);
+  reply_future_t hscan(const std::string& key, std::size_t cursor, const std::string& pattern);
 
   client& hscan(const std::string& key, std::size_t cursor, std::size_t count, const reply_callback_t& reply_callback);
-  std::future<reply> hscan(const std::string& key, std::size_t cursor, std::size_t count);
+  reply_future_t hscan(const std::string& key, std::size_t cursor, std::size_t count);
 
   client& hscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count,
       const reply_callback_t& reply_callback);
-  std::future<reply> hscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count);
+  reply_future_t hscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count);
 
   client& hset(const std::string& key, const std::string& field, const std::string& value,
       const reply_callback_t& reply_callback);
-  std::future<reply> hset(const std::string& key, const std::string& field, const std::string& value);
+  reply_future_t hset(const std::string& key, const std::string& field, const std::string& value);
+
+  client& hset(const std::string& key, const std::string& field, const shared_value_t& value,
+      const reply_callback_t& reply_callback);
+  reply_future_t hset(const std::string& key, const std::string& field, const shared_value_t& value);
 
   client& hsetnx(const std::string& key, const std::string& field, const std::string& value,
       const reply_callback_t& reply_callback);
-  std::future<reply> hsetnx(const std::string& key, const std::string& field, const std::string& value);
+  reply_future_t hsetnx(const std::string& key, const std::string& field, const std::string& value);
 
   client& hstrlen(const std::string& key, const std::string& field, const reply_callback_t& reply_callback);
-  std::future<reply> hstrlen(const std::string& key, const std::string& field);
+  reply_future_t hstrlen(const std::string& key, const std::string& field);
 
   client& hvals(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> hvals(const std::string& key);
+  reply_future_t hvals(const std::string& key);
 
   client& incr(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> incr(const std::string& key);
+  reply_future_t incr(const std::string& key);
 
   client& incrby(const std::string& key, int incr, const reply_callback_t& reply_callback);
-  std::future<reply> incrby(const std::string& key, int incr);
+  reply_future_t incrby(const std::string& key, int incr);
 
   client& incrbyfloat(const std::string& key, float incr, const reply_callback_t& reply_callback);
-  std::future<reply> incrbyfloat(const std::string& key, float incr);
+  reply_future_t incrbyfloat(const std::string& key, float incr);
 
   client& info(const reply_callback_t& reply_callback);
   client& info(const std::string& section, const reply_callback_t& reply_callback);
-  std::future<reply> info(const std::string& section = "default");
+  reply_future_t info(const std::string& section = "default");
 
   client& keys(const std::string& pattern, const reply_callback_t& reply_callback);
-  std::future<reply> keys(const std::string& pattern);
+  reply_future_t keys(const std::string& pattern);
 
   client& lastsave(const reply_callback_t& reply_callback);
-  std::future<reply> lastsave();
+  reply_future_t lastsave();
 
   client& lindex(const std::string& key, int index, const reply_callback_t& reply_callback);
-  std::future<reply> lindex(const std::string& key, int index);
+  reply_future_t lindex(const std::string& key, int index);
 
   client& linsert(const std::string& key, const std::string& before_after, const std::string& pivot,
       const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> linsert(const std::string& key, const std::string& before_after, const std::string& pivot,
+  reply_future_t linsert(const std::string& key, const std::string& before_after, const std::string& pivot,
       const std::string& value);
 
   client& llen(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> llen(const std::string& key);
+  reply_future_t llen(const std::string& key);
 
   client& lpop(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> lpop(const std::string& key);
+  reply_future_t lpop(const std::string& key);
 
   client& lpush(const std::string& key, const std::vector<std::string>& values,
       const reply_callback_t& reply_callback);
-  std::future<reply> lpush(const std::string& key, const std::vector<std::string>& values);
+  reply_future_t lpush(const std::string& key, const std::vector<std::string>& values);
 
   client& lpushx(const std::string& key, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> lpushx(const std::string& key, const std::string& value);
+  reply_future_t lpushx(const std::string& key, const std::string& value);
 
   client& lrange(const std::string& key, int start, int stop, const reply_callback_t& reply_callback);
-  std::future<reply> lrange(const std::string& key, int start, int stop);
+  reply_future_t lrange(const std::string& key, int start, int stop);
 
   client& lrem(const std::string& key, int count, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> lrem(const std::string& key, int count, const std::string& value);
+  reply_future_t lrem(const std::string& key, int count, const std::string& value);
 
   client& lset(const std::string& key, int index, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> lset(const std::string& key, int index, const std::string& value);
+  reply_future_t lset(const std::string& key, int index, const std::string& value);
 
   client& ltrim(const std::string& key, int start, int stop, const reply_callback_t& reply_callback);
-  std::future<reply> ltrim(const std::string& key, int start, int stop);
+  reply_future_t ltrim(const std::string& key, int start, int stop);
 
   client& mget(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> mget(const std::vector<std::string>& keys);
+  reply_future_t mget(const std::vector<std::string>& keys);
 
   client& migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db, int timeout,
       const reply_callback_t& reply_callback);
   client& migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db, int timeout,
       bool copy, bool replace, const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db,
+  reply_future_t migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db,
       int timeout, bool copy = false, bool replace = false, const std::vector<std::string>& keys = {});
 
   client& monitor(const reply_callback_t& reply_callback);
-  std::future<reply> monitor();
+  reply_future_t monitor();
 
   client& move(const std::string& key, const std::string& db, const reply_callback_t& reply_callback);
-  std::future<reply> move(const std::string& key, const std::string& db);
+  reply_future_t move(const std::string& key, const std::string& db);
 
   client& mset(const std::vector<std::pair<std::string, std::string>>& key_vals,
       const reply_callback_t& reply_callback);
-  std::future<reply> mset(const std::vector<std::pair<std::string, std::string>>& key_vals);
+  reply_future_t mset(const std::vector<std::pair<std::string, std::string>>& key_vals);
+
+  //! range overload: the elements are encoded as they are iterated, in commands of at most the limits given to
+  //! set_bulk_split_limits, and the callback receives the replies of these commands merged into one
+  template <typename InputIt>
+  client& mset(InputIt first, InputIt last, const reply_callback_t& reply_callback);
+  template <typename InputIt>
+  reply_future_t mset(InputIt first, InputIt last);
 
   client& msetnx(const std::vector<std::pair<std::string, std::string>>& key_vals,
       const reply_callback_t& reply_callback);
-  std::future<reply> msetnx(const std::vector<std::pair<std::string, std::string>>& key_vals);
+  reply_future_t msetnx(const std::vector<std::pair<std::string, std::string>>& key_vals);
 
   client& multi(const reply_callback_t& reply_callback);
-  std::future<reply> multi();
+  reply_future_t multi();
 
   client& object(const std::string& subcommand, const std::vector<std::string>& args,
       const reply_callback_t& reply_callback);
-  std::future<reply> object(const std::string& subcommand, const std::vector<std::string>& args);
+  reply_future_t object(const std::string& subcommand, const std::vector<std::string>& args);
 
   client& persist(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> persist(const std::string& key);
+  reply_future_t persist(const std::string& key);
 
   client& pexpire(const std::string& key, int milliseconds, const reply_callback_t& reply_callback);
-  std::future<reply> pexpire(const std::string& key, int milliseconds);
+  reply_future_t pexpire(const std::string& key, int milliseconds);
 
   client& pexpireat(const std::string& key, int milliseconds_timestamp, const reply_callback_t& reply_callback);
-  std::future<reply> pexpireat(const std::string& key, int milliseconds_timestamp);
+  reply_future_t pexpireat(const std::string& key, int milliseconds_timestamp);
 
   client& pfadd(const std::string& key, const std::vector<std::string>& elements,
       const reply_callback_t& reply_callback);
-  std::future<reply> pfadd(const std::string& key, const std::vector<std::string>& elements);
+  reply_future_t pfadd(const std::string& key, const std::vector<std::string>& elements);
+
+  //! range overload: the elements are encoded as they are iterated, in commands of at most the limits given to
+  //! set_bulk_split_limits, and the callback receives the replies of these commands merged into one
+  template <typename InputIt>
+  client& pfadd(const std::string& key, InputIt first, InputIt last, const reply_callback_t& reply_callback);
+  template <typename InputIt>
+  reply_future_t pfadd(const std::string& key, InputIt first, InputIt last);
 
   client& pfcount(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> pfcount(const std::vector<std::string>& keys);
+  reply_future_t pfcount(const std::vector<std::string>& keys);
 
   client& pfmerge(const std::string& destkey, const std::vector<std::string>& sourcekeys,
       const reply_callback_t& reply_callback);
-  std::future<reply> pfmerge(const std::string& destkey, const std::vector<std::string>& sourcekeys);
+  reply_future_t pfmerge(const std::string& destkey, const std::vector<std::string>& sourcekeys);
 
   client& ping(const reply_callback_t& reply_callback);
-  std::future<reply> ping();
+  reply_future_t ping();
 
   client& ping(const std::string& message, const reply_callback_t& reply_callback);
-  std::future<reply> ping(const std::string& message);
+  reply_future_t ping(const std::string& message);
 
   client& psetex(const std::string& key, int milliseconds, const std::string& val,
       const reply_callback_t& reply_callback);
-  std::future<reply> psetex(const std::string& key, int milliseconds, const std::string& val);
+  reply_future_t psetex(const std::string& key, int milliseconds, const std::string& val);
 
   client& publish(const std::string& channel, const std::string& message,
       const reply_callback_t& reply_callback);
-  std::future<reply> publish(const std::string& channel, const std::string& message);
+  reply_future_t publish(const std::string& channel, const std::string& message);
 
   client& pubsub(const std::string& subcommand, const std::vector<std::string>& args,
       const reply_callback_t& reply_callback);
-  std::future<reply> pubsub(const std::string& subcommand, const std::vector<std::string>& args);
+  reply_future_t pubsub(const std::string& subcommand, const std::vector<std::string>& args);
 
   client& pttl(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> pttl(const std::string& key);
+  reply_future_t pttl(const std::string& key);
 
   client& quit(const reply_callback_t& reply_callback);
-  std::future<reply> quit();
+  reply_future_t quit();
 
   client& randomkey(const reply_callback_t& reply_callback);
-  std::future<reply> randomkey();
+  reply_future_t randomkey();
 
   client& readonly(const reply_callback_t& reply_callback);
-  std::future<reply> readonly();
+  reply_future_t readonly();
 
   client& readwrite(const reply_callback_t& reply_callback);
-  std::future<reply> readwrite();
+  reply_future_t readwrite();
 
   client& rename(const std::string& key, const std::string& newkey, const reply_callback_t& reply_callback);
-  std::future<reply> rename(const std::string& key, const std::string& newkey);
+  reply_future_t rename(const std::string& key, const std::string& newkey);
 
   client& renamenx(const std::string& key, const std::string& newkey, const reply_callback_t& reply_callback);
-  std::future<reply> renamenx(const std::string& key, const std::string& newkey);
+  reply_future_t renamenx(const std::string& key, const std::string& newkey);
 
   client& restore(const std::string& key, int ttl, const std::string& serialized_value,
       const reply_callback_t& reply_callback);
-  std::future<reply> restore(const std::string& key, int ttl, const std::string& serialized_value);
+  reply_future_t restore(const std::string& key, int ttl, const std::string& serialized_value);
+
+  client& restore(const std::string& key, int ttl, const shared_value_t& serialized_value,
+      const reply_callback_t& reply_callback);
+  reply_future_t restore(const std::string& key, int ttl, const shared_value_t& serialized_value);
 
   client& restore(const std::string& key, int ttl, const std::string& serialized_value,
       const std::string& replace, const reply_callback_t& reply_callback);
-  std::future<reply> restore(const std::string& key, int ttl, const std::string& serialized_value,
+  reply_future_t restore(const std::string& key, int ttl, const std::string& serialized_value,
       const std::string& replace);
 
   client& role(const reply_callback_t& reply_callback);
-  std::future<reply> role();
+  reply_future_t role();
 
   client& rpop(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> rpop(const std::string& key);
+  reply_future_t rpop(const std::string& key);
 
   client& rpoplpush(const std::string& source, const std::string& destination, const reply_callback_t& reply_callback);
-  std::future<reply> rpoplpush(const std::string& src, const std::string& dst);
+  reply_future_t rpoplpush(const std::string& src, const std::string& dst);
 
   client& rpush(const std::string& key, const std::vector<std::string>& values,
       const reply_callback_t& reply_callback);
-  std::future<reply> rpush(const std::string& key, const std::vector<std::string>& values);
+  reply_future_t rpush(const std::string& key, const std::vector<std::string>& values);
 
   client& rpushx(const std::string& key, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> rpushx(const std::string& key, const std::string& value);
+  reply_future_t rpushx(const std::string& key, const std::string& value);
 
   client& sadd(const std::string& key, const std::vector<std::string>& members,
       const reply_callback_t& reply_callback);
-  std::future<reply> sadd(const std::string& key, const std::vector<std::string>& members);
+  reply_future_t sadd(const std::string& key, const std::vector<std::string>& members);
+
+  //! range overload: the elements are encoded as they are iterated, in commands of at most the limits given to
+  //! set_bulk_split_limits, and the callback receives the replies of these commands merged into one
+  template <typename InputIt>
+  client& sadd(const std::string& key, InputIt first, InputIt last, const reply_callback_t& reply_callback);
+  template <typename InputIt>
+  reply_future_t sadd(const std::string& key, InputIt first, InputIt last);
 
   client& save(const reply_callback_t& reply_callback);
-  std::future<reply> save();
+  reply_future_t save();
 
   client& scan(std::size_t cursor, const reply_callback_t& reply_callback);
-  std::future<reply> scan(std::size_t cursor);
+  reply_future_t scan(std::size_t cursor);
 
   client& scan(std::size_t cursor, const std::string& pattern, const reply_callback_t& reply_callback);
-  std::future<reply> scan(std::size_t cursor, const std::string& pattern);
+  reply_future_t scan(std::size_t cursor, const std::string& pattern);
 
   client& scan(std::size_t cursor, std::size_t count, const reply_callback_t& reply_callback);
-  std::future<reply> scan(std::size_t cursor, std::size_t count);
+  reply_future_t scan(std::size_t cursor, std::size_t count);
 
   client& scan(std::size_t cursor, const std::string& pattern, std::size_t count,
       const reply_callback_t& reply_callback);
-  std::future<reply> scan(std::size_t cursor, const std::string& pattern, std::size_t count);
+  reply_future_t scan(std::size_t cursor, const std::string& pattern, std::size_t count);
 
   client& scard(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> scard(const std::string& key);
+  reply_future_t scard(const std::string& key);
 
   client& script_debug(const std::string& mode, const reply_callback_t& reply_callback);
-  std::future<reply> script_debug(const std::string& mode);
+  reply_future_t script_debug(const std::string& mode);
 
   client& script_exists(const std::vector<std::string>& scripts, const reply_callback_t& reply_callback);
-  std::future<reply> script_exists(const std::vector<std::string>& scripts);
+  reply_future_t script_exists(const std::vector<std::string>& scripts);
 
   client& script_flush(const reply_callback_t& reply_callback);
-  std::future<reply> script_flush();
+  reply_future_t script_flush();
 
   client& script_kill(const reply_callback_t& reply_callback);
-  std::future<reply> script_kill();
+  reply_future_t script_kill();
 
   client& script_load(const std::string& script, const reply_callback_t& reply_callback);
-  std::future<reply> script_load(const std::string& script);
+  reply_future_t script_load(const std::string& script);
 
   client& sdiff(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> sdiff(const std::vector<std::string>& keys);
+  reply_future_t sdiff(const std::vector<std::string>& keys);
 
   client& sdiffstore(const std::string& destination, const std::vector<std::string>& keys,
       const reply_callback_t& reply_callback);
-  std::future<reply> sdiffstore(const std::string& dst, const std::vector<std::string>& keys);
+  reply_future_t sdiffstore(const std::string& dst, const std::vector<std::string>& keys);
 
   client& select(int index, const reply_callback_t& reply_callback);
-  std::future<reply> select(int index);
+  reply_future_t select(int index);
 
   client& set(const std::string& key, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> set(const std::string& key, const std::string& value);
+  reply_future_t set(const std::string& key, const std::string& value);
+
+  client& set(const std::string& key, const shared_value_t& value, const reply_callback_t& reply_callback);
+  reply_future_t set(const std::string& key, const shared_value_t& value);
 
   client& set_advanced(const std::string& key, const std::string& value, const reply_callback_t& reply_callback);
   client& set_advanced(const std::string& key, const std::string& value, bool ex, int ex_sec, bool px, int px_milli,
       bool nx, bool xx, const reply_callback_t& reply_callback);
-  std::future<reply> set_advanced(const std::string& key, const std::string& value, bool ex = false, int ex_sec = 0,
+  reply_future_t set_advanced(const std::string& key, const std::string& value, bool ex = false, int ex_sec = 0,
       bool px = false, int px_milli = 0, bool nx = false, bool xx = false);
 
   client& setbit_(const std::string& key, int offset, const std::string& value,
       const reply_callback_t& reply_callback);
-  std::future<reply> setbit_(const std::string& key, int offset, const std::string& value);
+  reply_future_t setbit_(const std::string& key, int offset, const std::string& value);
 
   client& setex(const std::string& key, int seconds, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> setex(const std::string& key, int seconds, const std::string& value);
+  reply_future_t setex(const std::string& key, int seconds, const std::string& value);
 
   client& setnx(const std::string& key, const std::string& value, const reply_callback_t& reply_callback);
-  std::future<reply> setnx(const std::string& key, const std::string& value);
+  reply_future_t setnx(const std::string& key, const std::string& value);
 
   client& setrange(const std::string& key, int offset, const std::string& value,
       const reply_callback_t& reply_callback);
-  std::future<reply> setrange(const std::string& key, int offset, const std::string& value);
+  reply_future_t setrange(const std::string& key, int offset, const std::string& value);
 
   client& shutdown(const reply_callback_t& reply_callback);
-  std::future<reply> shutdown();
+  reply_future_t shutdown();
 
   client& shutdown(const std::string& save, const reply_callback_t& reply_callback);
-  std::future<reply> shutdown(const std::string& save);
+  reply_future_t shutdown(const std::string& save);
 
   client& sinter(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> sinter(const std::vector<std::string>& keys);
+  reply_future_t sinter(const std::vector<std::string>& keys);
 
   client& sinterstore(const std::string& destination, const std::vector<std::string>& keys,
       const reply_callback_t& reply_callback);
-  std::future<reply> sinterstore(const std::string& dst, const std::vector<std::string>& keys);
+  reply_future_t sinterstore(const std::string& dst, const std::vector<std::string>& keys);
 
   client& sismember(const std::string& key, const std::string& member,
       const reply_callback_t& reply_callback);
-  std::future<reply> sismember(const std::string& key, const std::string& member);
+  reply_future_t sismember(const std::string& key, const std::string& member);
 
   client& slaveof(const std::string& host, int port, const reply_callback_t& reply_callback);
-  std::future<reply> slaveof(const std::string& host, int port);
+  reply_future_t slaveof(const std::string& host, int port);
 
   client& slowlog(const std::string subcommand, const reply_callback_t& reply_callback);
-  std::future<reply> slowlog(const std::string& subcommand);
+  reply_future_t slowlog(const std::string& subcommand);
 
   client& slowlog(const std::string subcommand, const std::string& argument,
       const reply_callback_t& reply_callback);
-  std::future<reply> slowlog(const std::string& subcommand, const std::string& argument);
+  reply_future_t slowlog(const std::string& subcommand, const std::string& argument);
 
   client& smembers(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> smembers(const std::string& key);
+  reply_future_t smembers(const std::string& key);
 
   client& smove(const std::string& source, const std::string& destination, const std::string& member,
       const reply_callback_t& reply_callback);
-  std::future<reply> smove(const std::string& src, const std::string& dst, const std::string& member);
+  reply_future_t smove(const std::string& src, const std::string& dst, const std::string& member);
 
   client& sort(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key);
+  reply_future_t sort(const std::string& key);
 
   client& sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order, bool alpha,
       const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order,
+  reply_future_t sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order,
       bool alpha);
 
   client& sort(const std::string& key, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha,
       const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, std::size_t offset, std::size_t count,
+  reply_future_t sort(const std::string& key, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha);
 
   client& sort(const std::string& key, const std::string& by_pattern, const std::vector<std::string>& get_patterns,
       bool asc_order, bool alpha, const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, const std::string& by_pattern,
+  reply_future_t sort(const std::string& key, const std::string& by_pattern,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha);
 
   client& sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order, bool alpha,
       const std::string& store_dest, const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order,
+  reply_future_t sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order,
       bool alpha, const std::string& store_dest);
 
   client& sort(const std::string& key, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest,
       const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, std::size_t offset, std::size_t count,
+  reply_future_t sort(const std::string& key, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest);
 
   client& sort(const std::string& key, const std::string& by_pattern, const std::vector<std::string>& get_patterns,
       bool asc_order, bool alpha, const std::string& store_dest, const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, const std::string& by_pattern,
+  reply_future_t sort(const std::string& key, const std::string& by_pattern,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest);
 
   client& sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha,
       const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
+  reply_future_t sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha);
 
   client& sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest,
       const reply_callback_t& reply_callback);
-  std::future<reply> sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
+  reply_future_t sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
       const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest);
 
   client& spop(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> spop(const std::string& key);
+  reply_future_t spop(const std::string& key);
 
   client& spop(const std::string& key, int count, const reply_callback_t& reply_callback);
-  std::future<reply> spop(const std::string& key, int count);
+  reply_future_t spop(const std::string& key, int count);
 
   client& srandmember(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> srandmember(const std::string& key);
+  reply_future_t srandmember(const std::string& key);
 
   client& srandmember(const std::string& key, int count, const reply_callback_t& reply_callback);
-  std::future<reply> srandmember(const std::string& key, int count);
+  reply_future_t srandmember(const std::string& key, int count);
 
   client& srem(const std::string& key, const std::vector<std::string>& members,
       const reply_callback_t& reply_callback);
-  std::future<reply> srem(const std::string& key, const std::vector<std::string>& members);
+  reply_future_t srem(const std::string& key, const std::vector<std::string>& members);
 
   client& sscan(const std::string& key, std::size_t cursor, const reply_callback_t& reply_callback);
-  std::future<reply> sscan(const std::string& key, std::size_t cursor);
+  reply_future_t sscan(const std::string& key, std::size_t cursor);
 
   client& sscan(const std::string& key, std::size_t cursor, const std::string& pattern,
       const reply_callback_t& reply_callback);
-  std::future<reply> sscan(const std::string& key, std::size_t cursor, const std::string& pattern);
+  reply_future_t sscan(const std::string& key, std::size_t cursor, const std::string& pattern);
 
   client& sscan(const std::string& key, std::size_t cursor, std::size_t count, const reply_callback_t& reply_callback);
-  std::future<reply> sscan(const std::string& key, std::size_t cursor, std::size_t count);
+  reply_future_t sscan(const std::string& key, std::size_t cursor, std::size_t count);
 
   client& sscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count,
       const reply_callback_t& reply_callback);
-  std::future<reply> sscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count);
+  reply_future_t sscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count);
 
   client& strlen(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> strlen(const std::string& key);
+  reply_future_t strlen(const std::string& key);
 
   client& sunion(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> sunion(const std::vector<std::string>& keys);
+  reply_future_t sunion(const std::vector<std::string>& keys);
 
   client& sunionstore(const std::string& destination, const std::vector<std::string>& keys,
       const reply_callback_t& reply_callback);
-  std::future<reply> sunionstore(const std::string& dst, const std::vector<std::string>& keys);
+  reply_future_t sunionstore(const std::string& dst, const std::vector<std::string>& keys);
 
   client& sync(const reply_callback_t& reply_callback);
-  std::future<reply> sync();
+  reply_future_t sync();
 
   client& time(const reply_callback_t& reply_callback);
-  std::future<reply> time();
+  reply_future_t time();
 
   client& ttl(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> ttl(const std::string& key);
+  reply_future_t ttl(const std::string& key);
 
   client& type(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> type(const std::string& key);
+  reply_future_t type(const std::string& key);
 
   client& unwatch(const reply_callback_t& reply_callback);
-  std::future<reply> unwatch();
+  reply_future_t unwatch();
 
   client& wait(int numslaves, int timeout, const reply_callback_t& reply_callback);
-  std::future<reply> wait(int numslaves, int timeout);
+  reply_future_t wait(int numslaves, int timeout);
 
   client& watch(const std::vector<std::string>& keys, const reply_callback_t& reply_callback);
-  std::future<reply> watch(const std::vector<std::string>& keys);
+  reply_future_t watch(const std::vector<std::string>& keys);
 
   client& zadd(const std::string& key, const std::vector<std::string>& options,
       const std::multimap<std::string, std::string>& score_members, const reply_callback_t& reply_callback);
-  std::future<reply> zadd(const std::string& key, const std::vector<std::string>& options,
+  reply_future_t zadd(const std::string& key, const std::vector<std::string>& options,
       const std::multimap<std::string, std::string>& score_members);
 
+  //! range overload: the elements are encoded as they are iterated, in commands of at most the limits given to
+  //! set_bulk_split_limits, and the callback receives the replies of these commands merged into one
+  //! elements are (score, member) pairs, scores being numbers or strings
+  template <typename InputIt>
+  client& zadd(const std::string& key, const std::vector<std::string>& options, InputIt first, InputIt last,
+      const reply_callback_t& reply_callback);
+  template <typename InputIt>
+  reply_future_t zadd(const std::string& key, const std::vector<std::string>& options, InputIt first,
+      InputIt last);
+
   client& zcard(const std::string& key, const reply_callback_t& reply_callback);
-  std::future<reply> zcard(const std::string& key);
+  reply_future_t zcard(const std::string& key);
 
   client& zcount(const std::string& key, int min, int max, const reply_callback_t& reply_callback);
-  std::future<reply> zcount(const std::string& key, int min, int max);
+  reply_future_t zcount(const std::string& key, int min, int max);
 
   client& zcount(const std::string& key, double min, double max, const reply_callback_t& reply_callback);
-  std::future<reply> zcount(const std::string& key, double min, double max);
+  reply_future_t zcount(const std::string& key, double min, double max);
 
   client& zcount(const std::string& key, const std::string& min, const std::string& max,
       const reply_callback_t& reply_callback);
-  std::future<reply> zcount(const std::string& key, const std::string& min, const std::string& max);
+  reply_future_t zcount(const std::string& key, const std::string& min, const std::string& max);
 
   client& zincrby(const std::string& key, int incr, const std::string& member, const reply_callback_t& reply_callback);
-  std::future<reply> zincrby(const std::string& key, int incr, const std::string& member);
+  reply_future_t zincrby(const std::string& key, int incr, const std::string& member);
 
   client& zincrby(const std::string& key, double incr, const std::string& member,
       const reply_callback_t& reply_callback);
-  std::future<reply> zincrby(const std::string& key, double incr, const std::string& member);
+  reply_future_t zincrby(const std::string& key, double incr, const std::string& member);
 
   client& zincrby(const std::string& key, const std::string& incr, const std::string& member,
       const reply_callback_t& reply_callback);
-  std::future<reply> zincrby(const std::string& key, const std::string& incr, const std::string& member);
+  reply_future_t zincrby(const std::string& key, const std::string& incr, const std::string& member);
 
   client& zinterstore(const std::string& destination, std::size_t numkeys, const std::vector<std::string>& keys,
       const std::vector<std::size_t> weights, aggregate_method method, const reply_callback_t& reply_callback);
-  std::future<reply> zinterstore(const std::string& destination, std::size_t numkeys,
+  reply_future_t zinterstore(const std::string& destination, std::size_t numkeys,
       const std::vector<std::string>& keys, const std::vector<std::size_t> weights, aggregate_method method);
 
   client& zlexcount(const std::string& key, int min, int max, const reply_callback_t& reply_callback);
-  std::future<reply> zlexcount(const std::string& key, int min, int max);
+  reply_future_t zlexcount(const std::string& key, int min, int max);
 
   client& zlexcount(const std::string& key, double min, double max, const reply_callback_t& reply_callback);
-  std::future<reply> zlexcount(const std::string& key, double min, double max);
+  reply_future_t zlexcount(const std::string& key, double min, double max);
 
   client& zlexcount(const std::string& key, const std::string& min, const std::string& max,
       const reply_callback_t& reply_callback);
-  std::future<reply> zlexcount(const std::string& key, const std::string& min, const std::string& max);
+  reply_future_t zlexcount(const std::string& key, const std::string& min, const std::string& max);
 
   client& zrange(const std::string& key, int start, int stop, const reply_callback_t& reply_callback);
   client& zrange(const std::string& key, int start, int stop, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrange(const std::string& key, int start, int stop, bool withscores = false);
+  reply_future_t zrange(const std::string& key, int start, int stop, bool withscores = false);
 
   client& zrange(const std::string& key, double start, double stop, const reply_callback_t& reply_callback);
   client& zrange(const std::string& key, double start, double stop, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrange(const std::string& key, double start, double stop, bool withscores = false);
+  reply_future_t zrange(const std::string& key, double start, double stop, bool withscores = false);
 
   client& zrange(const std::string& key, const std::string& start, const std::string& stop,
       const reply_callback_t& reply_callback);
   client& zrange(const std::string& key, const std::string& start, const std::string& stop, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrange(const std::string& key, const std::string& start, const std::string& stop,
+  reply_future_t zrange(const std::string& key, const std::string& start, const std::string& stop,
       bool withscores = false);
 
   client& zrangebylex(const std::string& key, int min, int max, const reply_callback_t& reply_callback);
   client& zrangebylex(const std::string& key, int min, int max, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrangebylex(const std::string& key, int min, int max, bool withscores = false);
+  reply_future_t zrangebylex(const std::string& key, int min, int max, bool withscores = false);
 
   client& zrangebylex(const std::string& key, double min, double max, const reply_callback_t& reply_callback);
   client& zrangebylex(const std::string& key, double min, double max, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrangebylex(const std::string& key, double min, double max, bool withscores = false);
+  reply_future_t zrangebylex(const std::string& key, double min, double max, bool withscores = false);
 
   client& zrangebylex(const std::string& key, const std::string& min, const std::string& max,
       const reply_callback_t& reply_callback);
   client& zrangebylex(const std::string& key, const std::string& min, const std::string& max,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebylex(const std::string& key, const std::string& min, const std::string& max,
+  reply_future_t zrangebylex(const std::string& key, const std::string& min, const std::string& max,
       bool withscores = false);
 
   client& zrangebylex(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
       const reply_callback_t& reply_callback);
   client& zrangebylex(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebylex(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
+  reply_future_t zrangebylex(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
       bool withscores = false);
 
   client& zrangebylex(const std::string& key, double min, double max, std::size_t offset, std::size_t count,
       const reply_callback_t& reply_callback);
   client& zrangebylex(const std::string& key, double min, double max, std::size_t offset, std::size_t count,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebylex(const std::string& key, double min, double max, std::size_t offset, std::size_t count,
+  reply_future_t zrangebylex(const std::string& key, double min, double max, std::size_t offset, std::size_t count,
       bool withscores = false);
 
   client& zrangebylex(const std::string& key, const std::string& min, const std::string& max,
       std::size_t offset, std::size_t count, const reply_callback_t& reply_callback);
   client& zrangebylex(const std::string& key, const std::string& min, const std::string& max,
       std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebylex(const std::string& key, const std::string& min, const std::string& max,
+  reply_future_t zrangebylex(const std::string& key, const std::string& min, const std::string& max,
       std::size_t offset, std::size_t count, bool withscores = false);
 
   client& zrangebyscore(const std::string& key, int min, int max, const reply_callback_t& reply_callback);
   client& zrangebyscore(const std::string& key, int min, int max, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrangebyscore(const std::string& key, int min, int max, bool withscores = false);
+  reply_future_t zrangebyscore(const std::string& key, int min, int max, bool withscores = false);
 
   client& zrangebyscore(const std::string& key, double min, double max, const reply_callback_t& reply_callback);
   client& zrangebyscore(const std::string& key, double min, double max, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrangebyscore(const std::string& key, double min, double max, bool withscores = false);
+  reply_future_t zrangebyscore(const std::string& key, double min, double max, bool withscores = false);
 
   client& zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       const reply_callback_t& reply_callback);
   client& zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
+  reply_future_t zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       bool withscores = false);
 
   client& zrangebyscore(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
       const reply_callback_t& reply_callback);
   client& zrangebyscore(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebyscore(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
+  reply_future_t zrangebyscore(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
       bool withscores = false);
 
   client& zrangebyscore(const std::string& key, double min, double max, std::size_t offset,
       std::size_t count, const reply_callback_t& reply_callback);
   client& zrangebyscore(const std::string& key, double min, double max, std::size_t offset,
       std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebyscore(const std::string& key, double min, double max, std::size_t offset,
+  reply_future_t zrangebyscore(const std::string& key, double min, double max, std::size_t offset,
       std::size_t count, bool withscores = false);
 
   client& zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       std::size_t offset, std::size_t count, const reply_callback_t& reply_callback);
   client& zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
+  reply_future_t zrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       std::size_t offset, std::size_t count, bool withscores = false);
 
   client& zrank(const std::string& key, const std::string& member, const reply_callback_t& reply_callback);
-  std::future<reply> zrank(const std::string& key, const std::string& member);
+  reply_future_t zrank(const std::string& key, const std::string& member);
 
   client& zrem(const std::string& key, const std::vector<std::string>& members,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrem(const std::string& key, const std::vector<std::string>& members);
+  reply_future_t zrem(const std::string& key, const std::vector<std::string>& members);
 
   client& zremrangebylex(const std::string& key, int min, int max, const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebylex(const std::string& key, int min, int max);
+  reply_future_t zremrangebylex(const std::string& key, int min, int max);
 
   client& zremrangebylex(const std::string& key, double min, double max, const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebylex(const std::string& key, double min, double max);
+  reply_future_t zremrangebylex(const std::string& key, double min, double max);
 
   client& zremrangebylex(const std::string& key, const std::string& min, const std::string& max,
       const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebylex(const std::string& key, const std::string& min, const std::string& max);
+  reply_future_t zremrangebylex(const std::string& key, const std::string& min, const std::string& max);
 
   client& zremrangebyrank(const std::string& key, int start, int stop, const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebyrank(const std::string& key, int start, int stop);
+  reply_future_t zremrangebyrank(const std::string& key, int start, int stop);
 
   client& zremrangebyrank(const std::string& key, double start, double stop, const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebyrank(const std::string& key, double start, double stop);
+  reply_future_t zremrangebyrank(const std::string& key, double start, double stop);
 
   client& zremrangebyrank(const std::string& key, const std::string& start, const std::string& stop,
       const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebyrank(const std::string& key, const std::string& start, const std::string& stop);
+  reply_future_t zremrangebyrank(const std::string& key, const std::string& start, const std::string& stop);
 
   client& zremrangebyscore(const std::string& key, int min, int max, const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebyscore(const std::string& key, int min, int max);
+  reply_future_t zremrangebyscore(const std::string& key, int min, int max);
 
   client& zremrangebyscore(const std::string& key, double min, double max, const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebyscore(const std::string& key, double min, double max);
+  reply_future_t zremrangebyscore(const std::string& key, double min, double max);
 
   client& zremrangebyscore(const std::string& key, const std::string& min, const std::string& max,
       const reply_callback_t& reply_callback);
-  std::future<reply> zremrangebyscore(const std::string& key, const std::string& min, const std::string& max);
+  reply_future_t zremrangebyscore(const std::string& key, const std::string& min, const std::string& max);
 
   client& zrevrange(const std::string& key, int start, int stop, const reply_callback_t& reply_callback);
   client& zrevrange(const std::string& key, int start, int stop, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrevrange(const std::string& key, int start, int stop, bool withscores = false);
+  reply_future_t zrevrange(const std::string& key, int start, int stop, bool withscores = false);
 
   client& zrevrange(const std::string& key, double start, double stop, const reply_callback_t& reply_callback);
   client& zrevrange(const std::string& key, double start, double stop, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrevrange(const std::string& key, double start, double stop, bool withscores = false);
+  reply_future_t zrevrange(const std::string& key, double start, double stop, bool withscores = false);
 
   client& zrevrange(const std::string& key, const std::string& start, const std::string& stop,
       const reply_callback_t& reply_callback);
   client& zrevrange(const std::string& key, const std::string& start, const std::string& stop,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrange(const std::string& key, const std::string& start, const std::string& stop,
+  reply_future_t zrevrange(const std::string& key, const std::string& start, const std::string& stop,
       bool withscores = false);
 
   client& zrevrangebylex(const std::string& key, int max, int min, const reply_callback_t& reply_callback);
   client& zrevrangebylex(const std::string& key, int max, int min, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebylex(const std::string& key, int max, int min, bool withscores = false);
+  reply_future_t zrevrangebylex(const std::string& key, int max, int min, bool withscores = false);
 
   client& zrevrangebylex(const std::string& key, double max, double min, const reply_callback_t& reply_callback);
   client& zrevrangebylex(const std::string& key, double max, double min, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebylex(const std::string& key, double max, double min, bool withscores = false);
+  reply_future_t zrevrangebylex(const std::string& key, double max, double min, bool withscores = false);
 
   client& zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
       const reply_callback_t& reply_callback);
   client& zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
+  reply_future_t zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
       bool withscores = false);
 
   client& zrevrangebylex(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
       const reply_callback_t& reply_callback);
   client& zrevrangebylex(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebylex(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
+  reply_future_t zrevrangebylex(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
       bool withscores = false);
 
   client& zrevrangebylex(const std::string& key, double max, double min, std::size_t offset,
       std::size_t count, const reply_callback_t& reply_callback);
   client& zrevrangebylex(const std::string& key, double max, double min, std::size_t offset,
       std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebylex(const std::string& key, double max, double min, std::size_t offset,
+  reply_future_t zrevrangebylex(const std::string& key, double max, double min, std::size_t offset,
       std::size_t count, bool withscores = false);
 
   client& zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
       std::size_t offset, std::size_t count, const reply_callback_t& reply_callback);
   client& zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
       std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
+  reply_future_t zrevrangebylex(const std::string& key, const std::string& max, const std::string& min,
       std::size_t offset, std::size_t count, bool withscores = false);
 
   client& zrevrangebyscore(const std::string& key, int max, int min, const reply_callback_t& reply_callback);
   client& zrevrangebyscore(const std::string& key, int max, int min, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebyscore(const std::string& key, int max, int min, bool withscores = false);
+  reply_future_t zrevrangebyscore(const std::string& key, int max, int min, bool withscores = false);
 
   client& zrevrangebyscore(const std::string& key, double max, double min, const reply_callback_t& reply_callback);
   client& zrevrangebyscore(const std::string& key, double max, double min, bool withscores,
       const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebyscore(const std::string& key, double max, double min, bool withscores = false);
+  reply_future_t zrevrangebyscore(const std::string& key, double max, double min, bool withscores = false);
 
   client& zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
       const reply_callback_t& reply_callback);
   client& zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
+  reply_future_t zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
       bool withscores = false);
 
   client& zrevrangebyscore(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
       const reply_callback_t& reply_callback);
   client& zrevrangebyscore(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
       bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebyscore(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
+  reply_future_t zrevrangebyscore(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
       bool withscores = false);
 
   client& zrevrangebyscore(const std::string& key, double max, double min, std::size_t offset,
       std::size_t count, const reply_callback_t& reply_callback);
   client& zrevrangebyscore(const std::string& key, double max, double min, std::size_t offset,
       std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebyscore(const std::string& key, double max, double min, std::size_t offset,
+  reply_future_t zrevrangebyscore(const std::string& key, double max, double min, std::size_t offset,
       std::size_t count, bool withscores = false);
 
   client& zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
       std::size_t offset, std::size_t count, const reply_callback_t& reply_callback);
   client& zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
       std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
+  reply_future_t zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min,
       std::size_t offset, std::size_t count, bool withscores = false);
 
   client& zrevrank(const std::string& key, const std::string& member, const reply_callback_t& reply_callback);
-  std::future<reply> zrevrank(const std::string& key, const std::string& member);
+  reply_future_t zrevrank(const std::string& key, const std::string& member);
 
   client& zscan(const std::string& key, std::size_t cursor, const reply_callback_t& reply_callback);
-  std::future<reply> zscan(const std::string& key, std::size_t cursor);
+  reply_future_t zscan(const std::string& key, std::size_t cursor);
 
   client& zscan(const std::string& key, std::size_t cursor, const std::string& pattern,
       const reply_callback_t& reply_callback);
-  std::future<reply> zscan(const std::string& key, std::size_t cursor, const std::string& pattern);
+  reply_future_t zscan(const std::string& key, std::size_t cursor, const std::string& pattern);
 
   client& zscan(const std::string& key, std::size_t cursor, std::size_t count, const reply_callback_t& reply_callback);
-  std::future<reply> zscan(const std::string& key, std::size_t cursor, std::size_t count);
+  reply_future_t zscan(const std::string& key, std::size_t cursor, std::size_t count);
 
   client& zscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count,
       const reply_callback_t& reply_callback);
-  std::future<reply> zscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count);
+  reply_future_t zscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count);
 
   client& zscore(const std::string& key, const std::string& member, const reply_callback_t& reply_callback);
-  std::future<reply> zscore(const std::string& key, const std::string& member);
+  reply_future_t zscore(const std::string& key, const std::string& member);
 
   client& zunionstore(const std::string& destination, std::size_t numkeys,
       const std::vector<std::string>& keys, const std::vector<std::size_t> weights,
       aggregate_method method, const reply_callback_t& reply_callback);
-  std::future<reply> zunionstore(const std::string& destination, std::size_t numkeys,
+  reply_future_t zunionstore(const std::string& destination, std::size_t numkeys,
       const std::vector<std::string>& keys, const std::vector<std::size_t> weights, aggregate_method method);
 
 private:
@@ -1551,12 +1928,44 @@ private:
 
 private:
   //!
-  //! redis connection receive handler, triggered whenever a reply has been read by the redis connection
+  //! redis connection receive handler, triggered with the replies built from each read of the redis connection
+  //! the matching commands are dequeued under a single lock, and waiters are notified once for the whole batch
   //!
   //! \param connection redis_connection instance
-  //! \param reply parsed reply
+  //! \param replies parsed replies, in the order they were received
+  //!
+  void connection_receive_handler(network::redis_connection& connection, std::vector<reply>& replies);
+
+  //!
+  //! redis connection view receive handler, triggered whenever a reply selected by is_view_reply has been read
+  //!
+  //! \param connection redis_connection instance
+  //! \param reply view on the received reply
+  //!
+  void connection_view_receive_handler(network::redis_connection& connection, const reply_view& reply);
+
+  //!
+  //! redis connection view predicate, called when a reply starts being received
+  //!
+  //! \param index number of replies received before this one and not dequeued yet
+  //! \return whether the matching pending command expects a reply view
+  //!
+  bool is_view_reply(std::size_t index);
+
+  //!
+  //! redis connection handler selector, called when a reply starts being received
+  //!
+  //! \param index number of replies received before this one and not dequeued yet
+  //! \return reply handler of the matching pending command, if any
   //!
-  void connection_receive_handler(network::redis_connection& connection, reply& reply);
+  builders::reply_handler_iface* reply_handler_for(std::size_t index);
+
+  //!
+  //! mark callbacks as completed and notify the threads waiting in sync_commit
+  //!
+  //! \param count number of completed callbacks
+  //!
+  void release_running_callbacks(std::size_t count = 1);
 
   //!
   //! redis_connection disconnection handler, triggered whenever a disconnection occured
@@ -1570,24 +1979,293 @@ private:
   //!
   void clear_callbacks(void);
 
+  //!
+  //! reset the queue of pending callbacks and the submission queue, once disconnected
+  //! the submitted commands not drained yet are failed too, without being encoded: they must not be written on the
+  //! next connection
+  //!
+  void clear_commands(void);
+
+  //!
+  //! \return whether the given pending commands reach one of the high watermarks
+  //!
+  bool above_high_watermark(std::size_t uBytes, std::size_t uCommands) const;
+
+  //!
+  //! \return whether the given pending commands are below all the low watermarks
+  //!
+  bool below_low_watermark(std::size_t uBytes, std::size_t uCommands) const;
+
+  //!
+  //! account for commands leaving the pending commands, ending the saturation once below the low watermarks
+  //!
+  //! \param bytes size of the commands
+  //! \param count number of commands
+  //!
+  void release_pending(std::size_t uBytes, std::size_t uCount);
+
   //!
   //! try to commit the pending pipelined
   //! if client is disconnected, will throw an exception and clear all pending callbacks (call clear_callbacks())
   //!
   void try_commit(void);
 
-  //! Execute a command on the client and tie the callback to a future
-  std::future<reply> exec_cmd(const std::function<client&(const reply_callback_t&)>& task);
+  //!
+  //! same as try_commit, without draining the submitted commands (m_mtxCallbacks being already locked)
+  //!
+  void unprotected_try_commit(void);
+
+  //!
+  //! commit on behalf of the auto commit mode or the backpressure: errors are logged, not thrown
+  //!
+  void auto_commit(void);
+
+  //!
+  //! body of the thread committing the submitted commands once the auto commit delay elapsed
+  //!
+  void auto_commit_loop(void);
+
+  //!
+  //! stop and join the auto commit thread, if any
+  //!
+  void stop_auto_commit(void);
+
+  //!
+  //! execute a command on the client and tie its callback to a future
+  //! only used by the future-based methods of the named commands with optional arguments, the others sending their
+  //! command straight away with send_args_future
+  //!
+  //! \param task calls the callback-based method of the command with the given callback
+  //! \return future to handle the reply
+  //!
+  template <typename Task>
+  reply_future_t exec_cmd(const Task& task);
+
+  //!
+  //! promise tied to the future returned by the future-based command methods
+  //!
+#ifdef __CPP_REDIS_USE_POOLED_FUTURES
+  typedef pooled_promise<reply> reply_promise_t;
+#else
+  typedef std::promise<reply> reply_promise_t;
+#endif /* __CPP_REDIS_USE_POOLED_FUTURES */
+
+  //!
+  //! callback of a future-based command, owning the promise of its future
+  //! move-only and small enough to be stored inline in a stored_reply_callback_t
+  //!
+  struct future_callback {
+    explicit future_callback(reply_promise_t&& prms)
+    : promise(std::move(prms)) {}
+
+    //! the reply is not used anymore once callbacks returned: hand it over to the future without copy
+    void
+    operator()(reply& r) {
+      promise.set_value(std::move(r));
+    }
+
+    reply_promise_t promise;
+  };
+
+  //!
+  //! \param callback callback of a command about to be stored as pending: a reply_callback_t (copied), or any other
+  //!        callable taking a reply& (stored as is)
+  //! \return callback to be stored in the pending command
+  //!
+  template <typename Callback>
+  static stored_reply_callback_t take_callback(Callback&& callback);
+
+  //!
+  //! replies of the commands a range has been split into, merged into a single reply
+  //!
+  struct bulk_request {
+    std::mutex               mtx;
+    stored_reply_callback_t  callback;
+    bool                     bBoolean;
+    reply                    result;
+    std::size_t              uSent;
+    std::size_t              uReceived;
+    bool                     bComplete;
+  };
+
+  //!
+  //! encode the elements of a range into as many commands as required by the bulk split limits, each starting with
+  //! the given prefix (command and key), and send them
+  //!
+  //! \param callback callback to be called with the merged replies of the commands
+  //! \param boolean whether integer replies are booleans (merged with a logical or) rather than counts (summed)
+  //! \param first first element of the range
+  //! \param last end of the range
+  //! \param prefix arguments starting each command
+  //!
+  template <typename Callback, typename InputIt, typename... Prefix>
+  void send_range(Callback&& callback, bool bBoolean, InputIt first, InputIt last, const Prefix&... prefix);
+
+  //!
+  //! same as send_range
+  //! but future based: does not take any callback and return a future to handle the merged replies
+  //!
+  template <typename InputIt, typename... Prefix>
+  reply_future_t send_range_future(bool bBoolean, InputIt first, InputIt last, const Prefix&... prefix);
+
+  //!
+  //! \param request merged replies
+  //! \return callback merging the reply of one of the commands of a range into the request
+  //!
+  static stored_reply_callback_t bulk_reply_callback(const std::shared_ptr<bulk_request>& ptrRequest);
+
+  //!
+  //! mark all the commands of a range as sent, calling the callback if all their replies were already received
+  //!
+  //! \param request merged replies
+  //!
+  static void complete_bulk_request(const std::shared_ptr<bulk_request>& ptrRequest);
+
+  //!
+  //! command whose arguments are known one after the other, each being encoded in place as it is appended
+  //! (same argument types as send_args), without building any intermediate vector of strings
+  //!
+  class command_frame {
+  public:
+    //!
+    //! \param args first arguments of the command, starting with its name
+    //!
+    template <typename... Args>
+    explicit command_frame(const Args&... args);
+
+    //!
+    //! append arguments to the command
+    //!
+    //! \param args arguments to be appended
+    //!
+    template <typename... Args>
+    void push_back(const Args&... args);
+
+    //!
+    //! complete the command
+    //!
+    //! \param extra_args number of arguments written after the frame (shared value)
+    //! \return encoded command
+    //!
+    std::vector<char> release(std::size_t uExtraArgs = 0);
+
+  private:
+    std::vector<char> m_vctFrame;
+    std::size_t       m_uOffset;
+    std::size_t       m_uNbArgs;
+  };
+
+  //!
+  //! same as send_args, with a last argument shared with the caller (see send with a shared value)
+  //!
+  //! \param callback callback to be called on received reply
+  //! \param value last argument of the command
+  //! \param args arguments of the command, starting with its name, except its last argument
+  //!
+  template <typename... Args>
+  void send_shared_args(const reply_callback_t& callback, const shared_value_t& value, const Args&... args);
 
 private:
   //!
-  //! struct to store commands information (command to be sent and callback to be called)
+  //! struct to store commands information: encoded command, kept to be replayed on reconnection, and callbacks
+  //! the arguments are never kept, only their encoded form, which is released once sent in no-replay mode
   //!
   struct command_request {
-    std::vector<std::string>    vctCommand;
-    reply_callback_t            callback;
+    //! encoded command, up to its shared value if any
+    std::vector<char>             vctFrame;
+    //! value written after vctFrame without being copied, as the last argument of the command (null if none)
+    shared_value_t                value;
+    //! size of the command in the send buffer, as accounted for by the auto commit mode and the backpressure
+    std::size_t                   uSize;
+    stored_reply_callback_t       callback;
+    stored_reply_view_callback_t  view_callback;
+    reply_handler_t               handler;
+  };
+
+  //!
+  //! replies of the commands of a batch, gathered to be delivered at once
+  //! each reply is stored at the index of its command, the last one received calling the callback
+  //!
+  struct batch_request {
+    std::vector<reply>        vctReplies;
+    std::atomic<std::size_t>  uRemaining_a;
+    batch_callback_t          callback;
   };
 
+  //!
+  //! dequeue the first pending command and mark a callback as running
+  //!
+  //! \param request dequeued command (left untouched if no command is pending)
+  //!
+  void dequeue_command(command_request& request);
+
+  //!
+  //! dequeue the first pending commands and mark as many callbacks as running, under a single lock
+  //!
+  //! \param requests dequeued commands (missing commands are left default-constructed)
+  //! \param count number of commands to be dequeued
+  //!
+  void dequeue_commands(std::vector<command_request>& requests, std::size_t count);
+
+  //!
+  //! buffer the given command and queue it as pending, without any mutex lock
+  //!
+  //! \param request command to be sent and its callbacks
+  //!
+  void unprotected_send(command_request&& request);
+
+  //!
+  //! enqueue the given encoded command in the submission queue, without any mutex lock
+  //! it is buffered and queued as pending when the submission queue is drained (on commit)
+  //!
+  //! \param request command to be sent and its callbacks
+  //!
+  void submit(command_request&& request);
+
+  //!
+  //! buffer the submitted commands and queue them as pending, in submission order (m_mtxCallbacks must be locked)
+  //!
+  void drain_submissions(void);
+
+  //!
+  //! resend all pending commands that failed to be sent due to disconnection (or fail them in no-replay mode)
+  //!
+  //! \param commands commands pending when the connection was lost
+  //!
+  void resend_failed_commands(ring_buffer<command_request>&& queCommands);
+
+  //!
+  //! call the callbacks of the given commands with an error, from a separate thread
+  //!
+  //! \param commands commands that will not get a reply
+  //!
+  void fail_commands(ring_buffer<command_request>&& queCommands);
+
+  //!
+  //! body of the thread started by fail_commands
+  //!
+  //! \param commands commands that will not get a reply
+  //!
+  void call_failed_callbacks(ring_buffer<command_request>&& queCommands);
+
+  //!
+  //! account for commands about to be submitted as pending, applying the backpressure policy
+  //! the caller fails the commands (see fail_request) if they are not admitted, in which case they are not accounted for
+  //!
+  //! \param bytes size of the commands
+  //! \param commands number of commands
+  //! \return whether the commands can be submitted
+  //!
+  bool admit(std::size_t uBytes, std::size_t uCommands);
+
+  //!
+  //! call the callback of a command that did not get a reply with an error
+  //!
+  //! \param request failed command
+  //! \param error error message
+  //!
+  static void fail_request(command_request& request, const std::string& sError);
+
 private:
   //!
   //! server we are connected to
@@ -1649,7 +2327,12 @@ private:
   //!
   //! sent commands waiting to be executed
   //!
-  std::queue<command_request>   m_queCommands;
+  ring_buffer<command_request>  m_queCommands;
+
+  //!
+  //! commands submitted by the producer threads, not yet buffered (drained under m_mtxCallbacks)
+  //!
+  mpsc_queue<command_request>   m_queSubmissions;
 
   //!
   //! user defined connect status callback
@@ -1670,6 +2353,90 @@ private:
   //! number of callbacks currently being running
   //!
   std::atomic<unsigned int>     m_uRunningCallbacks_a;
+
+  //!
+  //! number of pending commands expecting a reply view (avoids looking the queue up for every reply)
+  //!
+  std::atomic<unsigned int>     m_uPendingViews_a;
+
+  //!
+  //! number of pending commands with a reply handler
+  //!
+  std::atomic<unsigned int>     m_uPendingHandlers_a;
+
+  //!
+  //! maximum number of elements per command of a split range (0 for no limit)
+  //!
+  std::size_t                   m_uBulkMaxArgs = __CPP_REDIS_BULK_MAX_ARGS;
+
+  //!
+  //! size of an encoded command of a split range beyond which no more elements are added (0 for no limit)
+  //!
+  std::size_t                   m_uBulkMaxBytes = __CPP_REDIS_BULK_MAX_BYTES;
+
+  //!
+  //! whether the auto commit mode is enabled
+  //!
+  std::atomic_bool              m_bAutoCommit_a;
+
+  //!
+  //! auto commit thresholds: size and number of the submitted commands (0 for no limit), and delay (0 for none)
+  //!
+  std::size_t                   m_uAutoCommitMaxBytes = 0;
+  std::size_t                   m_uAutoCommitMaxCommands = 0;
+  std::chrono::microseconds     m_durAutoCommitDelay = std::chrono::microseconds(0);
+
+  //!
+  //! size and number of the commands submitted and not drained yet (only maintained in auto commit mode)
+  //!
+  std::atomic<std::size_t>      m_uSubmittedBytes_a;
+  std::atomic<std::size_t>      m_uSubmittedCommands_a;
+
+  //!
+  //! thread committing the submitted commands once the auto commit delay elapsed
+  //!
+  std::thread                   m_threadAutoCommit;
+
+  //!
+  //! auto commit thread synchronization: a command was submitted in an empty batch, or the thread must stop
+  //!
+  std::mutex                    m_mtxAutoCommit;
+  std::condition_variable       m_cvAutoCommit;
+  bool                          m_bAutoCommitPending = false;
+  bool                          m_bAutoCommitStop = false;
+
+  //!
+  //! watermarks bounding the pending commands, and whether they are enabled
+  //!
+  backpressure_limits           m_backpressure;
+  bool                          m_bBackpressure = false;
+
+  //!
+  //! size and number of the commands waiting for their reply
+  //!
+  std::atomic<std::size_t>      m_uPendingBytes_a;
+  std::atomic<std::size_t>      m_uPendingCommands_a;
+
+  //!
+  //! whether a high watermark has been reached, and the pending commands are not below the low watermarks yet
+  //!
+  std::atomic_bool              m_bSaturated_a;
+
+  //!
+  //! thread running the reply callbacks, if any: the commands it sends are never blocked
+  //!
+  std::atomic<std::thread::id>  m_idReceiving_a;
+
+  //!
+  //! senders blocked by the block policy, waiting for the end of the saturation
+  //!
+  std::mutex                    m_mtxBackpressure;
+  std::condition_variable       m_cvBackpressure;
+
+  //!
+  //! whether the pending commands keep their encoded form, to be replayed on reconnection
+  //!
+  bool                          m_bReplay = true;
 }; // namespace cpp_redis
 
 } // namespace cpp_redis
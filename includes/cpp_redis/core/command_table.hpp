@@ -0,0 +1,357 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+//!
+//! list of the commands sent by the client, with their metadata
+//! __CPP_REDIS_COMMAND(id, name, name length, arity, flags, first key, last key, key step)
+//! __CPP_REDIS_SUBCOMMAND(id, name, name length, subcommand, subcommand length, arity, flags, first key, last key,
+//! key step)
+//! arity and key positions follow the conventions of the COMMAND command of redis: the arity counts the name (and the
+//! subcommand) and is negative when it is a minimum, key positions are indexes in the whole command (0 when there are
+//! no keys), a negative last key counting from the end of the command
+//!
+#define __CPP_REDIS_COMMAND_LIST(__CPP_REDIS_COMMAND, __CPP_REDIS_SUBCOMMAND) \
+  __CPP_REDIS_COMMAND(append, "APPEND", 6, 3, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(auth, "AUTH", 4, 2, noscript, 0, 0, 0)                                                          \
+  __CPP_REDIS_COMMAND(bgrewriteaof, "BGREWRITEAOF", 12, 1, admin, 0, 0, 0)                                            \
+  __CPP_REDIS_COMMAND(bgsave, "BGSAVE", 6, -1, admin, 0, 0, 0)                                                        \
+  __CPP_REDIS_COMMAND(bitcount, "BITCOUNT", 8, -2, readonly, 1, 1, 1)                                                 \
+  __CPP_REDIS_COMMAND(bitfield, "BITFIELD", 8, -2, write, 1, 1, 1)                                                    \
+  __CPP_REDIS_COMMAND(bitop, "BITOP", 5, -4, write, 2, -1, 1)                                                         \
+  __CPP_REDIS_COMMAND(bitpos, "BITPOS", 6, -3, readonly, 1, 1, 1)                                                     \
+  __CPP_REDIS_COMMAND(blpop, "BLPOP", 5, -3, write | noscript | blocking, 1, -2, 1)                                   \
+  __CPP_REDIS_COMMAND(brpop, "BRPOP", 5, -3, write | noscript | blocking, 1, -2, 1)                                   \
+  __CPP_REDIS_COMMAND(brpoplpush, "BRPOPLPUSH", 10, 4, write | noscript | blocking, 1, 2, 1)                          \
+  __CPP_REDIS_SUBCOMMAND(client_getname, "CLIENT", 6, "GETNAME", 7, 2, admin | noscript, 0, 0, 0)                     \
+  __CPP_REDIS_SUBCOMMAND(client_list, "CLIENT", 6, "LIST", 4, -2, admin | noscript, 0, 0, 0)                          \
+  __CPP_REDIS_SUBCOMMAND(client_pause, "CLIENT", 6, "PAUSE", 5, 3, admin | noscript, 0, 0, 0)                         \
+  __CPP_REDIS_SUBCOMMAND(client_reply, "CLIENT", 6, "REPLY", 5, 3, admin | noscript, 0, 0, 0)                         \
+  __CPP_REDIS_SUBCOMMAND(client_setname, "CLIENT", 6, "SETNAME", 7, 3, admin | noscript, 0, 0, 0)                     \
+  __CPP_REDIS_SUBCOMMAND(cluster_addslots, "CLUSTER", 7, "ADDSLOTS", 8, -3, admin, 0, 0, 0)                           \
+  __CPP_REDIS_SUBCOMMAND(cluster_count_failure_reports, "CLUSTER", 7, "COUNT-FAILURE-REPORTS", 21, 3, admin, 0, 0, 0) \
+  __CPP_REDIS_SUBCOMMAND(cluster_countkeysinslot, "CLUSTER", 7, "COUNTKEYSINSLOT", 15, 3, admin, 0, 0, 0)             \
+  __CPP_REDIS_SUBCOMMAND(cluster_delslots, "CLUSTER", 7, "DELSLOTS", 8, -3, admin, 0, 0, 0)                           \
+  __CPP_REDIS_SUBCOMMAND(cluster_failover, "CLUSTER", 7, "FAILOVER", 8, -2, admin, 0, 0, 0)                           \
+  __CPP_REDIS_SUBCOMMAND(cluster_forget, "CLUSTER", 7, "FORGET", 6, 3, admin, 0, 0, 0)                                \
+  __CPP_REDIS_SUBCOMMAND(cluster_getkeysinslot, "CLUSTER", 7, "GETKEYSINSLOT", 13, 4, admin, 0, 0, 0)                 \
+  __CPP_REDIS_SUBCOMMAND(cluster_info, "CLUSTER", 7, "INFO", 4, 2, admin, 0, 0, 0)                                    \
+  __CPP_REDIS_SUBCOMMAND(cluster_keyslot, "CLUSTER", 7, "KEYSLOT", 7, 3, admin, 0, 0, 0)                              \
+  __CPP_REDIS_SUBCOMMAND(cluster_meet, "CLUSTER", 7, "MEET", 4, -4, admin, 0, 0, 0)                                   \
+  __CPP_REDIS_SUBCOMMAND(cluster_nodes, "CLUSTER", 7, "NODES", 5, 2, admin, 0, 0, 0)                                  \
+  __CPP_REDIS_SUBCOMMAND(cluster_replicate, "CLUSTER", 7, "REPLICATE", 9, 3, admin, 0, 0, 0)                          \
+  __CPP_REDIS_SUBCOMMAND(cluster_reset, "CLUSTER", 7, "RESET", 5, -2, admin, 0, 0, 0)                                 \
+  __CPP_REDIS_SUBCOMMAND(cluster_saveconfig, "CLUSTER", 7, "SAVECONFIG", 10, 2, admin, 0, 0, 0)                       \
+  __CPP_REDIS_SUBCOMMAND(cluster_set_config_epoch, "CLUSTER", 7, "SET-CONFIG-EPOCH", 16, 3, admin, 0, 0, 0)           \
+  __CPP_REDIS_SUBCOMMAND(cluster_setslot, "CLUSTER", 7, "SETSLOT", 7, -4, admin, 0, 0, 0)                             \
+  __CPP_REDIS_SUBCOMMAND(cluster_slaves, "CLUSTER", 7, "SLAVES", 6, 3, admin, 0, 0, 0)                                \
+  __CPP_REDIS_SUBCOMMAND(cluster_slots, "CLUSTER", 7, "SLOTS", 5, 2, admin, 0, 0, 0)                                  \
+  __CPP_REDIS_COMMAND(command, "COMMAND", 7, -1, none, 0, 0, 0)                                                       \
+  __CPP_REDIS_SUBCOMMAND(command_count, "COMMAND", 7, "COUNT", 5, 2, none, 0, 0, 0)                                   \
+  __CPP_REDIS_SUBCOMMAND(command_getkeys, "COMMAND", 7, "GETKEYS", 7, -3, none, 0, 0, 0)                              \
+  __CPP_REDIS_SUBCOMMAND(config_get, "CONFIG", 6, "GET", 3, 3, admin, 0, 0, 0)                                        \
+  __CPP_REDIS_SUBCOMMAND(config_resetstat, "CONFIG", 6, "RESETSTAT", 9, 2, admin, 0, 0, 0)                            \
+  __CPP_REDIS_SUBCOMMAND(config_rewrite, "CONFIG", 6, "REWRITE", 7, 2, admin, 0, 0, 0)                                \
+  __CPP_REDIS_SUBCOMMAND(config_set, "CONFIG", 6, "SET", 3, 4, admin, 0, 0, 0)                                        \
+  __CPP_REDIS_COMMAND(dbsize, "DBSIZE", 6, 1, readonly, 0, 0, 0)                                                      \
+  __CPP_REDIS_SUBCOMMAND(debug_object, "DEBUG", 5, "OBJECT", 6, 3, admin | noscript, 0, 0, 0)                         \
+  __CPP_REDIS_SUBCOMMAND(debug_segfault, "DEBUG", 5, "SEGFAULT", 8, 2, admin | noscript, 0, 0, 0)                     \
+  __CPP_REDIS_COMMAND(decr, "DECR", 4, 2, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(decrby, "DECRBY", 6, 3, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(del, "DEL", 3, -2, write, 1, -1, 1)                                                             \
+  __CPP_REDIS_COMMAND(discard, "DISCARD", 7, 1, noscript, 0, 0, 0)                                                    \
+  __CPP_REDIS_COMMAND(dump, "DUMP", 4, 2, readonly, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(echo, "ECHO", 4, 2, none, 0, 0, 0)                                                              \
+  __CPP_REDIS_COMMAND(eval, "EVAL", 4, -3, noscript | movablekeys, 0, 0, 0)                                           \
+  __CPP_REDIS_COMMAND(evalsha, "EVALSHA", 7, -3, noscript | movablekeys, 0, 0, 0)                                     \
+  __CPP_REDIS_COMMAND(exec, "EXEC", 4, 1, noscript, 0, 0, 0)                                                          \
+  __CPP_REDIS_COMMAND(exists, "EXISTS", 6, -2, readonly, 1, -1, 1)                                                    \
+  __CPP_REDIS_COMMAND(expire, "EXPIRE", 6, 3, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(expireat, "EXPIREAT", 8, 3, write, 1, 1, 1)                                                     \
+  __CPP_REDIS_COMMAND(flushall, "FLUSHALL", 8, -1, write, 0, 0, 0)                                                    \
+  __CPP_REDIS_COMMAND(flushdb, "FLUSHDB", 7, -1, write, 0, 0, 0)                                                      \
+  __CPP_REDIS_COMMAND(geoadd, "GEOADD", 6, -5, write, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(geodist, "GEODIST", 7, -4, readonly, 1, 1, 1)                                                   \
+  __CPP_REDIS_COMMAND(geohash, "GEOHASH", 7, -2, readonly, 1, 1, 1)                                                   \
+  __CPP_REDIS_COMMAND(geopos, "GEOPOS", 6, -2, readonly, 1, 1, 1)                                                     \
+  __CPP_REDIS_COMMAND(georadius, "GEORADIUS", 9, -6, write | movablekeys, 1, 1, 1)                                    \
+  __CPP_REDIS_COMMAND(georadiusbymember, "GEORADIUSBYMEMBER", 17, -5, write | movablekeys, 1, 1, 1)                   \
+  __CPP_REDIS_COMMAND(get, "GET", 3, 2, readonly, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(getbit, "GETBIT", 6, 3, readonly, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(getrange, "GETRANGE", 8, 4, readonly, 1, 1, 1)                                                  \
+  __CPP_REDIS_COMMAND(getset, "GETSET", 6, 3, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(hdel, "HDEL", 4, -3, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(hexists, "HEXISTS", 7, 3, readonly, 1, 1, 1)                                                    \
+  __CPP_REDIS_COMMAND(hget, "HGET", 4, 3, readonly, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(hgetall, "HGETALL", 7, 2, readonly, 1, 1, 1)                                                    \
+  __CPP_REDIS_COMMAND(hincrby, "HINCRBY", 7, 4, write, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(hincrbyfloat, "HINCRBYFLOAT", 12, 4, write, 1, 1, 1)                                            \
+  __CPP_REDIS_COMMAND(hkeys, "HKEYS", 5, 2, readonly, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(hlen, "HLEN", 4, 2, readonly, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(hmget, "HMGET", 5, -3, readonly, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(hmset, "HMSET", 5, -4, write, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(hscan, "HSCAN", 5, -3, readonly, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(hset, "HSET", 4, -4, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(hsetnx, "HSETNX", 6, 4, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(hstrlen, "HSTRLEN", 7, 3, readonly, 1, 1, 1)                                                    \
+  __CPP_REDIS_COMMAND(hvals, "HVALS", 5, 2, readonly, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(incr, "INCR", 4, 2, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(incrby, "INCRBY", 6, 3, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(incrbyfloat, "INCRBYFLOAT", 11, 3, write, 1, 1, 1)                                              \
+  __CPP_REDIS_COMMAND(info, "INFO", 4, -1, none, 0, 0, 0)                                                             \
+  __CPP_REDIS_COMMAND(keys, "KEYS", 4, 2, readonly, 0, 0, 0)                                                          \
+  __CPP_REDIS_COMMAND(lastsave, "LASTSAVE", 8, 1, none, 0, 0, 0)                                                      \
+  __CPP_REDIS_COMMAND(lindex, "LINDEX", 6, 3, readonly, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(linsert, "LINSERT", 7, 5, write, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(llen, "LLEN", 4, 2, readonly, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(lpop, "LPOP", 4, 2, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(lpush, "LPUSH", 5, -3, write, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(lpushx, "LPUSHX", 6, -3, write, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(lrange, "LRANGE", 6, 4, readonly, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(lrem, "LREM", 4, 4, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(lset, "LSET", 4, 4, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(ltrim, "LTRIM", 5, 4, write, 1, 1, 1)                                                           \
+  __CPP_REDIS_COMMAND(mget, "MGET", 4, -2, readonly, 1, -1, 1)                                                        \
+  __CPP_REDIS_COMMAND(migrate, "MIGRATE", 7, -6, write | movablekeys, 0, 0, 0)                                        \
+  __CPP_REDIS_COMMAND(monitor, "MONITOR", 7, 1, admin | noscript, 0, 0, 0)                                            \
+  __CPP_REDIS_COMMAND(move, "MOVE", 4, 3, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(mset, "MSET", 4, -3, write, 1, -1, 2)                                                           \
+  __CPP_REDIS_COMMAND(msetnx, "MSETNX", 6, -3, write, 1, -1, 2)                                                       \
+  __CPP_REDIS_COMMAND(multi, "MULTI", 5, 1, noscript, 0, 0, 0)                                                        \
+  __CPP_REDIS_COMMAND(object, "OBJECT", 6, -2, readonly, 2, 2, 1)                                                     \
+  __CPP_REDIS_COMMAND(persist, "PERSIST", 7, 2, write, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(pexpire, "PEXPIRE", 7, 3, write, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(pexpireat, "PEXPIREAT", 9, 3, write, 1, 1, 1)                                                   \
+  __CPP_REDIS_COMMAND(pfadd, "PFADD", 5, -2, write, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(pfcount, "PFCOUNT", 7, -2, readonly, 1, -1, 1)                                                  \
+  __CPP_REDIS_COMMAND(pfmerge, "PFMERGE", 7, -2, write, 1, -1, 1)                                                     \
+  __CPP_REDIS_COMMAND(ping, "PING", 4, -1, none, 0, 0, 0)                                                             \
+  __CPP_REDIS_COMMAND(psetex, "PSETEX", 6, 4, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(pttl, "PTTL", 4, 2, readonly, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(publish, "PUBLISH", 7, 3, pubsub, 0, 0, 0)                                                      \
+  __CPP_REDIS_COMMAND(pubsub, "PUBSUB", 6, -2, pubsub, 0, 0, 0)                                                       \
+  __CPP_REDIS_COMMAND(quit, "QUIT", 4, 1, none, 0, 0, 0)                                                              \
+  __CPP_REDIS_COMMAND(randomkey, "RANDOMKEY", 9, 1, readonly, 0, 0, 0)                                                \
+  __CPP_REDIS_COMMAND(readonly, "READONLY", 8, 1, none, 0, 0, 0)                                                      \
+  __CPP_REDIS_COMMAND(readwrite, "READWRITE", 9, 1, none, 0, 0, 0)                                                    \
+  __CPP_REDIS_COMMAND(rename, "RENAME", 6, 3, write, 1, 2, 1)                                                         \
+  __CPP_REDIS_COMMAND(renamenx, "RENAMENX", 8, 3, write, 1, 2, 1)                                                     \
+  __CPP_REDIS_COMMAND(restore, "RESTORE", 7, -4, write, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(role, "ROLE", 4, 1, noscript, 0, 0, 0)                                                          \
+  __CPP_REDIS_COMMAND(rpop, "RPOP", 4, 2, write, 1, 1, 1)                                                             \
+  __CPP_REDIS_COMMAND(rpoplpush, "RPOPLPUSH", 9, 3, write, 1, 2, 1)                                                   \
+  __CPP_REDIS_COMMAND(rpush, "RPUSH", 5, -3, write, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(rpushx, "RPUSHX", 6, -3, write, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(sadd, "SADD", 4, -3, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(save, "SAVE", 4, 1, admin | noscript, 0, 0, 0)                                                  \
+  __CPP_REDIS_COMMAND(scan, "SCAN", 4, -2, readonly, 0, 0, 0)                                                         \
+  __CPP_REDIS_COMMAND(scard, "SCARD", 5, 2, readonly, 1, 1, 1)                                                        \
+  __CPP_REDIS_SUBCOMMAND(script_debug, "SCRIPT", 6, "DEBUG", 5, 3, noscript, 0, 0, 0)                                 \
+  __CPP_REDIS_SUBCOMMAND(script_exists, "SCRIPT", 6, "EXISTS", 6, -3, noscript, 0, 0, 0)                              \
+  __CPP_REDIS_SUBCOMMAND(script_flush, "SCRIPT", 6, "FLUSH", 5, -2, noscript, 0, 0, 0)                                \
+  __CPP_REDIS_SUBCOMMAND(script_kill, "SCRIPT", 6, "KILL", 4, 2, noscript, 0, 0, 0)                                   \
+  __CPP_REDIS_SUBCOMMAND(script_load, "SCRIPT", 6, "LOAD", 4, 3, noscript, 0, 0, 0)                                   \
+  __CPP_REDIS_COMMAND(sdiff, "SDIFF", 5, -2, readonly, 1, -1, 1)                                                      \
+  __CPP_REDIS_COMMAND(sdiffstore, "SDIFFSTORE", 10, -3, write, 1, -1, 1)                                              \
+  __CPP_REDIS_COMMAND(select, "SELECT", 6, 2, none, 0, 0, 0)                                                          \
+  __CPP_REDIS_COMMAND(set, "SET", 3, -3, write, 1, 1, 1)                                                              \
+  __CPP_REDIS_COMMAND(setbit, "SETBIT", 6, 4, write, 1, 1, 1)                                                         \
+  __CPP_REDIS_COMMAND(setex, "SETEX", 5, 4, write, 1, 1, 1)                                                           \
+  __CPP_REDIS_COMMAND(setnx, "SETNX", 5, 3, write, 1, 1, 1)                                                           \
+  __CPP_REDIS_COMMAND(setrange, "SETRANGE", 8, 4, write, 1, 1, 1)                                                     \
+  __CPP_REDIS_COMMAND(shutdown, "SHUTDOWN", 8, -1, admin, 0, 0, 0)                                                    \
+  __CPP_REDIS_COMMAND(sinter, "SINTER", 6, -2, readonly, 1, -1, 1)                                                    \
+  __CPP_REDIS_COMMAND(sinterstore, "SINTERSTORE", 11, -3, write, 1, -1, 1)                                            \
+  __CPP_REDIS_COMMAND(sismember, "SISMEMBER", 9, 3, readonly, 1, 1, 1)                                                \
+  __CPP_REDIS_COMMAND(slaveof, "SLAVEOF", 7, 3, admin | noscript, 0, 0, 0)                                            \
+  __CPP_REDIS_COMMAND(slowlog, "SLOWLOG", 7, -2, admin, 0, 0, 0)                                                      \
+  __CPP_REDIS_COMMAND(smembers, "SMEMBERS", 8, 2, readonly, 1, 1, 1)                                                  \
+  __CPP_REDIS_COMMAND(smove, "SMOVE", 5, 4, write, 1, 2, 1)                                                           \
+  __CPP_REDIS_COMMAND(sort, "SORT", 4, -2, write | movablekeys, 1, 1, 1)                                              \
+  __CPP_REDIS_COMMAND(spop, "SPOP", 4, -2, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(srandmember, "SRANDMEMBER", 11, -2, readonly, 1, 1, 1)                                          \
+  __CPP_REDIS_COMMAND(srem, "SREM", 4, -3, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(sscan, "SSCAN", 5, -3, readonly, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(strlen, "STRLEN", 6, 2, readonly, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(sunion, "SUNION", 6, -2, readonly, 1, -1, 1)                                                    \
+  __CPP_REDIS_COMMAND(sunionstore, "SUNIONSTORE", 11, -3, write, 1, -1, 1)                                            \
+  __CPP_REDIS_COMMAND(sync, "SYNC", 4, 1, admin | noscript, 0, 0, 0)                                                  \
+  __CPP_REDIS_COMMAND(time, "TIME", 4, 1, none, 0, 0, 0)                                                              \
+  __CPP_REDIS_COMMAND(ttl, "TTL", 3, 2, readonly, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(type, "TYPE", 4, 2, readonly, 1, 1, 1)                                                          \
+  __CPP_REDIS_COMMAND(unwatch, "UNWATCH", 7, 1, noscript, 0, 0, 0)                                                    \
+  __CPP_REDIS_COMMAND(wait, "WAIT", 4, 3, noscript, 0, 0, 0)                                                          \
+  __CPP_REDIS_COMMAND(watch, "WATCH", 5, -2, noscript, 1, -1, 1)                                                      \
+  __CPP_REDIS_COMMAND(zadd, "ZADD", 4, -4, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(zcard, "ZCARD", 5, 2, readonly, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(zcount, "ZCOUNT", 6, 4, readonly, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(zincrby, "ZINCRBY", 7, 4, write, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(zinterstore, "ZINTERSTORE", 11, -4, write | movablekeys, 0, 0, 0)                               \
+  __CPP_REDIS_COMMAND(zlexcount, "ZLEXCOUNT", 9, 4, readonly, 1, 1, 1)                                                \
+  __CPP_REDIS_COMMAND(zrange, "ZRANGE", 6, -4, readonly, 1, 1, 1)                                                     \
+  __CPP_REDIS_COMMAND(zrangebylex, "ZRANGEBYLEX", 11, -4, readonly, 1, 1, 1)                                          \
+  __CPP_REDIS_COMMAND(zrangebyscore, "ZRANGEBYSCORE", 13, -4, readonly, 1, 1, 1)                                      \
+  __CPP_REDIS_COMMAND(zrank, "ZRANK", 5, 3, readonly, 1, 1, 1)                                                        \
+  __CPP_REDIS_COMMAND(zrem, "ZREM", 4, -3, write, 1, 1, 1)                                                            \
+  __CPP_REDIS_COMMAND(zremrangebylex, "ZREMRANGEBYLEX", 14, 4, write, 1, 1, 1)                                        \
+  __CPP_REDIS_COMMAND(zremrangebyrank, "ZREMRANGEBYRANK", 15, 4, write, 1, 1, 1)                                      \
+  __CPP_REDIS_COMMAND(zremrangebyscore, "ZREMRANGEBYSCORE", 16, 4, write, 1, 1, 1)                                    \
+  __CPP_REDIS_COMMAND(zrevrange, "ZREVRANGE", 9, -4, readonly, 1, 1, 1)                                               \
+  __CPP_REDIS_COMMAND(zrevrangebylex, "ZREVRANGEBYLEX", 14, -4, readonly, 1, 1, 1)                                    \
+  __CPP_REDIS_COMMAND(zrevrangebyscore, "ZREVRANGEBYSCORE", 16, -4, readonly, 1, 1, 1)                                \
+  __CPP_REDIS_COMMAND(zrevrank, "ZREVRANK", 8, 3, readonly, 1, 1, 1)                                                  \
+  __CPP_REDIS_COMMAND(zscan, "ZSCAN", 5, -3, readonly, 1, 1, 1)                                                       \
+  __CPP_REDIS_COMMAND(zscore, "ZSCORE", 6, 3, readonly, 1, 1, 1)                                                      \
+  __CPP_REDIS_COMMAND(zunionstore, "ZUNIONSTORE", 11, -4, write | movablekeys, 0, 0, 0)
+
+namespace cpp_redis {
+
+//!
+//! identifiers of the commands of the command table
+//!
+enum class command_id : std::uint16_t {
+#define __CPP_REDIS_COMMAND(id, name, name_len, arity, flags, first_key, last_key, key_step) id,
+#define __CPP_REDIS_SUBCOMMAND(id, name, name_len, sub, sub_len, arity, flags, first_key, last_key, key_step) id,
+  __CPP_REDIS_COMMAND_LIST(__CPP_REDIS_COMMAND, __CPP_REDIS_SUBCOMMAND)
+#undef __CPP_REDIS_COMMAND
+#undef __CPP_REDIS_SUBCOMMAND
+};
+
+//!
+//! constant part of a command, pre-encoded at compile time, and its metadata
+//!
+struct command_descriptor {
+  //!
+  //! name (and subcommand) of the command, encoded as bulk strings ("$3\r\nSET\r\n")
+  //!
+  const char*   pHeader;
+
+  //!
+  //! number of bytes of pHeader
+  //!
+  std::size_t   uHeaderSize;
+
+  //!
+  //! number of bulk strings of pHeader (2 for commands with a subcommand)
+  //!
+  std::size_t   uNbParts;
+
+  //!
+  //! number of arguments, name included, negative when it is a minimum
+  //!
+  int           nArity;
+
+  //!
+  //! combination of command_table::flag
+  //!
+  std::uint32_t uFlags;
+
+  //!
+  //! position of the first key (0 if none)
+  //!
+  int           nFirstKey;
+
+  //!
+  //! position of the last key (negative to count from the end)
+  //!
+  int           nLastKey;
+
+  //!
+  //! step between two keys
+  //!
+  int           nKeyStep;
+};
+
+//!
+//! compile-time table of the commands sent by the client
+//! commands are encoded by copying their pre-encoded header, and the table gives a single place to look up metadata
+//! such as key positions or the readonly flag (to route commands in a cluster, for instance)
+//!
+class command_table {
+public:
+  //!
+  //! flags of a command
+  //!
+  enum flag : std::uint32_t {
+    none        = 0,
+    write       = 1 << 0,
+    readonly    = 1 << 1,
+    admin       = 1 << 2,
+    blocking    = 1 << 3,
+    pubsub      = 1 << 4,
+    movablekeys = 1 << 5,
+    noscript    = 1 << 6
+  };
+
+public:
+  //!
+  //! \param id command identifier
+  //! \return descriptor of the command
+  //!
+  static constexpr const command_descriptor&
+  get(command_id id) {
+    return s_commands[static_cast<std::size_t>(id)];
+  }
+
+  //!
+  //! \param id command identifier
+  //! \param flag flag to be checked
+  //! \return whether the command has the given flag
+  //!
+  static constexpr bool
+  has_flag(command_id id, flag eFlag) {
+    return (get(id).uFlags & eFlag) != 0;
+  }
+
+  //!
+  //! \return number of commands of the table
+  //!
+  static constexpr std::size_t
+  size(void) {
+    return sizeof(s_commands) / sizeof(s_commands[0]);
+  }
+
+private:
+  //!
+  //! descriptors, indexed by command_id
+  //!
+  static constexpr command_descriptor s_commands[] = {
+#define __CPP_REDIS_COMMAND_HEADER(name, name_len) "$" #name_len "\r\n" name "\r\n"
+#define __CPP_REDIS_COMMAND(id, name, name_len, arity, flags, first_key, last_key, key_step)                       \
+  {__CPP_REDIS_COMMAND_HEADER(name, name_len), sizeof(__CPP_REDIS_COMMAND_HEADER(name, name_len)) - 1, 1, arity,   \
+    flags, first_key, last_key, key_step},
+#define __CPP_REDIS_SUBCOMMAND(id, name, name_len, sub, sub_len, arity, flags, first_key, last_key, key_step)      \
+  {__CPP_REDIS_COMMAND_HEADER(name, name_len) __CPP_REDIS_COMMAND_HEADER(sub, sub_len),                            \
+    sizeof(__CPP_REDIS_COMMAND_HEADER(name, name_len) __CPP_REDIS_COMMAND_HEADER(sub, sub_len)) - 1, 2, arity,     \
+    flags, first_key, last_key, key_step},
+    __CPP_REDIS_COMMAND_LIST(__CPP_REDIS_COMMAND, __CPP_REDIS_SUBCOMMAND)
+#undef __CPP_REDIS_COMMAND
+#undef __CPP_REDIS_SUBCOMMAND
+#undef __CPP_REDIS_COMMAND_HEADER
+  };
+};
+
+} // namespace cpp_redis
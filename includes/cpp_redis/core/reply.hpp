@@ -30,6 +30,12 @@
 
 namespace cpp_redis {
 
+namespace builders {
+
+class reply_pool;
+
+} // namespace builders
+
 //!
 //! cpp_redis::reply is the class that wraps Redis server replies.
 //! That is, cpp_redis::reply objects are passed as parameters of commands callbacks and contain the server's response.
@@ -78,6 +84,14 @@ public:
   //!
   reply(const std::string& value, string_type reply_type);
 
+  //!
+  //! ctor for string values (move the string into the reply)
+  //!
+  //! \param value string value
+  //! \param reply_type of string reply
+  //!
+  reply(std::string&& value, string_type reply_type);
+
   //!
   //! ctor for int values
   //!
@@ -93,12 +107,24 @@ public:
   //!
   explicit reply(const std::vector<reply>& rows);
 
+  //!
+  //! ctor for array values (move the rows into the reply)
+  //!
+  //! \param rows array reply
+  //! \return current instance
+  //!
+  explicit reply(std::vector<reply>&& rows);
+
   //! dtor
-  ~reply(void) = default;
+  ~reply(void);
   //! copy ctor
-  reply(const reply&) = default;
+  reply(const reply&);
   //! assignment operator
-  reply& operator=(const reply&) = default;
+  reply& operator=(const reply&);
+  //! move ctor
+  reply(reply&&) noexcept;
+  //! move assignment operator
+  reply& operator=(reply&&) noexcept;
 
 public:
   //!
@@ -173,6 +199,27 @@ public:
   //!
   int64_t as_integer(void) const;
 
+public:
+  //!
+  //! \return the underlying error, or nullptr if the reply is not an error
+  //!
+  const std::string* try_error(void) const noexcept;
+
+  //!
+  //! \return the underlying array, or nullptr if the reply is not an array
+  //!
+  const std::vector<reply>* try_as_array(void) const noexcept;
+
+  //!
+  //! \return the underlying string, or nullptr if the reply is not a string
+  //!
+  const std::string* try_as_string(void) const noexcept;
+
+  //!
+  //! \return the underlying integer, or nullptr if the reply is not an integer
+  //!
+  const int64_t* try_as_integer(void) const noexcept;
+
 public:
   //!
   //! set reply as null
@@ -187,6 +234,14 @@ public:
   //!
   void set(const std::string& value, string_type reply_type);
 
+  //!
+  //! set a string reply (move the string into the reply)
+  //!
+  //! \param value string value
+  //! \param reply_type of string reply
+  //!
+  void set(std::string&& value, string_type reply_type);
+
   //!
   //! set an integer reply
   //!
@@ -201,6 +256,13 @@ public:
   //!
   void set(const std::vector<reply>& rows);
 
+  //!
+  //! set an array reply (move the rows into the reply)
+  //!
+  //! \param rows array reply
+  //!
+  void set(std::vector<reply>&& rows);
+
   //!
   //! for array replies, add a new row to the reply
   //!
@@ -209,6 +271,14 @@ public:
   //!
   reply& operator<<(const reply& reply);
 
+  //!
+  //! for array replies, add a new row to the reply (move the row into the reply)
+  //!
+  //! \param reply new row to be appended
+  //! \return current instance
+  //!
+  reply& operator<<(reply&& reply);
+
 public:
   //!
   //! \return reply type
@@ -216,10 +286,48 @@ public:
   type get_type(void) const;
 
 private:
-  type                          m_eType;
-  std::vector<cpp_redis::reply> m_vctRows;
-  std::string                   m_sValue;
-  int64_t                       m_nValue;
+  //!
+  //! the reply pool recycles the storage of released replies
+  //!
+  friend class builders::reply_pool;
+
+private:
+  //!
+  //! destroy the active member of the union (the reply is left without any active member)
+  //!
+  void destroy(void) noexcept;
+
+  //!
+  //! switch the active member of the union to the rows (no-op if the reply already is an array)
+  //!
+  void become_array(void);
+
+  //!
+  //! copy the value of another reply into the current one, whose union has no active member
+  //!
+  //! \param other reply to be copied
+  //!
+  void construct_from(const reply& other);
+
+  //!
+  //! move the value of another reply into the current one, whose union has no active member
+  //!
+  //! \param other reply to be moved, left as a null reply
+  //!
+  void construct_from(reply&& other) noexcept;
+
+private:
+  type m_eType;
+
+  //!
+  //! only the member matching m_eType is alive: strings (error, bulk_string, simple_string) keep their characters inline
+  //! when small enough, integers and nulls do not allocate at all and arrays only pay for their rows
+  //!
+  union {
+    std::vector<cpp_redis::reply> m_vctRows;
+    std::string                   m_sValue;
+    int64_t                       m_nValue;
+  };
 };
 
 } // namespace cpp_redis
@@ -0,0 +1,170 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <optional>
+#endif /* __cplusplus >= 201703L */
+
+#include <cpp_redis/core/reply.hpp>
+#include <cpp_redis/core/reply_view.hpp>
+
+#include <stdint.h>
+
+namespace cpp_redis {
+
+//!
+//! reply_decoder<T> decodes a reply_view straight into a T, without building the intermediate reply tree.
+//! Decoders are provided for strings, integral and floating point types, reply, std::pair, std::vector,
+//! std::map, std::unordered_map (and std::optional in C++17). Flat arrays of pairs such as the replies of
+//! HGETALL or ZRANGE ... WITHSCORES are decoded two elements at a time into vectors of pairs and maps.
+//! Specialize it to decode into other types:
+//!
+//!   template <>
+//!   struct reply_decoder<my_type> {
+//!     static void decode(const reply_view& reply, my_type& value);
+//!   };
+//!
+//! Decoders throw redis_error when the reply does not have the expected type.
+//!
+template <typename T, typename Enable = void>
+struct reply_decoder;
+
+//!
+//! decode a reply into a default-constructed T using reply_decoder<T>
+//!
+//! \param reply reply to be decoded
+//! \return decoded value
+//!
+template <typename T>
+T decode_reply(const reply_view& reply);
+
+namespace decoding {
+
+//!
+//! \param reply integer reply, or string reply containing an integer (in the range of int64_t)
+//! \return converted integer
+//!
+int64_t to_integer(const reply_view& reply);
+
+//!
+//! \param reply string reply containing a floating point number (such as a sorted set score), or integer reply
+//! \return converted number
+//!
+double to_double(const reply_view& reply);
+
+} // namespace decoding
+
+//!
+//! decode string replies (simple string, bulk string, error)
+//!
+template <>
+struct reply_decoder<std::string> {
+  static void decode(const reply_view& reply, std::string& value);
+};
+
+//!
+//! build a complete reply (fallback for heterogeneous replies)
+//!
+template <>
+struct reply_decoder<reply> {
+  static void decode(const reply_view& reply, cpp_redis::reply& value);
+};
+
+//!
+//! decode integer replies, or string replies containing an integer
+//! throws redis_error if the integer does not fit in T
+//!
+template <typename T>
+struct reply_decoder<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  static void decode(const reply_view& reply, T& value);
+};
+
+//!
+//! decode string replies containing a floating point number, or integer replies
+//!
+template <typename T>
+struct reply_decoder<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static void decode(const reply_view& reply, T& value);
+};
+
+//!
+//! decode an array of two elements
+//!
+template <typename T1, typename T2>
+struct reply_decoder<std::pair<T1, T2>> {
+  static void decode(const reply_view& reply, std::pair<T1, T2>& value);
+};
+
+//!
+//! decode an array, element by element
+//!
+template <typename T, typename Allocator>
+struct reply_decoder<std::vector<T, Allocator>> {
+  static void decode(const reply_view& reply, std::vector<T, Allocator>& value);
+};
+
+//!
+//! decode a flat array of pairs (key1, value1, key2, value2...)
+//!
+template <typename T1, typename T2, typename Allocator>
+struct reply_decoder<std::vector<std::pair<T1, T2>, Allocator>> {
+  static void decode(const reply_view& reply, std::vector<std::pair<T1, T2>, Allocator>& value);
+};
+
+//!
+//! decode a flat array of pairs (key1, value1, key2, value2...)
+//!
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct reply_decoder<std::map<Key, T, Compare, Allocator>> {
+  static void decode(const reply_view& reply, std::map<Key, T, Compare, Allocator>& value);
+};
+
+//!
+//! decode a flat array of pairs (key1, value1, key2, value2...)
+//!
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct reply_decoder<std::unordered_map<Key, T, Hash, KeyEqual, Allocator>> {
+  static void decode(const reply_view& reply, std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& value);
+};
+
+#if __cplusplus >= 201703L
+//!
+//! decode null replies as std::nullopt, other replies with reply_decoder<T>
+//!
+template <typename T>
+struct reply_decoder<std::optional<T>> {
+  static void decode(const reply_view& reply, std::optional<T>& value);
+};
+#endif /* __cplusplus >= 201703L */
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/reply_decoder.ipp>
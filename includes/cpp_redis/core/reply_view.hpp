@@ -0,0 +1,282 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+#include <cpp_redis/core/reply.hpp>
+#include <cpp_redis/misc/string_ref.hpp>
+
+#include <stdint.h>
+
+namespace cpp_redis {
+
+//!
+//! cpp_redis::reply_view is a non-owning equivalent of cpp_redis::reply.
+//! Instead of copying the content of the reply into strings and vectors, it points into the raw redis protocol data
+//! of the reply (usually the receive buffer of the connection): strings are returned as string_ref and array
+//! elements are decoded lazily, when accessed.
+//! A reply_view is only valid as long as the data it points to: views passed to callbacks must not be kept once
+//! the callback returns (use to_reply() to get an owning copy).
+//!
+class reply_view {
+public:
+  //!
+  //! type of reply, same as reply::type
+  //!
+  typedef reply::type type;
+
+  //!
+  //! forward iterator over the elements of an array reply
+  //!
+  class const_iterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef reply_view                value_type;
+    typedef std::ptrdiff_t            difference_type;
+    typedef const reply_view*         pointer;
+    typedef reply_view                reference;
+
+  public:
+    //!
+    //! default ctor (end iterator)
+    //!
+    const_iterator(void);
+
+    //!
+    //! ctor
+    //!
+    //! \param data first byte of the element pointed to by the iterator
+    //! \param end end of the data in which the elements are stored
+    //! \param remaining number of elements left, including the one pointed to by the iterator
+    //!
+    const_iterator(const char* data, const char* end, std::size_t remaining);
+
+  public:
+    //!
+    //! \return view on the current element
+    //!
+    reply_view operator*(void) const;
+
+    //!
+    //! move to the next element
+    //!
+    //! \return current instance
+    //!
+    const_iterator& operator++(void);
+
+    //!
+    //! move to the next element
+    //!
+    //! \return iterator before the move
+    //!
+    const_iterator operator++(int);
+
+    //!
+    //! \param other iterator to compare to
+    //! \return whether both iterators point to the same element
+    //!
+    bool operator==(const const_iterator& other) const;
+
+    //!
+    //! \param other iterator to compare to
+    //! \return whether the iterators point to different elements
+    //!
+    bool operator!=(const const_iterator& other) const;
+
+  private:
+    //!
+    //! first byte of the current element
+    //!
+    const char* m_pData;
+
+    //!
+    //! end of the data
+    //!
+    const char* m_pEnd;
+
+    //!
+    //! number of elements left, including the current one
+    //!
+    std::size_t m_uRemaining;
+  };
+
+public:
+  //!
+  //! default ctor (null reply)
+  //!
+  reply_view(void);
+
+  //!
+  //! ctor
+  //! data must start with a complete and valid reply (as validated by reply_parser), trailing bytes are ignored
+  //!
+  //! \param data raw redis protocol data of the reply
+  //! \param size number of bytes available at data
+  //!
+  reply_view(const char* data, std::size_t size);
+
+  //! dtor
+  ~reply_view(void) = default;
+  //! copy ctor
+  reply_view(const reply_view&) = default;
+  //! assignment operator
+  reply_view& operator=(const reply_view&) = default;
+
+public:
+  //!
+  //! \return whether the reply is an array
+  //!
+  bool is_array(void) const;
+
+  //!
+  //! \return whether the reply is a string (simple, bulk, error)
+  //!
+  bool is_string(void) const;
+
+  //!
+  //! \return whether the reply is a simple string
+  //!
+  bool is_simple_string(void) const;
+
+  //!
+  //! \return whether the reply is a bulk string
+  //!
+  bool is_bulk_string(void) const;
+
+  //!
+  //! \return whether the reply is an error
+  //!
+  bool is_error(void) const;
+
+  //!
+  //! \return whether the reply is an integer
+  //!
+  bool is_integer(void) const;
+
+  //!
+  //! \return whether the reply is null
+  //!
+  bool is_null(void) const;
+
+public:
+  //!
+  //! \return true if function is not an error
+  //!
+  bool ok(void) const;
+
+  //!
+  //! \return true if function is an error
+  //!
+  bool ko(void) const;
+
+  //!
+  //! convenience implicit conversion, same as !is_null() / ok()
+  //!
+  operator bool() const;
+
+public:
+  //!
+  //! \return the underlying error
+  //!
+  string_ref error(void) const;
+
+  //!
+  //! \return the underlying string
+  //!
+  string_ref as_string(void) const;
+
+  //!
+  //! \return the underlying integer
+  //!
+  int64_t as_integer(void) const;
+
+  //!
+  //! \return number of elements of the underlying array
+  //!
+  std::size_t size(void) const;
+
+  //!
+  //! element access for array replies
+  //! elements are not indexed: the previous elements are skipped on each call, prefer iterators for sequential access
+  //!
+  //! \param index position of the element
+  //! \return view on the element
+  //!
+  reply_view operator[](std::size_t index) const;
+
+  //!
+  //! \return iterator to the first element of the underlying array
+  //!
+  const_iterator begin(void) const;
+
+  //!
+  //! \return iterator past the last element of the underlying array
+  //!
+  const_iterator end(void) const;
+
+public:
+  //!
+  //! \return owning copy of the reply
+  //!
+  reply to_reply(void) const;
+
+  //!
+  //! \return reply type
+  //!
+  type get_type(void) const;
+
+  //!
+  //! \param data first byte of a complete and valid reply
+  //! \param end end of the data in which the reply is stored
+  //! \return first byte following the reply
+  //!
+  static const char* skip(const char* data, const char* end);
+
+private:
+  type        m_eType;
+
+  //!
+  //! first character of the string, or first byte of the first element of the array
+  //!
+  const char* m_pData;
+
+  //!
+  //! end of the data in which the reply is stored
+  //!
+  const char* m_pEnd;
+
+  //!
+  //! size of the string, or number of elements of the array
+  //!
+  std::size_t m_uSize;
+
+  int64_t     m_nValue;
+};
+
+} // namespace cpp_redis
+
+//! support for output
+std::ostream& operator<<(std::ostream& os, const cpp_redis::reply_view& reply);
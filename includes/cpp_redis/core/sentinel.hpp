@@ -28,6 +28,7 @@
 #include <vector>
 
 #include <cpp_redis/misc/logger.hpp>
+#include <cpp_redis/misc/unique_function.hpp>
 #include <cpp_redis/network/redis_connection.hpp>
 
 namespace cpp_redis {
@@ -67,6 +68,11 @@ public:
   //!
   typedef std::function<void(reply&)> reply_callback_t;
 
+  //!
+  //! storage of the callbacks of pending commands: move-only, small callables being stored without allocation
+  //!
+  typedef unique_function<void(reply&)> stored_reply_callback_t;
+
   //!
   //! send the given command
   //! the command is actually pipelined and only buffered, so nothing is sent to the network
@@ -326,7 +332,7 @@ private:
   //!
   //! queue of callback to process
   //!
-  std::queue<reply_callback_t>      m_queCallbacks;
+  std::queue<stored_reply_callback_t> m_queCallbacks;
 
   //!
   //! user defined disconnection handler to be called on disconnection
@@ -29,6 +29,7 @@
 #include <string>
 
 #include <cpp_redis/core/sentinel.hpp>
+#include <cpp_redis/misc/unique_function.hpp>
 #include <cpp_redis/network/redis_connection.hpp>
 #include <cpp_redis/network/tcp_client_iface.hpp>
 
@@ -264,10 +265,11 @@ public:
 private:
   //!
   //! struct to hold callbacks (sub and ack) for a given channel or pattern
+  //! the callbacks are moved around on resubscription, never copied
   //!
   struct callback_holder {
-    subscribe_callback_t subscribe_callback;
-    acknowledgement_callback_t acknowledgement_callback;
+    unique_function<void(const std::string&, const std::string&)> subscribe_callback;
+    unique_function<void(int64_t)> acknowledgement_callback;
   };
 
 private:
@@ -360,22 +362,18 @@ private:
   //! same as subscribe, but without any mutex lock
   //!
   //! \param channel channel to subscribe
-  //! \param callback callback to be called whenever a message is received for this channel
-  //! \param acknowledgement_callback callback to be called on subscription completion (nullable)
+  //! \param callbacks callbacks to be called whenever a message is received for this channel, and on subscription
   //!
-  void unprotected_subscribe(const std::string& channel, const subscribe_callback_t& callback,
-      const acknowledgement_callback_t& acknowledgement_callback);
+  void unprotected_subscribe(const std::string& channel, callback_holder&& callbacks);
 
   //!
   //! unprotected psub
   //! same as psubscribe, but without any mutex lock
   //!
   //! \param pattern pattern to psubscribe
-  //! \param callback callback to be called whenever a message is received for this pattern
-  //! \param acknowledgement_callback callback to be called on subscription completion (nullable)
+  //! \param callbacks callbacks to be called whenever a message is received for this pattern, and on subscription
   //!
-  void unprotected_psubscribe(const std::string& pattern, const subscribe_callback_t& callback,
-      const acknowledgement_callback_t& acknowledgement_callback);
+  void unprotected_psubscribe(const std::string& pattern, callback_holder&& callbacks);
 
 private:
   //!
@@ -457,7 +455,7 @@ private:
   //!
   //! auth reply callback
   //!
-  reply_callback_t m_auth_reply_callback;
+  unique_function<void(reply&)> m_auth_reply_callback;
 };
 
 } // namespace cpp_redis
@@ -20,11 +20,259 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <exception>
 #include <functional>
 #include <iostream>
+#include <memory>
+
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/network/command_encoder.hpp>
 
 namespace cpp_redis {
 
+template <typename T>
+std::future<T>
+client::send_as(const std::vector<std::string>& redis_cmd) {
+  auto prms = std::make_shared<std::promise<T>>();
+
+  send(redis_cmd, [prms](const reply_view& reply) {
+    try {
+      if (reply.is_error())
+        throw redis_error(reply.error().to_string());
+
+      prms->set_value(decode_reply<T>(reply));
+    }
+    catch (...) {
+      prms->set_exception(std::current_exception());
+    }
+  });
+
+  return prms->get_future();
+}
+
+template <typename Callback,
+    typename std::enable_if<is_callable<typename std::decay<Callback>::type, reply&>::value, int>::type>
+client&
+client::send(const std::vector<std::string>& vctRedisCmd, Callback&& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(vctRedisCmd, vctFrame);
+  submit({std::move(vctFrame), nullptr, 0, take_callback(std::forward<Callback>(callback)), nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+template <typename Callback,
+    typename std::enable_if<!is_callable<typename std::decay<Callback>::type, reply&>::value
+                            && is_callable<typename std::decay<Callback>::type, const reply_view&>::value,
+        int>::type>
+client&
+client::send(const std::vector<std::string>& vctRedisCmd, Callback&& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(vctRedisCmd, vctFrame);
+  submit({std::move(vctFrame), nullptr, 0, nullptr, std::forward<Callback>(callback), nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+template <typename Callback, typename... Args>
+client&
+client::send_args(Callback&& callback, Args&&... args) {
+  std::vector<char> vctFrame;
+  network::command_encoder::encode_args(vctFrame, args...);
+
+  return send_encoded(std::move(vctFrame), take_callback(std::forward<Callback>(callback)));
+}
+
+template <typename... Args>
+client::command_frame::command_frame(const Args&... args)
+: m_uOffset(network::command_encoder::begin_frame(m_vctFrame))
+, m_uNbArgs(network::command_encoder::append_args(m_vctFrame, args...)) {}
+
+template <typename... Args>
+void
+client::command_frame::push_back(const Args&... args) {
+  m_uNbArgs += network::command_encoder::append_args(m_vctFrame, args...);
+}
+
+inline std::vector<char>
+client::command_frame::release(std::size_t uExtraArgs) {
+  network::command_encoder::end_frame(m_vctFrame, m_uOffset, m_uNbArgs + uExtraArgs);
+  return std::move(m_vctFrame);
+}
+
+template <typename... Args>
+void
+client::send_shared_args(const reply_callback_t& callback, const shared_value_t& value, const Args&... args) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  //! the value is kept aside, to be written without being copied
+  command_frame frame(args...);
+  submit({frame.release(1), value ? value : std::make_shared<const std::string>(), 0, take_callback(callback),
+      nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+}
+
+template <typename... Args>
+void
+client::unprotected_send_args(const reply_callback_t& callback, const Args&... args) {
+  command_request request = {{}, nullptr, 0, take_callback(callback), nullptr, nullptr};
+
+  network::command_encoder::encode_args(request.vctFrame, args...);
+  request.uSize = request.vctFrame.size();
+
+  m_uPendingBytes_a += request.uSize;
+  m_uPendingCommands_a += 1;
+
+  unprotected_send(std::move(request));
+}
+
+template <typename... Args>
+client::reply_future_t
+client::send_args_future(Args&&... args) {
+  std::vector<char> vctFrame;
+  network::command_encoder::encode_args(vctFrame, args...);
+
+  return send_encoded(std::move(vctFrame));
+}
+
+template <typename Task>
+client::reply_future_t
+client::exec_cmd(const Task& task) {
+  //! the named command method may keep copies of its std::function callback: they share the ownership of the promise
+  auto ptrPromise = std::make_shared<reply_promise_t>();
+  reply_future_t future = ptrPromise->get_future();
+
+  task([ptrPromise](reply& r) { ptrPromise->set_value(std::move(r)); });
+
+  return future;
+}
+
+template <typename Callback>
+client::stored_reply_callback_t
+client::take_callback(Callback&& callback) {
+  return stored_reply_callback_t(std::forward<Callback>(callback));
+}
+
+template <typename Callback, typename InputIt, typename... Prefix>
+void
+client::send_range(Callback&& callback, bool bBoolean, InputIt first, InputIt last, const Prefix&... prefix) {
+  auto ptrRequest = std::make_shared<bulk_request>();
+  ptrRequest->callback  = take_callback(std::forward<Callback>(callback));
+  ptrRequest->bBoolean  = bBoolean;
+  ptrRequest->uSent     = 0;
+  ptrRequest->uReceived = 0;
+  ptrRequest->bComplete = false;
+
+  //! the prefix is encoded once, and copied at the start of every command
+  std::vector<char> vctPrefix;
+  std::size_t uPrefixArgs = network::command_encoder::append_args(vctPrefix, prefix...);
+
+  //! at least one command is sent, so that an empty range gets the reply redis gives to a command without elements
+  do {
+    std::vector<char> vctFrame;
+    std::size_t uOffset = network::command_encoder::begin_frame(vctFrame);
+    vctFrame.insert(vctFrame.end(), vctPrefix.begin(), vctPrefix.end());
+
+    //! each command takes at least one element, whatever the limits
+    std::size_t uNbArgs = 0;
+    while (first != last && (!uNbArgs || ((!m_uBulkMaxArgs || uNbArgs < m_uBulkMaxArgs) &&
+                                            (!m_uBulkMaxBytes || vctFrame.size() < m_uBulkMaxBytes)))) {
+      uNbArgs += network::command_encoder::append_element(vctFrame, *first);
+      ++first;
+    }
+
+    network::command_encoder::end_frame(vctFrame, uOffset, uPrefixArgs + uNbArgs);
+
+    ptrRequest->mtx.lock();
+    ++ptrRequest->uSent;
+    ptrRequest->mtx.unlock();
+
+    send_encoded(std::move(vctFrame), bulk_reply_callback(ptrRequest));
+  } while (first != last);
+
+  complete_bulk_request(ptrRequest);
+}
+
+template <typename InputIt, typename... Prefix>
+client::reply_future_t
+client::send_range_future(bool bBoolean, InputIt first, InputIt last, const Prefix&... prefix) {
+  reply_promise_t promise;
+  reply_future_t future = promise.get_future();
+
+  send_range(future_callback(std::move(promise)), bBoolean, first, last, prefix...);
+
+  return future;
+}
+
+template <typename InputIt>
+client&
+client::hmset(const std::string& key, InputIt first, InputIt last, const reply_callback_t& reply_callback) {
+  send_range(reply_callback, false, first, last, command_id::hmset, key);
+  return *this;
+}
+
+template <typename InputIt>
+client::reply_future_t
+client::hmset(const std::string& key, InputIt first, InputIt last) {
+  return send_range_future(false, first, last, command_id::hmset, key);
+}
+
+template <typename InputIt>
+client&
+client::mset(InputIt first, InputIt last, const reply_callback_t& reply_callback) {
+  send_range(reply_callback, false, first, last, command_id::mset);
+  return *this;
+}
+
+template <typename InputIt>
+client::reply_future_t
+client::mset(InputIt first, InputIt last) {
+  return send_range_future(false, first, last, command_id::mset);
+}
+
+template <typename InputIt>
+client&
+client::pfadd(const std::string& key, InputIt first, InputIt last, const reply_callback_t& reply_callback) {
+  send_range(reply_callback, true, first, last, command_id::pfadd, key);
+  return *this;
+}
+
+template <typename InputIt>
+client::reply_future_t
+client::pfadd(const std::string& key, InputIt first, InputIt last) {
+  return send_range_future(true, first, last, command_id::pfadd, key);
+}
+
+template <typename InputIt>
+client&
+client::sadd(const std::string& key, InputIt first, InputIt last, const reply_callback_t& reply_callback) {
+  send_range(reply_callback, false, first, last, command_id::sadd, key);
+  return *this;
+}
+
+template <typename InputIt>
+client::reply_future_t
+client::sadd(const std::string& key, InputIt first, InputIt last) {
+  return send_range_future(false, first, last, command_id::sadd, key);
+}
+
+template <typename InputIt>
+client&
+client::zadd(const std::string& key, const std::vector<std::string>& options, InputIt first, InputIt last,
+    const reply_callback_t& reply_callback) {
+  send_range(reply_callback, false, first, last, command_id::zadd, key, options);
+  return *this;
+}
+
+template <typename InputIt>
+client::reply_future_t
+client::zadd(const std::string& key, const std::vector<std::string>& options, InputIt first, InputIt last) {
+  return send_range_future(false, first, last, command_id::zadd, key, options);
+}
+
 template <typename T>
 typename std::enable_if<std::is_same<T, client::client_type>::value>::type
 client::client_kill_unpack_arg(std::vector<std::string>& redis_cmd, reply_callback_t&, client_type type) {
@@ -118,7 +366,7 @@ client::client_kill(const char* host, int port, const Ts&... args) {
 }
 
 template <typename T, typename... Ts>
-std::future<reply>
+client::reply_future_t
 client::client_kill_future(const T arg, const Ts... args) {
   //! gcc 4.8 doesn't handle variadic template capture arguments (appears in 4.9)
   //! so std::bind should capture all arguments because of the compiler.
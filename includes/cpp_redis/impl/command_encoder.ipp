@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+namespace cpp_redis {
+
+namespace network {
+
+template <typename... Args>
+void
+command_encoder::encode_args(std::vector<char>& vctBuffer, const Args&... args) {
+  static_assert(sizeof...(Args) > 0, "a command has at least a name");
+
+  const std::size_t vctCounts[] = {arg_count(args)...};
+  const std::size_t vctSizes[]  = {arg_max_size(args)...};
+
+  std::size_t uNbArgs = 0;
+  std::size_t uSize   = 0;
+  for (std::size_t i = 0; i < sizeof...(Args); ++i) {
+    uNbArgs += vctCounts[i];
+    uSize += vctSizes[i];
+  }
+
+  //! the buffer is sized once for the worst case, and trimmed to the bytes actually written
+  std::size_t uOffset = vctBuffer.size();
+  vctBuffer.resize(uOffset + 1 + digits_count(uNbArgs) + 2 + uSize);
+
+  char* pDest      = write_header(vctBuffer.data() + uOffset, '*', uNbArgs);
+  char* vctDests[] = {(pDest = write_arg(pDest, args))...};
+  (void) vctDests;
+
+  vctBuffer.resize(pDest - vctBuffer.data());
+}
+
+template <typename... Args>
+std::size_t
+command_encoder::append_args(std::vector<char>& vctBuffer, const Args&... args) {
+  const std::size_t vctCounts[] = {arg_count(args)...};
+  const std::size_t vctSizes[]  = {arg_max_size(args)...};
+
+  std::size_t uNbArgs = 0;
+  std::size_t uSize   = 0;
+  for (std::size_t i = 0; i < sizeof...(Args); ++i) {
+    uNbArgs += vctCounts[i];
+    uSize += vctSizes[i];
+  }
+
+  std::size_t uOffset = vctBuffer.size();
+  vctBuffer.resize(uOffset + uSize);
+
+  char* pDest      = vctBuffer.data() + uOffset;
+  char* vctDests[] = {(pDest = write_arg(pDest, args))...};
+  (void) vctDests;
+
+  vctBuffer.resize(pDest - vctBuffer.data());
+
+  return uNbArgs;
+}
+
+template <typename T>
+std::size_t
+command_encoder::append_element(std::vector<char>& vctBuffer, const T& element) {
+  return append_args(vctBuffer, element);
+}
+
+template <typename T1, typename T2>
+std::size_t
+command_encoder::append_element(std::vector<char>& vctBuffer, const std::pair<T1, T2>& element) {
+  return append_args(vctBuffer, element.first, element.second);
+}
+
+template <typename T>
+std::size_t
+command_encoder::arg_count(const T&) {
+  return 1;
+}
+
+template <typename T>
+typename std::enable_if<command_encoder::is_integer_arg<T>::value, std::size_t>::type
+command_encoder::arg_max_size(T) {
+  //! sign and 19 digits, or 20 digits
+  return bulk_size(20);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::size_t>::type
+command_encoder::arg_max_size(T) {
+  return bulk_size(32);
+}
+
+template <typename T>
+typename std::enable_if<command_encoder::is_integer_arg<T>::value, char*>::type
+command_encoder::write_arg(char* pDest, T nValue) {
+  if (std::is_signed<T>::value)
+    return write_integer(pDest, static_cast<std::int64_t>(nValue));
+  else
+    return write_unsigned_integer(pDest, static_cast<std::uint64_t>(nValue));
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, char*>::type
+command_encoder::write_arg(char* pDest, T dValue) {
+  //! enough significant digits for the value to be read back exactly (9 for a float, 17 for a double)
+  return write_double(pDest, static_cast<double>(dValue), std::is_same<T, float>::value ? 9 : 17);
+}
+
+} // namespace network
+
+} // namespace cpp_redis
@@ -0,0 +1,155 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <thread>
+
+namespace cpp_redis {
+
+template <typename T>
+mpsc_queue<T>::mpsc_queue(std::size_t uFreeNodes)
+: m_pHead_a(nullptr)
+, m_pTail(new node(T()))
+, m_uFreeCapacity(0)
+, m_uFreeTake_a(0)
+, m_uFreePut(0) {
+  m_pHead_a.store(m_pTail, std::memory_order_relaxed);
+
+  if (uFreeNodes) {
+    m_uFreeCapacity = 1;
+    while (m_uFreeCapacity < uFreeNodes)
+      m_uFreeCapacity <<= 1;
+
+    m_arrFreeCells.reset(new free_cell[m_uFreeCapacity]);
+    for (std::size_t i = 0; i < m_uFreeCapacity; ++i) {
+      m_arrFreeCells[i].m_uSequence_a.store(i, std::memory_order_relaxed);
+      m_arrFreeCells[i].m_pNode = nullptr;
+    }
+  }
+}
+
+template <typename T>
+mpsc_queue<T>::~mpsc_queue(void) {
+  while (m_pTail) {
+    node* pNext = m_pTail->m_pNext_a.load(std::memory_order_relaxed);
+    delete m_pTail;
+    m_pTail = pNext;
+  }
+
+  for (std::size_t uPosition = m_uFreeTake_a.load(std::memory_order_relaxed); uPosition != m_uFreePut; ++uPosition)
+    delete m_arrFreeCells[uPosition & (m_uFreeCapacity - 1)].m_pNode;
+}
+
+template <typename T>
+void
+mpsc_queue<T>::push(T&& value) {
+  node* pNode = acquire_node();
+
+  if (pNode) {
+    pNode->m_value = std::move(value);
+    pNode->m_pNext_a.store(nullptr, std::memory_order_relaxed);
+  } else {
+    pNode = new node(std::move(value));
+  }
+
+  //! the node is published in two steps: producers are ordered by the exchange, and the consumer waits for the
+  //! link of the previous node when it reaches it before the second step
+  node* pPrevious = m_pHead_a.exchange(pNode, std::memory_order_acq_rel);
+  pPrevious->m_pNext_a.store(pNode, std::memory_order_release);
+}
+
+template <typename T>
+bool
+mpsc_queue<T>::pop(T& value) {
+  node* pNext = m_pTail->m_pNext_a.load(std::memory_order_acquire);
+
+  if (!pNext) {
+    if (m_pHead_a.load(std::memory_order_acquire) == m_pTail)
+      return false;
+
+    //! a producer exchanged the head but did not link its node yet
+    while (!(pNext = m_pTail->m_pNext_a.load(std::memory_order_acquire)))
+      std::this_thread::yield();
+  }
+
+  value = std::move(pNext->m_value);
+  release_node(m_pTail);
+  m_pTail = pNext;
+
+  return true;
+}
+
+template <typename T>
+typename mpsc_queue<T>::node*
+mpsc_queue<T>::acquire_node(void) {
+  if (!m_uFreeCapacity)
+    return nullptr;
+
+  std::size_t uPosition = m_uFreeTake_a.load(std::memory_order_relaxed);
+
+  for (;;) {
+    free_cell& cell        = m_arrFreeCells[uPosition & (m_uFreeCapacity - 1)];
+    std::size_t uSequence  = cell.m_uSequence_a.load(std::memory_order_acquire);
+    std::ptrdiff_t nFilled = static_cast<std::ptrdiff_t>(uSequence - (uPosition + 1));
+
+    if (nFilled < 0) {
+      //! the consumer did not fill this cell yet: no free node
+      return nullptr;
+    }
+
+    if (nFilled > 0) {
+      //! another producer took the node of this cell
+      uPosition = m_uFreeTake_a.load(std::memory_order_relaxed);
+    } else if (m_uFreeTake_a.compare_exchange_weak(uPosition, uPosition + 1, std::memory_order_relaxed)) {
+      //! the positions only grow: a cell is taken once per turn of the ring, without ABA issue
+      node* pNode = cell.m_pNode;
+      cell.m_uSequence_a.store(uPosition + m_uFreeCapacity, std::memory_order_release);
+      return pNode;
+    }
+  }
+}
+
+template <typename T>
+void
+mpsc_queue<T>::release_node(node* pNode) {
+  if (m_uFreeCapacity) {
+    free_cell& cell = m_arrFreeCells[m_uFreePut & (m_uFreeCapacity - 1)];
+
+    //! the cell can only be filled once its node of the previous turn was taken: otherwise the ring is full
+    if (cell.m_uSequence_a.load(std::memory_order_acquire) == m_uFreePut) {
+      cell.m_pNode = pNode;
+      cell.m_uSequence_a.store(m_uFreePut + 1, std::memory_order_release);
+      ++m_uFreePut;
+      return;
+    }
+  }
+
+  delete pNode;
+}
+
+template <typename T>
+bool
+mpsc_queue<T>::empty(void) const {
+  return m_pHead_a.load(std::memory_order_acquire) == m_pTail;
+}
+
+} // namespace cpp_redis
@@ -0,0 +1,436 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <thread>
+#include <utility>
+
+#include <cpp_redis/misc/error.hpp>
+
+namespace cpp_redis {
+
+template <typename T>
+completion_slot<T>::completion_slot(void)
+: m_value()
+, m_pException(nullptr)
+, m_nState_a(pending)
+, m_bSatisfied_a(false)
+, m_bRetrieved_a(false)
+, m_uPromises_a(0)
+, m_uRefs_a(0) {
+}
+
+template <typename T>
+completion_slot<T>::pool::~pool(void) {
+  for (completion_slot* pSlot : vctSlots)
+    delete pSlot;
+}
+
+template <typename T>
+typename completion_slot<T>::pool&
+completion_slot<T>::get_pool(void) {
+  static pool s_pool;
+  return s_pool;
+}
+
+template <typename T>
+completion_slot<T>::cache::~cache(void) {
+  //! the shared pool may already be destroyed when a thread exits after main returned: the slots are freed instead
+  while (uSize)
+    delete arrSlots[--uSize];
+}
+
+template <typename T>
+typename completion_slot<T>::cache&
+completion_slot<T>::get_cache(void) {
+  static thread_local cache s_cache = {{}, 0};
+  return s_cache;
+}
+
+template <typename T>
+void
+completion_slot<T>::refill(cache& slots) {
+  pool& shared = get_pool();
+  std::lock_guard<std::mutex> lock(shared.mtx);
+
+  while (slots.uSize < __CPP_REDIS_FUTURE_CACHE_SIZE / 2 && !shared.vctSlots.empty()) {
+    slots.arrSlots[slots.uSize++] = shared.vctSlots.back();
+    shared.vctSlots.pop_back();
+  }
+}
+
+template <typename T>
+void
+completion_slot<T>::flush(cache& slots) {
+  std::size_t uKept = __CPP_REDIS_FUTURE_CACHE_SIZE / 2;
+
+  {
+    pool& shared = get_pool();
+    std::lock_guard<std::mutex> lock(shared.mtx);
+
+    while (slots.uSize > uKept && shared.vctSlots.size() < __CPP_REDIS_FUTURE_POOL_SIZE)
+      shared.vctSlots.push_back(slots.arrSlots[--slots.uSize]);
+  }
+
+  while (slots.uSize > uKept)
+    delete slots.arrSlots[--slots.uSize];
+}
+
+template <typename T>
+completion_slot<T>*
+completion_slot<T>::acquire(void) {
+  cache& slots = get_cache();
+
+  //! the shared pool is only locked once every half a cache of slots
+  if (!slots.uSize)
+    refill(slots);
+
+  completion_slot* pSlot = slots.uSize ? slots.arrSlots[--slots.uSize] : new completion_slot;
+
+  pSlot->m_uPromises_a.store(1, std::memory_order_relaxed);
+  pSlot->m_uRefs_a.store(1, std::memory_order_relaxed);
+
+  return pSlot;
+}
+
+template <typename T>
+void
+completion_slot<T>::recycle(void) {
+  m_value      = T();
+  m_pException = nullptr;
+  m_nState_a.store(pending, std::memory_order_relaxed);
+  m_bSatisfied_a.store(false, std::memory_order_relaxed);
+  m_bRetrieved_a.store(false, std::memory_order_relaxed);
+
+  cache& slots = get_cache();
+
+  if (slots.uSize == __CPP_REDIS_FUTURE_CACHE_SIZE)
+    flush(slots);
+
+  slots.arrSlots[slots.uSize++] = this;
+}
+
+template <typename T>
+void
+completion_slot<T>::add_promise(void) {
+  m_uPromises_a.fetch_add(1, std::memory_order_relaxed);
+  m_uRefs_a.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+void
+completion_slot<T>::release_promise(void) {
+  if (m_uPromises_a.fetch_sub(1, std::memory_order_acq_rel) == 1 && !m_bSatisfied_a.exchange(true)) {
+    m_pException = std::make_exception_ptr(redis_error("broken promise"));
+    complete();
+  }
+
+  if (m_uRefs_a.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    recycle();
+}
+
+template <typename T>
+void
+completion_slot<T>::add_future(void) {
+  if (m_bRetrieved_a.exchange(true))
+    throw redis_error("future already retrieved");
+
+  m_uRefs_a.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+void
+completion_slot<T>::release_future(void) {
+  if (m_uRefs_a.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    recycle();
+}
+
+template <typename T>
+void
+completion_slot<T>::satisfy(void) {
+  if (m_bSatisfied_a.exchange(true))
+    throw redis_error("promise already satisfied");
+}
+
+template <typename T>
+void
+completion_slot<T>::set_value(T&& value) {
+  satisfy();
+  m_value = std::move(value);
+  complete();
+}
+
+template <typename T>
+void
+completion_slot<T>::set_exception(std::exception_ptr pException) {
+  satisfy();
+  m_pException = pException;
+  complete();
+}
+
+template <typename T>
+void
+completion_slot<T>::complete(void) {
+  if (m_nState_a.exchange(ready, std::memory_order_acq_rel) == parked) {
+    //! the waiting thread holds the mutex from the time it parks until it waits on the condition variable:
+    //! locking it guarantees the notification is not lost
+    { std::lock_guard<std::mutex> lock(m_mtx); }
+    m_cv.notify_all();
+  }
+}
+
+template <typename T>
+bool
+completion_slot<T>::is_ready(void) const {
+  return m_nState_a.load(std::memory_order_acquire) == ready;
+}
+
+template <typename T>
+bool
+completion_slot<T>::spin(void) const {
+  for (unsigned int i = 0; i < __CPP_REDIS_FUTURE_SPIN_COUNT; ++i) {
+    if (is_ready())
+      return true;
+
+    //! give the hand to the thread completing the slot if it shares our core
+    if (i >= __CPP_REDIS_FUTURE_SPIN_COUNT / 2)
+      std::this_thread::yield();
+  }
+
+  return is_ready();
+}
+
+template <typename T>
+void
+completion_slot<T>::wait(void) {
+  if (spin())
+    return;
+
+  std::unique_lock<std::mutex> lock(m_mtx);
+  int nExpected = pending;
+  if (!m_nState_a.compare_exchange_strong(nExpected, parked) && nExpected == ready)
+    return;
+
+  m_cv.wait(lock, [&] { return is_ready(); });
+}
+
+template <typename T>
+template <class Rep, class Period>
+bool
+completion_slot<T>::wait_for(const std::chrono::duration<Rep, Period>& duration) {
+  if (spin())
+    return true;
+
+  std::unique_lock<std::mutex> lock(m_mtx);
+  int nExpected = pending;
+  if (!m_nState_a.compare_exchange_strong(nExpected, parked) && nExpected == ready)
+    return true;
+
+  return m_cv.wait_for(lock, duration, [&] { return is_ready(); });
+}
+
+template <typename T>
+T
+completion_slot<T>::take(void) {
+  if (m_pException)
+    std::rethrow_exception(m_pException);
+
+  return std::move(m_value);
+}
+
+template <typename T>
+pooled_future<T>::pooled_future(void)
+: m_pSlot(nullptr) {
+}
+
+template <typename T>
+pooled_future<T>::pooled_future(completion_slot<T>* pSlot)
+: m_pSlot(pSlot) {
+}
+
+template <typename T>
+pooled_future<T>::~pooled_future(void) {
+  if (m_pSlot)
+    m_pSlot->release_future();
+}
+
+template <typename T>
+pooled_future<T>::pooled_future(pooled_future&& other) noexcept
+: m_pSlot(other.m_pSlot) {
+  other.m_pSlot = nullptr;
+}
+
+template <typename T>
+pooled_future<T>&
+pooled_future<T>::operator=(pooled_future&& other) {
+  if (this != &other) {
+    if (m_pSlot)
+      m_pSlot->release_future();
+
+    m_pSlot       = other.m_pSlot;
+    other.m_pSlot = nullptr;
+  }
+
+  return *this;
+}
+
+template <typename T>
+void
+pooled_future<T>::check_valid(void) const {
+  if (!m_pSlot)
+    throw redis_error("no associated state");
+}
+
+template <typename T>
+T
+pooled_future<T>::get(void) {
+  check_valid();
+  m_pSlot->wait();
+
+  //! the future is invalid afterwards, whether the value is returned or the exception rethrown
+  completion_slot<T>* pSlot = m_pSlot;
+  m_pSlot                   = nullptr;
+
+  try {
+    T value = pSlot->take();
+    pSlot->release_future();
+    return value;
+  }
+  catch (...) {
+    pSlot->release_future();
+    throw;
+  }
+}
+
+template <typename T>
+bool
+pooled_future<T>::valid(void) const {
+  return m_pSlot != nullptr;
+}
+
+template <typename T>
+bool
+pooled_future<T>::is_ready(void) const {
+  check_valid();
+  return m_pSlot->is_ready();
+}
+
+template <typename T>
+void
+pooled_future<T>::wait(void) const {
+  check_valid();
+  m_pSlot->wait();
+}
+
+template <typename T>
+template <class Rep, class Period>
+std::future_status
+pooled_future<T>::wait_for(const std::chrono::duration<Rep, Period>& duration) const {
+  check_valid();
+  return m_pSlot->wait_for(duration) ? std::future_status::ready : std::future_status::timeout;
+}
+
+template <typename T>
+pooled_promise<T>::pooled_promise(void)
+: m_pSlot(completion_slot<T>::acquire()) {
+}
+
+template <typename T>
+pooled_promise<T>::~pooled_promise(void) {
+  if (m_pSlot)
+    m_pSlot->release_promise();
+}
+
+template <typename T>
+pooled_promise<T>::pooled_promise(const pooled_promise& other)
+: m_pSlot(other.m_pSlot) {
+  if (m_pSlot)
+    m_pSlot->add_promise();
+}
+
+template <typename T>
+pooled_promise<T>&
+pooled_promise<T>::operator=(const pooled_promise& other) {
+  if (this != &other) {
+    if (other.m_pSlot)
+      other.m_pSlot->add_promise();
+
+    if (m_pSlot)
+      m_pSlot->release_promise();
+
+    m_pSlot = other.m_pSlot;
+  }
+
+  return *this;
+}
+
+template <typename T>
+pooled_promise<T>::pooled_promise(pooled_promise&& other) noexcept
+: m_pSlot(other.m_pSlot) {
+  other.m_pSlot = nullptr;
+}
+
+template <typename T>
+pooled_promise<T>&
+pooled_promise<T>::operator=(pooled_promise&& other) {
+  if (this != &other) {
+    if (m_pSlot)
+      m_pSlot->release_promise();
+
+    m_pSlot       = other.m_pSlot;
+    other.m_pSlot = nullptr;
+  }
+
+  return *this;
+}
+
+template <typename T>
+void
+pooled_promise<T>::check_valid(void) const {
+  if (!m_pSlot)
+    throw redis_error("no associated state");
+}
+
+template <typename T>
+pooled_future<T>
+pooled_promise<T>::get_future(void) {
+  check_valid();
+  m_pSlot->add_future();
+
+  return pooled_future<T>(m_pSlot);
+}
+
+template <typename T>
+void
+pooled_promise<T>::set_value(T&& value) {
+  check_valid();
+  m_pSlot->set_value(std::move(value));
+}
+
+template <typename T>
+void
+pooled_promise<T>::set_exception(std::exception_ptr pException) {
+  check_valid();
+  m_pSlot->set_exception(pException);
+}
+
+} // namespace cpp_redis
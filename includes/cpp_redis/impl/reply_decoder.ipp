@@ -0,0 +1,139 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/misc/error.hpp>
+
+namespace cpp_redis {
+
+template <typename T>
+T
+decode_reply(const reply_view& reply) {
+  T value;
+  reply_decoder<T>::decode(reply, value);
+
+  return value;
+}
+
+template <typename T>
+void
+reply_decoder<T, typename std::enable_if<std::is_integral<T>::value>::type>::decode(const reply_view& reply, T& value) {
+  int64_t nValue = decoding::to_integer(reply);
+  T converted    = static_cast<T>(nValue);
+
+  //! the value only fits in T if it converts back to itself, with the same sign
+  if (static_cast<int64_t>(converted) != nValue || (nValue < 0 && !std::is_signed<T>::value))
+    throw redis_error("Reply does not fit in the integer type");
+
+  value = converted;
+}
+
+template <typename T>
+void
+reply_decoder<T, typename std::enable_if<std::is_floating_point<T>::value>::type>::decode(const reply_view& reply, T& value) {
+  value = static_cast<T>(decoding::to_double(reply));
+}
+
+template <typename T1, typename T2>
+void
+reply_decoder<std::pair<T1, T2>>::decode(const reply_view& reply, std::pair<T1, T2>& value) {
+  if (reply.size() != 2)
+    throw redis_error("Reply is not a pair");
+
+  auto it = reply.begin();
+  reply_decoder<T1>::decode(*it, value.first);
+  reply_decoder<T2>::decode(*++it, value.second);
+}
+
+template <typename T, typename Allocator>
+void
+reply_decoder<std::vector<T, Allocator>>::decode(const reply_view& reply, std::vector<T, Allocator>& value) {
+  value.clear();
+  value.reserve(reply.size());
+
+  for (const auto& element : reply) {
+    value.emplace_back();
+    reply_decoder<T>::decode(element, value.back());
+  }
+}
+
+namespace decoding {
+
+//!
+//! decode each pair of a flat array of pairs and pass it to fn
+//!
+template <typename T1, typename T2, typename Function>
+void
+decode_pairs(const reply_view& reply, const Function& fn) {
+  if (reply.size() % 2)
+    throw redis_error("Reply is not an array of pairs");
+
+  for (auto it = reply.begin(); it != reply.end(); ++it) {
+    std::pair<T1, T2> pair;
+    reply_decoder<T1>::decode(*it, pair.first);
+    reply_decoder<T2>::decode(*++it, pair.second);
+    fn(pair);
+  }
+}
+
+} // namespace decoding
+
+template <typename T1, typename T2, typename Allocator>
+void
+reply_decoder<std::vector<std::pair<T1, T2>, Allocator>>::decode(const reply_view& reply, std::vector<std::pair<T1, T2>, Allocator>& value) {
+  value.clear();
+  value.reserve(reply.size() / 2);
+
+  decoding::decode_pairs<T1, T2>(reply, [&](std::pair<T1, T2>& pair) { value.push_back(std::move(pair)); });
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void
+reply_decoder<std::map<Key, T, Compare, Allocator>>::decode(const reply_view& reply, std::map<Key, T, Compare, Allocator>& value) {
+  value.clear();
+
+  decoding::decode_pairs<Key, T>(reply, [&](std::pair<Key, T>& pair) { value[std::move(pair.first)] = std::move(pair.second); });
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void
+reply_decoder<std::unordered_map<Key, T, Hash, KeyEqual, Allocator>>::decode(const reply_view& reply, std::unordered_map<Key, T, Hash, KeyEqual, Allocator>& value) {
+  value.clear();
+  value.reserve(reply.size() / 2);
+
+  decoding::decode_pairs<Key, T>(reply, [&](std::pair<Key, T>& pair) { value[std::move(pair.first)] = std::move(pair.second); });
+}
+
+#if __cplusplus >= 201703L
+template <typename T>
+void
+reply_decoder<std::optional<T>>::decode(const reply_view& reply, std::optional<T>& value) {
+  if (reply.is_null()) {
+    value.reset();
+    return;
+  }
+
+  value.emplace();
+  reply_decoder<T>::decode(reply, *value);
+}
+#endif /* __cplusplus >= 201703L */
+
+} // namespace cpp_redis
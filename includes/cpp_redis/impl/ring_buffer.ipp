@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <utility>
+
+namespace cpp_redis {
+
+template <typename T>
+ring_buffer<T>::ring_buffer(void)
+: m_uHead(0)
+, m_uSize(0) {
+}
+
+template <typename T>
+ring_buffer<T>::ring_buffer(ring_buffer&& other)
+: m_vctSlots(std::move(other.m_vctSlots))
+, m_uHead(other.m_uHead)
+, m_uSize(other.m_uSize) {
+  other.m_vctSlots.clear();
+  other.m_uHead = 0;
+  other.m_uSize = 0;
+}
+
+template <typename T>
+ring_buffer<T>&
+ring_buffer<T>::operator=(ring_buffer&& other) {
+  if (this != &other) {
+    m_vctSlots = std::move(other.m_vctSlots);
+    m_uHead    = other.m_uHead;
+    m_uSize    = other.m_uSize;
+
+    other.m_vctSlots.clear();
+    other.m_uHead = 0;
+    other.m_uSize = 0;
+  }
+
+  return *this;
+}
+
+template <typename T>
+void
+ring_buffer<T>::push_back(T&& value) {
+  if (m_uSize == m_vctSlots.size())
+    grow();
+
+  m_vctSlots[(m_uHead + m_uSize) & (m_vctSlots.size() - 1)] = std::move(value);
+  ++m_uSize;
+}
+
+template <typename T>
+void
+ring_buffer<T>::pop_front(void) {
+  m_vctSlots[m_uHead] = T();
+  m_uHead             = (m_uHead + 1) & (m_vctSlots.size() - 1);
+  --m_uSize;
+}
+
+template <typename T>
+T&
+ring_buffer<T>::front(void) {
+  return m_vctSlots[m_uHead];
+}
+
+template <typename T>
+T&
+ring_buffer<T>::operator[](std::size_t uIndex) {
+  return m_vctSlots[(m_uHead + uIndex) & (m_vctSlots.size() - 1)];
+}
+
+template <typename T>
+const T&
+ring_buffer<T>::operator[](std::size_t uIndex) const {
+  return m_vctSlots[(m_uHead + uIndex) & (m_vctSlots.size() - 1)];
+}
+
+template <typename T>
+std::size_t
+ring_buffer<T>::size(void) const {
+  return m_uSize;
+}
+
+template <typename T>
+bool
+ring_buffer<T>::empty(void) const {
+  return m_uSize == 0;
+}
+
+template <typename T>
+void
+ring_buffer<T>::clear(void) {
+  while (m_uSize)
+    pop_front();
+
+  m_uHead = 0;
+}
+
+template <typename T>
+void
+ring_buffer<T>::grow(void) {
+  std::vector<T> vctSlots(m_vctSlots.empty() ? 16 : m_vctSlots.size() * 2);
+
+  for (std::size_t i = 0; i < m_uSize; ++i)
+    vctSlots[i] = std::move((*this)[i]);
+
+  m_vctSlots.swap(vctSlots);
+  m_uHead = 0;
+}
+
+} // namespace cpp_redis
@@ -0,0 +1,215 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <new>
+#include <utility>
+
+namespace cpp_redis {
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>::unique_function(void)
+: m_pOperations(nullptr) {
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>::unique_function(std::nullptr_t)
+: m_pOperations(nullptr) {
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F, typename>
+unique_function<R(Args...), InlineSize>::unique_function(F&& f)
+: m_pOperations(nullptr) {
+  typedef typename std::decay<F>::type callable_t;
+
+  if (!is_null(f))
+    store(std::forward<F>(f), std::integral_constant<bool, fits_inline<callable_t>()>());
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>::~unique_function(void) {
+  if (m_pOperations)
+    m_pOperations->destroy(&m_storage);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>::unique_function(unique_function&& other) noexcept
+: m_pOperations(other.m_pOperations) {
+  if (m_pOperations) {
+    m_pOperations->move(&m_storage, &other.m_storage);
+    other.m_pOperations = nullptr;
+  }
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>&
+unique_function<R(Args...), InlineSize>::operator=(unique_function&& other) noexcept {
+  if (this != &other) {
+    *this = nullptr;
+
+    if (other.m_pOperations) {
+      m_pOperations = other.m_pOperations;
+      m_pOperations->move(&m_storage, &other.m_storage);
+      other.m_pOperations = nullptr;
+    }
+  }
+
+  return *this;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>&
+unique_function<R(Args...), InlineSize>::operator=(std::nullptr_t) {
+  if (m_pOperations) {
+    m_pOperations->destroy(&m_storage);
+    m_pOperations = nullptr;
+  }
+
+  return *this;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+R
+unique_function<R(Args...), InlineSize>::operator()(Args... args) const {
+  if (!m_pOperations)
+    throw std::bad_function_call();
+
+  return m_pOperations->invoke(&m_storage, std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+unique_function<R(Args...), InlineSize>::operator bool(void) const {
+  return m_pOperations != nullptr;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+constexpr bool
+unique_function<R(Args...), InlineSize>::fits_inline(void) {
+  //! the callable must not throw when moved: moving a unique_function never throws
+  return sizeof(F) <= sizeof(storage_t)
+    && std::alignment_of<storage_t>::value % std::alignment_of<F>::value == 0
+    && std::is_nothrow_move_constructible<F>::value;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+const typename unique_function<R(Args...), InlineSize>::operations*
+unique_function<R(Args...), InlineSize>::operations_for(std::true_type) {
+  static const operations s_operations = {&invoke_inline<F>, &move_inline<F>, &destroy_inline<F>};
+  return &s_operations;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+const typename unique_function<R(Args...), InlineSize>::operations*
+unique_function<R(Args...), InlineSize>::operations_for(std::false_type) {
+  static const operations s_operations = {&invoke_heap<F>, &move_heap, &destroy_heap<F>};
+  return &s_operations;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+R
+unique_function<R(Args...), InlineSize>::invoke_inline(void* pStorage, Args&&... args) {
+  return (*static_cast<F*>(pStorage))(std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+void
+unique_function<R(Args...), InlineSize>::move_inline(void* pDest, void* pSrc) {
+  new (pDest) F(std::move(*static_cast<F*>(pSrc)));
+  static_cast<F*>(pSrc)->~F();
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+void
+unique_function<R(Args...), InlineSize>::destroy_inline(void* pStorage) {
+  static_cast<F*>(pStorage)->~F();
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+R
+unique_function<R(Args...), InlineSize>::invoke_heap(void* pStorage, Args&&... args) {
+  return (**static_cast<F**>(pStorage))(std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+void
+unique_function<R(Args...), InlineSize>::move_heap(void* pDest, void* pSrc) {
+  //! only the pointer moves, the callable stays where it was allocated
+  *static_cast<void**>(pDest) = *static_cast<void**>(pSrc);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+void
+unique_function<R(Args...), InlineSize>::destroy_heap(void* pStorage) {
+  delete *static_cast<F**>(pStorage);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+bool
+unique_function<R(Args...), InlineSize>::is_null(const F&) {
+  return false;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename Signature>
+bool
+unique_function<R(Args...), InlineSize>::is_null(const std::function<Signature>& f) {
+  return !f;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename T>
+bool
+unique_function<R(Args...), InlineSize>::is_null(T* p) {
+  return p == nullptr;
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+void
+unique_function<R(Args...), InlineSize>::store(F&& f, std::true_type bInline) {
+  typedef typename std::decay<F>::type callable_t;
+
+  new (&m_storage) callable_t(std::forward<F>(f));
+  m_pOperations = operations_for<callable_t>(bInline);
+}
+
+template <typename R, typename... Args, std::size_t InlineSize>
+template <typename F>
+void
+unique_function<R(Args...), InlineSize>::store(F&& f, std::false_type bInline) {
+  typedef typename std::decay<F>::type callable_t;
+
+  *reinterpret_cast<callable_t**>(&m_storage) = new callable_t(std::forward<F>(f));
+  m_pOperations = operations_for<callable_t>(bInline);
+}
+
+} // namespace cpp_redis
@@ -0,0 +1,150 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+//!
+//! default number of consumed nodes each mpsc_queue keeps to be reused by the next pushes
+//!
+#ifndef __CPP_REDIS_MPSC_QUEUE_FREE_NODES
+#define __CPP_REDIS_MPSC_QUEUE_FREE_NODES 1024
+#endif /* __CPP_REDIS_MPSC_QUEUE_FREE_NODES */
+
+namespace cpp_redis {
+
+//!
+//! unbounded multi-producer single-consumer queue
+//! push never blocks (a single atomic exchange), elements are popped in the order their push completed
+//! pop must not be called concurrently: the consumer is expected to be serialized by its caller
+//! consumed nodes are handed back to the producers through a bounded lock-free ring: once as many elements as the
+//! ring holds have been consumed, push does not go through the allocator anymore
+//!
+template <typename T>
+class mpsc_queue {
+public:
+  //!
+  //! ctor
+  //!
+  //! \param free_nodes number of consumed nodes kept to be reused (rounded up to a power of 2, 0 to free them)
+  //!
+  explicit mpsc_queue(std::size_t uFreeNodes = __CPP_REDIS_MPSC_QUEUE_FREE_NODES);
+
+  //! dtor
+  ~mpsc_queue(void);
+
+  //! copy ctor & assignment operator
+  mpsc_queue(const mpsc_queue&) = delete;
+  mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+public:
+  //!
+  //! enqueue an element, from any thread, without any lock
+  //!
+  //! \param value element to be enqueued
+  //!
+  void push(T&& value);
+
+  //!
+  //! dequeue the first element (consumer only)
+  //! an element whose push is still in progress on another thread is waited for, so that false is only returned
+  //! when no push had started before the call
+  //!
+  //! \param value dequeued element (left untouched if the queue is empty)
+  //! \return whether an element has been dequeued
+  //!
+  bool pop(T& value);
+
+  //!
+  //! \return whether the queue is empty (consumer only, a push in progress counts as an element)
+  //!
+  bool empty(void) const;
+
+private:
+  //!
+  //! linked element, the first node of the list is a placeholder whose value has already been dequeued
+  //!
+  struct node {
+    explicit node(T&& value) : m_pNext_a(nullptr), m_value(std::move(value)) {}
+
+    std::atomic<node*> m_pNext_a;
+    T                  m_value;
+  };
+
+  //!
+  //! cell of the ring of free nodes
+  //! its sequence is its position when it can be filled, and its position + 1 once it holds a node to be taken
+  //! (taking the node moves the sequence to the position the cell has on the next turn of the ring)
+  //!
+  struct free_cell {
+    std::atomic<std::size_t> m_uSequence_a;
+    node*                    m_pNode;
+  };
+
+  //!
+  //! take a free node (producers)
+  //!
+  //! \return free node, or null if the ring is empty
+  //!
+  node* acquire_node(void);
+
+  //!
+  //! hand a consumed node back to the producers, or free it when the ring is full (consumer only)
+  //!
+  //! \param node consumed node
+  //!
+  void release_node(node* pNode);
+
+private:
+  //!
+  //! last pushed node, exchanged by the producers
+  //!
+  std::atomic<node*> m_pHead_a;
+
+  //!
+  //! placeholder node preceding the first element, only accessed by the consumer
+  //!
+  node* m_pTail;
+
+  //!
+  //! ring of free nodes, and its number of cells (0 or a power of 2)
+  //!
+  std::unique_ptr<free_cell[]> m_arrFreeCells;
+  std::size_t                  m_uFreeCapacity;
+
+  //!
+  //! position of the next free node to be taken, advanced by the producers
+  //!
+  std::atomic<std::size_t> m_uFreeTake_a;
+
+  //!
+  //! position of the next cell to be filled, only accessed by the consumer
+  //!
+  std::size_t m_uFreePut;
+};
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/mpsc_queue.ipp>
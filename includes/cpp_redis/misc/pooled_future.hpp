@@ -0,0 +1,344 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <vector>
+
+//!
+//! number of idle completion slots kept for reuse, per value type
+//!
+#ifndef __CPP_REDIS_FUTURE_POOL_SIZE
+#define __CPP_REDIS_FUTURE_POOL_SIZE 1024
+#endif /* __CPP_REDIS_FUTURE_POOL_SIZE */
+
+//!
+//! number of idle completion slots kept by each thread in front of the shared pool, per value type
+//! slots move between a thread cache and the shared pool half a cache at a time, under a single lock
+//!
+#ifndef __CPP_REDIS_FUTURE_CACHE_SIZE
+#define __CPP_REDIS_FUTURE_CACHE_SIZE 64
+#endif /* __CPP_REDIS_FUTURE_CACHE_SIZE */
+
+//!
+//! number of times a waiting thread polls the completion state before parking on a condition variable
+//!
+#ifndef __CPP_REDIS_FUTURE_SPIN_COUNT
+#define __CPP_REDIS_FUTURE_SPIN_COUNT 1024
+#endif /* __CPP_REDIS_FUTURE_SPIN_COUNT */
+
+namespace cpp_redis {
+
+//!
+//! shared state of a pooled_promise and its pooled_future
+//! slots are recycled through a per thread cache and a per type pool instead of being allocated for each promise
+//! completion is published through an atomic state: a waiting thread spins on it first, and only parks on the
+//! condition variable of the slot if the value does not come quickly
+//!
+template <typename T>
+class completion_slot {
+public:
+  //!
+  //! \return a pending slot, taken from the pool if possible, referenced by one promise
+  //!
+  static completion_slot* acquire(void);
+
+  //! copy ctor & assignment operator
+  completion_slot(const completion_slot&) = delete;
+  completion_slot& operator=(const completion_slot&) = delete;
+
+public:
+  //!
+  //! reference counting: promises and future
+  //! the slot goes back to the pool once the last reference is released
+  //! releasing the last promise reference of a pending slot breaks the promise (the future throws a redis_error)
+  //!
+  void add_promise(void);
+  void release_promise(void);
+  void add_future(void);
+  void release_future(void);
+
+  //!
+  //! complete the slot with a value or an exception
+  //! throws redis_error if already completed
+  //!
+  void set_value(T&& value);
+  void set_exception(std::exception_ptr pException);
+
+  //!
+  //! \return whether the slot has been completed
+  //!
+  bool is_ready(void) const;
+
+  //!
+  //! wait for completion, spinning first then parking
+  //!
+  void wait(void);
+
+  //!
+  //! wait for completion, for at most the given duration
+  //!
+  //! \return whether the slot has been completed
+  //!
+  template <class Rep, class Period>
+  bool wait_for(const std::chrono::duration<Rep, Period>& duration);
+
+  //!
+  //! \return the value of a completed slot (moved out), rethrowing its exception if any
+  //!
+  T take(void);
+
+private:
+  //! ctor & dtor: slots are only created and destroyed by the pool
+  completion_slot(void);
+  ~completion_slot(void) = default;
+
+  //!
+  //! completion state
+  //!
+  enum state {
+    pending = 0,
+    parked  = 1,
+    ready   = 2
+  };
+
+  //!
+  //! make sure the slot is completed only once
+  //!
+  void satisfy(void);
+
+  //!
+  //! publish the completion, waking up the waiting thread if it parked
+  //!
+  void complete(void);
+
+  //!
+  //! poll the completion state
+  //!
+  //! \return whether the slot has been completed before the spin count was reached
+  //!
+  bool spin(void) const;
+
+  //!
+  //! reset the slot and give it back to the pool
+  //!
+  void recycle(void);
+
+  //!
+  //! idle slots, shared by all the promises of a given value type
+  //!
+  struct pool {
+    ~pool(void);
+
+    std::mutex                   mtx;
+    std::vector<completion_slot*> vctSlots;
+  };
+
+  static pool& get_pool(void);
+
+  //!
+  //! idle slots of the current thread, taken and given back without any lock
+  //!
+  struct cache {
+    ~cache(void);
+
+    completion_slot* arrSlots[__CPP_REDIS_FUTURE_CACHE_SIZE];
+    std::size_t      uSize;
+  };
+
+  static cache& get_cache(void);
+
+  //!
+  //! move half a cache of slots from the shared pool to an empty thread cache
+  //!
+  static void refill(cache& slots);
+
+  //!
+  //! move half of a full thread cache to the shared pool, deleting the slots it has no room for
+  //!
+  static void flush(cache& slots);
+
+private:
+  //!
+  //! value or exception, only read once the state is ready
+  //!
+  T                  m_value;
+  std::exception_ptr m_pException;
+
+  //!
+  //! completion state (see enum state)
+  //!
+  std::atomic<int> m_nState_a;
+
+  //!
+  //! whether set_value or set_exception has been called
+  //!
+  std::atomic<bool> m_bSatisfied_a;
+
+  //!
+  //! whether a future has been retrieved
+  //!
+  std::atomic<bool> m_bRetrieved_a;
+
+  //!
+  //! references: promises, and promises plus future
+  //!
+  std::atomic<unsigned int> m_uPromises_a;
+  std::atomic<unsigned int> m_uRefs_a;
+
+  //!
+  //! used only when a waiting thread parks
+  //!
+  std::mutex              m_mtx;
+  std::condition_variable m_cv;
+};
+
+//!
+//! lightweight equivalent of std::future, backed by a pooled completion_slot
+//! the waiting thread spins on an atomic state before parking, and no allocation is made per future once the pool
+//! is warm
+//!
+template <typename T>
+class pooled_future {
+public:
+  //! ctor (invalid future)
+  pooled_future(void);
+
+  //! ctor from a slot already referenced for this future
+  explicit pooled_future(completion_slot<T>* pSlot);
+
+  //! dtor
+  ~pooled_future(void);
+
+  //! copy ctor & assignment operator
+  pooled_future(const pooled_future&) = delete;
+  pooled_future& operator=(const pooled_future&) = delete;
+
+  //! move ctor & assignment operator (the moved future is left invalid)
+  pooled_future(pooled_future&& other) noexcept;
+  pooled_future& operator=(pooled_future&& other);
+
+public:
+  //!
+  //! wait for the value and return it, rethrowing the exception set by the promise if any
+  //! the future is invalid afterwards
+  //!
+  //! \return value set by the promise
+  //!
+  T get(void);
+
+  //!
+  //! \return whether the future refers to a promise (not default constructed, moved or already retrieved)
+  //!
+  bool valid(void) const;
+
+  //!
+  //! \return whether the value (or exception) is available
+  //!
+  bool is_ready(void) const;
+
+  //!
+  //! wait for the value to be available
+  //!
+  void wait(void) const;
+
+  //!
+  //! wait for the value to be available, for at most the given duration
+  //!
+  //! \return std::future_status::ready, or std::future_status::timeout
+  //!
+  template <class Rep, class Period>
+  std::future_status wait_for(const std::chrono::duration<Rep, Period>& duration) const;
+
+private:
+  //!
+  //! throws redis_error if the future is invalid
+  //!
+  void check_valid(void) const;
+
+private:
+  completion_slot<T>* m_pSlot;
+};
+
+//!
+//! promise side of pooled_future
+//! copies share the same slot (like a std::shared_ptr<std::promise>), so that the promise can be captured by a
+//! copyable callback: the promise is broken once the last copy is destroyed without any value set
+//!
+template <typename T>
+class pooled_promise {
+public:
+  //! ctor & dtor
+  pooled_promise(void);
+  ~pooled_promise(void);
+
+  //! copy ctor & assignment operator
+  pooled_promise(const pooled_promise& other);
+  pooled_promise& operator=(const pooled_promise& other);
+
+  //! move ctor & assignment operator
+  //! moving does not throw, so that a callback owning the promise is stored inline in a unique_function
+  pooled_promise(pooled_promise&& other) noexcept;
+  pooled_promise& operator=(pooled_promise&& other);
+
+public:
+  //!
+  //! \return the future tied to this promise (can only be called once among all the copies, throws redis_error
+  //! otherwise)
+  //!
+  pooled_future<T> get_future(void);
+
+  //!
+  //! set the value, waking up the future
+  //! throws redis_error if a value or an exception was already set
+  //!
+  //! \param value value to be moved to the future
+  //!
+  void set_value(T&& value);
+
+  //!
+  //! set an exception, rethrown by the future
+  //! throws redis_error if a value or an exception was already set
+  //!
+  //! \param pException exception to be rethrown
+  //!
+  void set_exception(std::exception_ptr pException);
+
+private:
+  //!
+  //! throws redis_error if the promise has been moved
+  //!
+  void check_valid(void) const;
+
+private:
+  completion_slot<T>* m_pSlot;
+};
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/pooled_future.ipp>
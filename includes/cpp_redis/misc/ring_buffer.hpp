@@ -0,0 +1,113 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace cpp_redis {
+
+//!
+//! fifo queue stored in a single circular array, growing by doubling its capacity
+//! unlike std::deque, elements are stored contiguously in one allocation, which is kept when the queue empties
+//!
+template <typename T>
+class ring_buffer {
+public:
+  //! ctor & dtor
+  ring_buffer(void);
+  ~ring_buffer(void) = default;
+
+  //! copy ctor & assignment operator
+  ring_buffer(const ring_buffer&) = delete;
+  ring_buffer& operator=(const ring_buffer&) = delete;
+
+  //! move ctor & assignment operator (the moved queue is left empty)
+  ring_buffer(ring_buffer&& other);
+  ring_buffer& operator=(ring_buffer&& other);
+
+public:
+  //!
+  //! append an element at the end of the queue
+  //!
+  //! \param value element to be appended
+  //!
+  void push_back(T&& value);
+
+  //!
+  //! remove the first element, its slot being reset to release what it owns
+  //!
+  void pop_front(void);
+
+  //!
+  //! \return first element
+  //!
+  T& front(void);
+
+  //!
+  //! \param index position from the first element
+  //! \return element at the given position
+  //!
+  T& operator[](std::size_t uIndex);
+  const T& operator[](std::size_t uIndex) const;
+
+  //!
+  //! \return number of elements
+  //!
+  std::size_t size(void) const;
+
+  //!
+  //! \return whether the queue is empty
+  //!
+  bool empty(void) const;
+
+  //!
+  //! remove all the elements, keeping the capacity
+  //!
+  void clear(void);
+
+private:
+  //!
+  //! double the capacity, moving the elements to the beginning of the new array
+  //!
+  void grow(void);
+
+private:
+  //!
+  //! circular array, its size being the capacity (always a power of two)
+  //!
+  std::vector<T> m_vctSlots;
+
+  //!
+  //! position of the first element
+  //!
+  std::size_t m_uHead;
+
+  //!
+  //! number of elements
+  //!
+  std::size_t m_uSize;
+};
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/ring_buffer.ipp>
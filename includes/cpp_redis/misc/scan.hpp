@@ -0,0 +1,82 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+#include <stdint.h>
+
+//!
+//! define __CPP_REDIS_DISABLE_SIMD to always use the scalar implementations
+//!
+
+namespace cpp_redis {
+
+namespace scan {
+
+//!
+//! instruction sets the scanning functions can be implemented with
+//!
+enum class isa {
+  scalar,
+  sse2,
+  avx2
+};
+
+//!
+//! \return best instruction set supported both by the build and by the cpu (detected once, at first call)
+//!
+isa best_isa(void);
+
+//!
+//! find the first end sequence ("\r\n") of the given data, using the best available instruction set
+//!
+//! \param begin first byte of the data
+//! \param end end of the data
+//! \return position of the '\r' of the first end sequence, or end if there is none
+//!
+const char* find_crlf(const char* begin, const char* end);
+
+//!
+//! same as find_crlf, with the given instruction set (scalar if it is not available)
+//!
+//! \param begin first byte of the data
+//! \param end end of the data
+//! \param level instruction set to be used
+//! \return position of the '\r' of the first end sequence, or end if there is none
+//!
+const char* find_crlf(const char* begin, const char* end, isa level);
+
+//!
+//! convert a decimal integer (optional '-' followed by at least one digit), eight digits at a time
+//!
+//! \param begin first character
+//! \param end end of the integer
+//! \param value converted integer
+//! \return whether the characters form a valid integer, in the range of int64_t
+//!
+bool parse_integer(const char* begin, const char* end, int64_t& value);
+
+} // namespace scan
+
+} // namespace cpp_redis
@@ -0,0 +1,153 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif /* __cplusplus >= 201703L */
+
+namespace cpp_redis {
+
+//!
+//! non-owning reference to a sequence of characters (pointer and size), similar to std::string_view
+//! the referenced characters are not copied: the string_ref is only valid as long as the storage it points to
+//!
+class string_ref {
+public:
+  //!
+  //! default ctor (empty string)
+  //!
+  string_ref(void);
+
+  //!
+  //! ctor
+  //!
+  //! \param data first character of the referenced string
+  //! \param size number of characters
+  //!
+  string_ref(const char* data, std::size_t size);
+
+  //!
+  //! ctor, referencing a null-terminated string
+  //!
+  //! \param str referenced string
+  //!
+  string_ref(const char* str);
+
+  //!
+  //! ctor, referencing the content of a std::string
+  //!
+  //! \param str referenced string
+  //!
+  string_ref(const std::string& str);
+
+#if __cplusplus >= 201703L
+  //!
+  //! ctor, referencing the content of a std::string_view
+  //!
+  //! \param str referenced string
+  //!
+  string_ref(std::string_view str) : m_pData(str.data()), m_uSize(str.size()) {}
+#endif /* __cplusplus >= 201703L */
+
+  //! dtor
+  ~string_ref(void) = default;
+  //! copy ctor
+  string_ref(const string_ref&) = default;
+  //! assignment operator
+  string_ref& operator=(const string_ref&) = default;
+
+public:
+  //!
+  //! \return first character of the referenced string (not null-terminated)
+  //!
+  const char* data(void) const;
+
+  //!
+  //! \return number of characters
+  //!
+  std::size_t size(void) const;
+
+  //!
+  //! \return whether the referenced string is empty
+  //!
+  bool empty(void) const;
+
+  //!
+  //! \return iterator to the first character
+  //!
+  const char* begin(void) const;
+
+  //!
+  //! \return iterator past the last character
+  //!
+  const char* end(void) const;
+
+  //!
+  //! \param index position of the character
+  //! \return character at the given position (no bound checking)
+  //!
+  char operator[](std::size_t index) const;
+
+  //!
+  //! \return copy of the referenced characters
+  //!
+  std::string to_string(void) const;
+
+#if __cplusplus >= 201703L
+  //!
+  //! \return std::string_view on the referenced characters
+  //!
+  operator std::string_view(void) const { return std::string_view(m_pData, m_uSize); }
+#endif /* __cplusplus >= 201703L */
+
+private:
+  //!
+  //! first character
+  //!
+  const char* m_pData;
+
+  //!
+  //! number of characters
+  //!
+  std::size_t m_uSize;
+};
+
+//!
+//! \return whether both strings contain the same characters
+//!
+bool operator==(const string_ref& lhs, const string_ref& rhs);
+
+//!
+//! \return whether the strings differ
+//!
+bool operator!=(const string_ref& lhs, const string_ref& rhs);
+
+} // namespace cpp_redis
+
+//! support for output
+std::ostream& operator<<(std::ostream& os, const cpp_redis::string_ref& str);
@@ -0,0 +1,186 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+//!
+//! size of the inline storage of unique_function: callables up to this size are stored without any allocation
+//!
+#ifndef __CPP_REDIS_CALLBACK_INLINE_SIZE
+#define __CPP_REDIS_CALLBACK_INLINE_SIZE 64
+#endif /* __CPP_REDIS_CALLBACK_INLINE_SIZE */
+
+namespace cpp_redis {
+
+//!
+//! type trait: whether F can be called with the given arguments
+//!
+template <typename F, typename... Args>
+struct is_callable {
+private:
+  template <typename G>
+  static auto test(int) -> decltype(std::declval<G&>()(std::declval<Args>()...), std::true_type());
+
+  template <typename G>
+  static std::false_type test(...);
+
+public:
+  static constexpr bool value = decltype(test<F>(0))::value;
+};
+
+//! definition of the static member, required in C++11 once it is odr-used
+template <typename F, typename... Args>
+constexpr bool is_callable<F, Args...>::value;
+
+template <typename Signature, std::size_t InlineSize = __CPP_REDIS_CALLBACK_INLINE_SIZE>
+class unique_function;
+
+//!
+//! move-only equivalent of std::function
+//! callables fitting in InlineSize bytes (lambdas capturing a few pointers, strings or shared pointers, as well as
+//! std::function objects) are stored inline, without any allocation; larger ones are allocated on the heap
+//! since it is never copied, the stored callable does not need to be copyable
+//!
+template <typename R, typename... Args, std::size_t InlineSize>
+class unique_function<R(Args...), InlineSize> {
+public:
+  //! ctors (empty function)
+  unique_function(void);
+  unique_function(std::nullptr_t);
+
+  //!
+  //! ctor
+  //! an empty std::function or a null function pointer makes an empty unique_function
+  //!
+  //! \param f callable to be stored
+  //!
+  template <typename F,
+      typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, unique_function>::value
+                                         && is_callable<typename std::decay<F>::type, Args...>::value>::type>
+  unique_function(F&& f);
+
+  //! dtor
+  ~unique_function(void);
+
+  //! copy ctor & assignment operator
+  unique_function(const unique_function&) = delete;
+  unique_function& operator=(const unique_function&) = delete;
+
+  //! move ctor & assignment operator (the moved function is left empty)
+  unique_function(unique_function&& other) noexcept;
+  unique_function& operator=(unique_function&& other) noexcept;
+
+  //!
+  //! release the stored callable
+  //!
+  unique_function& operator=(std::nullptr_t);
+
+public:
+  //!
+  //! call the stored callable
+  //! throws std::bad_function_call if empty
+  //!
+  R operator()(Args... args) const;
+
+  //!
+  //! \return whether a callable is stored
+  //!
+  explicit operator bool(void) const;
+
+private:
+  //!
+  //! operations on the stored callable, shared by all the unique_function storing the same type
+  //!
+  struct operations {
+    R (*invoke)(void* pStorage, Args&&... args);
+    void (*move)(void* pDest, void* pSrc);
+    void (*destroy)(void* pStorage);
+  };
+
+  //!
+  //! inline storage, holding the callable itself, or a pointer to it when it does not fit
+  //!
+  typedef typename std::aligned_storage<InlineSize>::type storage_t;
+
+  //!
+  //! \return whether F is stored inline
+  //!
+  template <typename F>
+  static constexpr bool fits_inline(void);
+
+  //!
+  //! \return operations for the callable type F
+  //!
+  template <typename F>
+  static const operations* operations_for(std::true_type bInline);
+  template <typename F>
+  static const operations* operations_for(std::false_type bInline);
+
+  template <typename F>
+  static R invoke_inline(void* pStorage, Args&&... args);
+  template <typename F>
+  static void move_inline(void* pDest, void* pSrc);
+  template <typename F>
+  static void destroy_inline(void* pStorage);
+
+  template <typename F>
+  static R invoke_heap(void* pStorage, Args&&... args);
+  static void move_heap(void* pDest, void* pSrc);
+  template <typename F>
+  static void destroy_heap(void* pStorage);
+
+  //!
+  //! \return whether the given callable is null (empty std::function, null function pointer)
+  //!
+  template <typename F>
+  static bool is_null(const F&);
+  template <typename Signature>
+  static bool is_null(const std::function<Signature>& f);
+  template <typename T>
+  static bool is_null(T* p);
+
+  //!
+  //! store the given callable (this being empty), inline or on the heap
+  //!
+  template <typename F>
+  void store(F&& f, std::true_type bInline);
+  template <typename F>
+  void store(F&& f, std::false_type bInline);
+
+private:
+  //!
+  //! callable, or pointer to it
+  //!
+  mutable storage_t m_storage;
+
+  //!
+  //! operations on the stored callable (null if empty)
+  //!
+  const operations* m_pOperations;
+};
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/unique_function.ipp>
@@ -0,0 +1,250 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpp_redis/core/command_table.hpp>
+#include <cpp_redis/misc/string_ref.hpp>
+
+namespace cpp_redis {
+
+namespace network {
+
+//!
+//! encoder of redis commands, using the redis protocol format
+//! a command is sized up front and written in a single pass at the end of an output buffer,
+//! without building intermediate strings
+//!
+class command_encoder {
+public:
+  //!
+  //! \param value unsigned integer
+  //! \return number of decimal digits of value
+  //!
+  static std::size_t digits_count(std::size_t uValue);
+
+  //!
+  //! write the decimal representation of value, which must have room for digits_count(value) characters
+  //!
+  //! \param dest first character to be written
+  //! \param value unsigned integer to be written
+  //! \return position following the last written character
+  //!
+  static char* write_unsigned(char* pDest, std::size_t uValue);
+
+  //!
+  //! \param size length of a bulk string
+  //! \return number of bytes required to encode a bulk string of the given length ("$<size>\r\n<content>\r\n")
+  //!
+  static std::size_t bulk_size(std::size_t uSize);
+
+  //!
+  //! \param redis_cmd command to be encoded
+  //! \return number of bytes required to encode the command
+  //!
+  static std::size_t encoded_size(const std::vector<std::string>& vctRedisCmd);
+
+  //!
+  //! append the given command, using the redis protocol format, to the output buffer
+  //! for example, {"GET", "HELLO"} is encoded as "*2\r\n$3\r\nGET\r\n$5\r\nHELLO\r\n"
+  //! the buffer grows at most once per command
+  //!
+  //! \param redis_cmd command to be encoded
+  //! \param buffer output buffer
+  //! \param extra_args number of arguments the caller appends after the command (counted in the array header)
+  //!
+  static void encode(const std::vector<std::string>& vctRedisCmd, std::vector<char>& vctBuffer,
+    std::size_t uExtraArgs = 0);
+
+  //!
+  //! same as the other encode method, for a command of the command table
+  //! the pre-encoded header of the command is copied as is, only the arguments are encoded
+  //!
+  //! \param command descriptor of the command
+  //! \param args arguments of the command, following its name (and subcommand)
+  //! \param buffer output buffer
+  //! \param extra_args number of arguments the caller appends after the command (counted in the array header)
+  //!
+  static void encode(const command_descriptor& command, const std::vector<std::string>& vctArgs,
+    std::vector<char>& vctBuffer, std::size_t uExtraArgs = 0);
+
+  //!
+  //! append a bulk string to the output buffer
+  //!
+  //! \param data content of the bulk string
+  //! \param size length of the bulk string
+  //! \param buffer output buffer
+  //!
+  static void encode_bulk(const char* pData, std::size_t uSize, std::vector<char>& vctBuffer);
+
+  //!
+  //! append the header of a bulk string ("$<size>\r\n") to the output buffer, its content and end sequence being
+  //! written separately
+  //!
+  //! \param size length of the bulk string
+  //! \param buffer output buffer
+  //!
+  static void encode_bulk_header(std::size_t uSize, std::vector<char>& vctBuffer);
+
+  //!
+  //! append the command made of the given arguments to the output buffer, each argument being serialized in place
+  //! arguments can be:
+  //!  - a command_id, replaced by the pre-encoded name (and subcommand) of the command
+  //!  - anything convertible to a string_ref (std::string, const char*, std::string_view), written as is
+  //!  - std::vector<char> or std::vector<unsigned char>, written as is
+  //!  - std::vector<std::string>, each string being a separate argument
+  //!  - integers (bool excluded) and floating point numbers, written in decimal
+  //! for example, encode_args(buffer, command_id::expire, key, 60) or encode_args(buffer, "INCRBYFLOAT", key, 0.5)
+  //!
+  //! \param buffer output buffer
+  //! \param args arguments of the command
+  //!
+  template <typename... Args>
+  static void encode_args(std::vector<char>& vctBuffer, const Args&... args);
+
+  //!
+  //! start a command whose number of arguments is not known yet: room is left for its array header, and arguments
+  //! are then appended with append_args and append_element, before end_frame completes the command
+  //!
+  //! \param buffer output buffer
+  //! \return position of the command in the output buffer, to be passed to end_frame
+  //!
+  static std::size_t begin_frame(std::vector<char>& vctBuffer);
+
+  //!
+  //! complete a command started by begin_frame, by writing its array header
+  //!
+  //! \param buffer output buffer
+  //! \param offset position of the command, as returned by begin_frame
+  //! \param nb_args number of arguments of the command
+  //!
+  static void end_frame(std::vector<char>& vctBuffer, std::size_t uOffset, std::size_t uNbArgs);
+
+  //!
+  //! append arguments to a command started by begin_frame (same argument types as encode_args)
+  //!
+  //! \param buffer output buffer
+  //! \param args arguments to be appended
+  //! \return number of bulk strings appended
+  //!
+  template <typename... Args>
+  static std::size_t append_args(std::vector<char>& vctBuffer, const Args&... args);
+
+  //!
+  //! append an element of a range to a command started by begin_frame: pairs (key and value, score and member, ...)
+  //! are appended as two arguments
+  //!
+  //! \param buffer output buffer
+  //! \param element element to be appended
+  //! \return number of bulk strings appended
+  //!
+  template <typename T>
+  static std::size_t append_element(std::vector<char>& vctBuffer, const T& element);
+  template <typename T1, typename T2>
+  static std::size_t append_element(std::vector<char>& vctBuffer, const std::pair<T1, T2>& element);
+
+  //!
+  //! write the header of an array or of a bulk string ("*<size>\r\n" or "$<size>\r\n")
+  //!
+  //! \param dest first character to be written
+  //! \param type '*' or '$'
+  //! \param size number of elements or length of the string
+  //! \return position following the last written character
+  //!
+  static char* write_header(char* pDest, char cType, std::size_t uSize);
+
+  //!
+  //! write a bulk string
+  //!
+  //! \param dest first character to be written, must have room for bulk_size(size) characters
+  //! \param data content of the bulk string
+  //! \param size length of the bulk string
+  //! \return position following the last written character
+  //!
+  static char* write_bulk(char* pDest, const char* pData, std::size_t uSize);
+
+private:
+  //!
+  //! integers accepted by encode_args
+  //!
+  template <typename T>
+  struct is_integer_arg
+  : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value> {};
+
+  //!
+  //! number of bulk strings an argument of encode_args is encoded as
+  //!
+  static std::size_t arg_count(command_id eCommand);
+  static std::size_t arg_count(const std::vector<std::string>& vctArgs);
+  template <typename T>
+  static std::size_t arg_count(const T&);
+
+  //!
+  //! number of bytes an argument of encode_args is encoded in, at most
+  //!
+  static std::size_t arg_max_size(command_id eCommand);
+  static std::size_t arg_max_size(const string_ref& sArg);
+  static std::size_t arg_max_size(const std::vector<char>& vctArg);
+  static std::size_t arg_max_size(const std::vector<unsigned char>& vctArg);
+  static std::size_t arg_max_size(const std::vector<std::string>& vctArgs);
+  template <typename T>
+  static typename std::enable_if<is_integer_arg<T>::value, std::size_t>::type arg_max_size(T);
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, std::size_t>::type arg_max_size(T);
+
+  //!
+  //! write an argument of encode_args, which must have room for arg_max_size(arg) characters
+  //!
+  //! \param dest first character to be written
+  //! \param arg argument to be written
+  //! \return position following the last written character
+  //!
+  static char* write_arg(char* pDest, command_id eCommand);
+  static char* write_arg(char* pDest, const string_ref& sArg);
+  static char* write_arg(char* pDest, const std::vector<char>& vctArg);
+  static char* write_arg(char* pDest, const std::vector<unsigned char>& vctArg);
+  static char* write_arg(char* pDest, const std::vector<std::string>& vctArgs);
+  template <typename T>
+  static typename std::enable_if<is_integer_arg<T>::value, char*>::type write_arg(char* pDest, T nValue);
+  template <typename T>
+  static typename std::enable_if<std::is_floating_point<T>::value, char*>::type write_arg(char* pDest, T dValue);
+
+  //!
+  //! write a number as a bulk string (floating point numbers with the given number of significant digits)
+  //!
+  static char* write_integer(char* pDest, std::int64_t nValue);
+  static char* write_unsigned_integer(char* pDest, std::uint64_t uValue);
+  static char* write_double(char* pDest, double dValue, int nPrecision);
+};
+
+} // namespace network
+
+} // namespace cpp_redis
+
+#include <cpp_redis/impl/command_encoder.ipp>
@@ -0,0 +1,159 @@
+// MIT License
+//
+// Copyright (c) 2016-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cpp_redis/network/tcp_client_iface.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace cpp_redis {
+
+namespace network {
+
+//!
+//! implementation of the tcp_client_iface based on POSIX sockets, writing the segments of write requests with a
+//! single scatter-gather call (see tcp_client_iface::write_request)
+//! the reads are performed by a thread dedicated to the connection, which runs the read callbacks
+//! the writes are performed synchronously, by the thread committing the commands
+//!
+class posix_tcp_client : public tcp_client_iface {
+public:
+  //! ctor
+  posix_tcp_client(void);
+  //! dtor
+  ~posix_tcp_client(void);
+
+  //! copy ctor
+  posix_tcp_client(const posix_tcp_client&) = delete;
+  //! assignment operator
+  posix_tcp_client& operator=(const posix_tcp_client&) = delete;
+
+public:
+  //!
+  //! start the tcp client
+  //!
+  //! \param addr host to be connected to
+  //! \param port port to be connected to
+  //! \param timeout_msecs max time to connect in ms (0 for no timeout)
+  //!
+  void connect(const std::string& sAddr, std::uint32_t uPort, std::uint32_t uTimeoutMsecs) override;
+
+  //!
+  //! stop the tcp client
+  //!
+  //! \param wait_for_removal when sets to true, disconnect blocks until the read thread has completed
+  //!
+  void disconnect(bool bWaitForRemoval = false) override;
+
+  //!
+  //! \return whether the client is currently connected or not
+  //!
+  bool is_connected(void) const override;
+
+public:
+  //!
+  //! async read operation, performed by the read thread
+  //!
+  //! \param request information about what should be read and what should be done after completion
+  //!
+  void async_read(read_request& requestRead) override;
+
+  //!
+  //! write operation, completed before returning: the buffer and segments are written with sendmsg
+  //!
+  //! \param request information about what should be written and what should be done after completion
+  //!
+  void async_write(write_request& requestWrite) override;
+
+  //!
+  //! \return true: the segments of the write requests are written without being gathered
+  //!
+  bool supports_segments(void) const override;
+
+public:
+  //!
+  //! set on disconnection handler
+  //!
+  //! \param disconnection_handler handler to be called in case of a disconnection
+  //!
+  void set_on_disconnection_handler(const disconnection_handler_t& handlerDisconnection) override;
+
+private:
+  //!
+  //! read loop of the read thread, until the connection is closed, the socket being closed by the read thread only
+  //!
+  //! \param generation connection read by the thread
+  //! \param fd socket of the connection
+  //!
+  void read_loop(std::uint64_t uGeneration, int nFd);
+
+private:
+  //!
+  //! socket of the connection (-1 when not connected)
+  //!
+  int                       m_nFd;
+
+  //!
+  //! whether the client is connected
+  //!
+  std::atomic_bool          m_bConnected_a;
+
+  //!
+  //! thread performing the reads
+  //!
+  std::thread               m_threadRead;
+
+  //!
+  //! current connection, incremented once closed: the read thread of a closed connection stops
+  //!
+  std::uint64_t             m_uGeneration;
+
+  //!
+  //! pending read request, if any, handed over to the read thread
+  //!
+  read_request              m_requestRead;
+  bool                      m_bReadPending;
+  std::mutex                m_mtxRead;
+  std::condition_variable   m_cvRead;
+
+  //!
+  //! serialize the writes, connections and disconnections (locked before m_mtxRead)
+  //!
+  std::mutex                m_mtxWrite;
+
+  //!
+  //! handler called when the connection is lost
+  //!
+  disconnection_handler_t   m_handlerDisconnection;
+};
+
+} // namespace network
+
+} // namespace cpp_redis
+
+#endif /* _WIN32 */
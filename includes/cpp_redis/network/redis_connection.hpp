@@ -29,12 +29,20 @@
 #include <vector>
 
 #include <cpp_redis/builders/reply_builder.hpp>
+#include <cpp_redis/core/command_table.hpp>
 #include <cpp_redis/network/tcp_client_iface.hpp>
 
 #ifndef __CPP_REDIS_READ_SIZE
 #define __CPP_REDIS_READ_SIZE 4096
 #endif /* __CPP_REDIS_READ_SIZE */
 
+//!
+//! shared values smaller than this are copied in the send buffer instead of being written as separate segments
+//!
+#ifndef __CPP_REDIS_SHARED_VALUE_MIN_SIZE
+#define __CPP_REDIS_SHARED_VALUE_MIN_SIZE 16384
+#endif /* __CPP_REDIS_SHARED_VALUE_MIN_SIZE */
+
 namespace cpp_redis {
 
 namespace network {
@@ -75,6 +83,34 @@ public:
   //!
   typedef std::function<void(redis_connection&, reply&)> reply_callback_t;
 
+  //!
+  //! batch reply handler takes as parameter the instance of the redis_connection and the replies built from one read,
+  //! in the order they were received
+  //!
+  typedef std::function<void(redis_connection&, std::vector<reply>&)> replies_callback_t;
+
+  //!
+  //! view reply handler takes as parameter the instance of the redis_connection and a view on the received reply
+  //! the view is only valid during the call
+  //!
+  typedef std::function<void(redis_connection&, const reply_view&)> reply_view_callback_t;
+
+  //!
+  //! predicate deciding whether a reply should be passed as a view, see builders::reply_builder::view_predicate_t
+  //!
+  typedef builders::reply_builder::view_predicate_t reply_view_predicate_t;
+
+  //!
+  //! selector returning the handler to which a reply should be passed as events,
+  //! see builders::reply_builder::handler_selector_t
+  //!
+  typedef builders::reply_builder::handler_selector_t reply_handler_selector_t;
+
+  //!
+  //! immutable value shared with the caller, written to the network straight from the caller's memory
+  //!
+  typedef std::shared_ptr<const std::string> shared_value_t;
+
   //!
   //! connect to the given host and port, and set both disconnection and reply callbacks
   //!
@@ -114,6 +150,55 @@ public:
   //!
   redis_connection& send(const std::vector<std::string>& vctRedisCmd);
 
+  //!
+  //! same as send, with a last argument shared with the caller
+  //! values of at least __CPP_REDIS_SHARED_VALUE_MIN_SIZE bytes are not copied: the write request references them
+  //! as a separate segment (see tcp_client_iface::write_request), and keeps them alive until they are written
+  //! (for transports not supporting segments, they are copied in the send buffer, as the other arguments)
+  //!
+  //! \param redis_cmd command to be sent, except its last argument
+  //! \param value last argument of the command
+  //! \return current instance
+  //!
+  redis_connection& send(const std::vector<std::string>& vctRedisCmd, const shared_value_t& ptrValue);
+
+  //!
+  //! same as send, for a command of the command table: its pre-encoded header is copied in the send buffer
+  //!
+  //! \param command descriptor of the command
+  //! \param args arguments of the command, following its name (and subcommand)
+  //! \return current instance
+  //!
+  redis_connection& send(const command_descriptor& command, const std::vector<std::string>& vctArgs);
+
+  //!
+  //! same as send, for a command of the command table, with a last argument shared with the caller
+  //!
+  //! \param command descriptor of the command
+  //! \param args arguments of the command, following its name (and subcommand), except the last one
+  //! \param value last argument of the command
+  //! \return current instance
+  //!
+  redis_connection& send(const command_descriptor& command, const std::vector<std::string>& vctArgs,
+    const shared_value_t& ptrValue);
+
+  //!
+  //! same as send, for a command already encoded with the redis protocol format (see command_encoder)
+  //!
+  //! \param frame encoded command
+  //! \return current instance
+  //!
+  redis_connection& send_encoded(const std::vector<char>& vctFrame);
+
+  //!
+  //! same as send_encoded, the shared value being written as the last argument of the command
+  //!
+  //! \param frame encoded command, its array header counting the shared value (see command_encoder extra_args)
+  //! \param value value written after the frame
+  //! \return current instance
+  //!
+  redis_connection& send_encoded(const std::vector<char>& vctFrame, const shared_value_t& ptrValue);
+
   //!
   //! commit pipelined transaction
   //! that is, send to the network all commands pipelined by calling send()
@@ -122,6 +207,57 @@ public:
   //!
   redis_connection& commit(void);
 
+  //!
+  //! enable or disable the reply pool
+  //! when enabled, the strings and arrays of a reply are recycled once its reply callback returns, and reused
+  //! to build the following replies. Reply callbacks must then move out of the reply whatever they want to keep.
+  //! should be set before connecting
+  //!
+  //! \param enabled whether the reply pool should be used
+  //!
+  void set_reply_pool_enabled(bool enabled);
+
+  //!
+  //! set the limits bounding the memory used to receive replies
+  //! a reply exceeding them is handled as invalid data: the connection calls its disconnection handler
+  //!
+  //! \param limits limits to be applied
+  //!
+  void set_reply_limits(const builders::reply_limits& limits);
+
+  //!
+  //! set the handlers used to receive replies as views instead of built replies
+  //! when a reply starts being received, the predicate is called with the number of replies received before it
+  //! and not yet passed to a callback: if it returns true, the reply is not built and is passed to the view
+  //! callback, pointing directly into the receive buffer
+  //! should be set before connecting
+  //!
+  //! \param predicate predicate selecting the replies to be passed as views (nullptr to build every reply)
+  //! \param view_callback handler to be called once a reply selected by the predicate is ready
+  //!
+  void set_reply_view_handlers(const reply_view_predicate_t& predicate, const reply_view_callback_t& view_callback);
+
+  //!
+  //! set the selector used to pass replies as events to a handler instead of building them
+  //! when a reply starts being received, the selector is called with the number of replies received before it
+  //! and not yet passed to a callback: if it returns a handler, the content of the reply is passed to it as it is
+  //! received, then the reply callback is called with a null reply once the reply is complete
+  //! should be set before connecting
+  //!
+  //! \param selector selector returning the handler of a reply (nullptr to build every reply)
+  //!
+  void set_reply_handler_selector(const reply_handler_selector_t& selector);
+
+  //!
+  //! set the handler used to receive the replies in batches instead of one by one
+  //! when set, the built replies are passed to it all at once, once the data of a read has been parsed
+  //! (or before a view callback, so that replies are still delivered in order), and the reply callback is not called
+  //! should be set before connecting
+  //!
+  //! \param replies_callback handler to be called with the replies built from a read (nullptr to deliver replies one by one)
+  //!
+  void set_replies_callback(const replies_callback_t& callbackReplies);
+
 private:
   //!
   //! tcp_client receive handler
@@ -137,18 +273,26 @@ private:
   //!
   void tcp_client_disconnection_handler(void);
 
-  //!
-  //! transform a user command to a redis command using the redis protocol format
-  //! for example, transform {"GET", "HELLO"} to something like "*2\r\n+GET\r\n+HELLO\r\n"
-  //!
-  std::string build_command(const std::vector<std::string>& vctRedisCmd);
-
 private:
   //!
   //! simply call the disconnection handler (does nothing if disconnection handler is set to null)
   //!
   void call_disconnection_handler(void);
 
+  //!
+  //! pass the replies waiting in the batch to the batch reply handler, then recycle them
+  //!
+  void flush_replies(void);
+
+  //!
+  //! append a shared value to the send buffer, as a bulk string, or as a separate segment when large enough and
+  //! supported by the tcp client
+  //! m_mtxBuffer must be locked
+  //!
+  //! \param value value to be appended
+  //!
+  void append_shared_value(const shared_value_t& ptrValue);
+
 private:
   //!
   //! tcp client for redis connection
@@ -160,6 +304,21 @@ private:
   //!
   reply_callback_t                                          m_callbackReply;
 
+  //!
+  //! reply callback called whenever a reply selected by the view predicate has been read
+  //!
+  reply_view_callback_t                                     m_callbackReplyView;
+
+  //!
+  //! batch reply callback called with the replies built from a read
+  //!
+  replies_callback_t                                        m_callbackReplies;
+
+  //!
+  //! replies built from the current read and not yet passed to the batch reply callback
+  //!
+  std::vector<reply>                                        m_vctReplies;
+
   //!
   //! disconnection handler whenever a disconnection occured
   //!
@@ -171,10 +330,15 @@ private:
   builders::reply_builder                                   m_builderReply;
 
   //!
-  //! internal buffer used for pipelining (commands are buffered here and flushed to the tcp client
+  //! internal buffer used for pipelining (commands are encoded here and the buffer is moved to the tcp client
   //! when commit is called)
   //!
-  std::string                                               m_sBuffer;
+  std::vector<char>                                         m_vctBuffer;
+
+  //!
+  //! shared values referenced by the commands of m_vctBuffer, in order
+  //!
+  std::vector<tcp_client_iface::write_segment>              m_vctSegments;
 
   //!
   //! protect internal buffer against race conditions
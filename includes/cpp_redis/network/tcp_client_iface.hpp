@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -124,6 +125,21 @@ public:
     async_read_callback_t   callbackAsyncRead;
   };
 
+  //!
+  //! value written as part of a scatter-gather write request, after the first uOffset bytes of its vctBuffer
+  //!
+  struct write_segment {
+    //!
+    //! number of bytes of vctBuffer written before the value
+    //!
+    std::size_t                         uOffset;
+
+    //!
+    //! value to be written, kept alive until it is written
+    //!
+    std::shared_ptr<const std::string>  ptrValue;
+  };
+
   //!
   //! structure to store write requests information
   //!
@@ -131,12 +147,21 @@ public:
     //!
     //! bytes to write
     //!
-    std::vector<char>       vctBuffer;
+    std::vector<char>           vctBuffer;
 
     //!
     //! callback to be called on operation completion
     //!
-    async_write_callback_t  callbackAsyncWrite;
+    async_write_callback_t      callbackAsyncWrite;
+
+    //!
+    //! when not empty, values to be written between the bytes of vctBuffer, by increasing offset
+    //! implementations supporting scatter-gather writes (writev, WSASend) can send the ranges of vctBuffer and the
+    //! values as they are, without gathering them in a single buffer first
+    //! made of offsets and owned values, the request can be copied or moved (e.g. into a queue) as a whole
+    //! only filled for implementations returning true from supports_segments()
+    //!
+    std::vector<write_segment>  vctSegments;
   };
 
 public:
@@ -154,6 +179,12 @@ public:
   //!
   virtual void async_write(write_request& request) = 0;
 
+  //!
+  //! \return whether async_write handles the vctSegments of write requests
+  //!         when false (default), the bytes to write are always in vctBuffer
+  //!
+  virtual bool supports_segments(void) const { return false; }
+
 public:
   //!
   //! disconnection handler
@@ -35,11 +35,11 @@ array_builder::array_builder(void)
 , m_reply(std::vector<reply>{}) {}
 
 bool
-array_builder::fetch_array_size(std::string& sBuffer) {
+array_builder::fetch_array_size(const std::string& sBuffer, std::size_t& uPos) {
   if (m_intBuilder.reply_ready())
     return true;
 
-  m_intBuilder << sBuffer;
+  m_intBuilder.consume(sBuffer, uPos);
   if (!m_intBuilder.reply_ready())
     return false;
 
@@ -57,17 +57,17 @@ array_builder::fetch_array_size(std::string& sBuffer) {
 }
 
 bool
-array_builder::build_row(std::string& sBuffer) {
+array_builder::build_row(const std::string& sBuffer, std::size_t& uPos) {
   if (!m_ptrCurrentBuilder) {
-    m_ptrCurrentBuilder = create_builder(sBuffer.front());
-    sBuffer.erase(0, 1);
+    m_ptrCurrentBuilder = create_builder(sBuffer[uPos]);
+    ++uPos;
   }
 
-  *m_ptrCurrentBuilder << sBuffer;
+  m_ptrCurrentBuilder->consume(sBuffer, uPos);
   if (!m_ptrCurrentBuilder->reply_ready())
     return false;
 
-  m_reply << m_ptrCurrentBuilder->get_reply();
+  m_reply << m_ptrCurrentBuilder->take_reply();
   m_ptrCurrentBuilder = nullptr;
 
   if (m_reply.as_array().size() == m_uArraySize)
@@ -77,20 +77,25 @@ array_builder::build_row(std::string& sBuffer) {
 }
 
 builder_iface&
-array_builder::operator<<(std::string& sBuffer) {
+array_builder::consume(const std::string& sBuffer, std::size_t& uPos) {
   if (m_bReplyReady)
     return *this;
 
-  if (!fetch_array_size(sBuffer))
+  if (!fetch_array_size(sBuffer, uPos))
     return *this;
 
-  while (sBuffer.size() && !m_bReplyReady)
-    if (!build_row(sBuffer))
+  while (uPos < sBuffer.size() && !m_bReplyReady)
+    if (!build_row(sBuffer, uPos))
       return *this;
 
   return *this;
 }
 
+std::size_t
+array_builder::pending_size(void) const {
+  return m_ptrCurrentBuilder ? m_ptrCurrentBuilder->pending_size() : 0;
+}
+
 bool
 array_builder::reply_ready(void) const {
   return m_bReplyReady;
@@ -101,6 +106,11 @@ array_builder::get_reply(void) const {
   return reply{m_reply};
 }
 
+reply
+array_builder::take_reply(void) {
+  return std::move(m_reply);
+}
+
 } // namespace builders
 
 } // namespace cpp_redis
@@ -0,0 +1,94 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/bulk_sink.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+bulk_sink::bulk_sink(const chunk_callback_t& callback)
+: m_callbackChunk(callback)
+, m_uSize(0)
+, m_uCount(0)
+, m_bNull(false)
+, m_bError(false) {}
+
+bulk_sink::bulk_sink(std::ostream& os)
+: bulk_sink([&os](const string_ref& chunk, bool) {
+  os.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+}) {}
+
+void
+bulk_sink::on_bulk(const string_ref& chunk, bool last) {
+  m_uSize += chunk.size();
+  if (last)
+    ++m_uCount;
+
+  if (m_callbackChunk)
+    m_callbackChunk(chunk, last);
+}
+
+void
+bulk_sink::on_simple_string(const string_ref& value) {
+  on_bulk(value, true);
+}
+
+void
+bulk_sink::on_error(const string_ref& value) {
+  m_bError = true;
+  m_sError = value.to_string();
+}
+
+void
+bulk_sink::on_null(void) {
+  m_bNull = true;
+}
+
+std::size_t
+bulk_sink::size(void) const {
+  return m_uSize;
+}
+
+std::size_t
+bulk_sink::count(void) const {
+  return m_uCount;
+}
+
+bool
+bulk_sink::is_null(void) const {
+  return m_bNull;
+}
+
+bool
+bulk_sink::is_error(void) const {
+  return m_bError;
+}
+
+const std::string&
+bulk_sink::error(void) const {
+  return m_sError;
+}
+
+} // namespace builders
+
+} // namespace cpp_redis
@@ -45,11 +45,11 @@ bulk_string_builder::build_reply(void) {
 }
 
 bool
-bulk_string_builder::fetch_size(std::string& sBuffer) {
+bulk_string_builder::fetch_size(const std::string& sBuffer, std::size_t& uPos) {
   if (m_intBuilder.reply_ready())
     return true;
 
-  m_intBuilder << sBuffer;
+  m_intBuilder.consume(sBuffer, uPos);
   if (!m_intBuilder.reply_ready())
     return false;
 
@@ -63,32 +63,42 @@ bulk_string_builder::fetch_size(std::string& sBuffer) {
 }
 
 void
-bulk_string_builder::fetch_str(std::string& sBuffer) {
-  if (sBuffer.size() < static_cast<std::size_t>(m_nStringSize) + 2) // also wait for end sequence
+bulk_string_builder::fetch_str(const std::string& sBuffer, std::size_t& uPos) {
+  if (sBuffer.size() - uPos < static_cast<std::size_t>(m_nStringSize) + 2) // also wait for end sequence
     return;
 
-  if (sBuffer[m_nStringSize] != '\r' || sBuffer[m_nStringSize + 1] != '\n') {
+  if (sBuffer[uPos + m_nStringSize] != '\r' || sBuffer[uPos + m_nStringSize + 1] != '\n') {
     __CPP_REDIS_LOG(error, "cpp_redis::builders::bulk_string_builder receives invalid ending sequence");
     throw redis_error("Wrong ending sequence");
   }
 
-  m_sValue = sBuffer.substr(0, m_nStringSize);
-  sBuffer.erase(0, m_nStringSize + 2);
+  m_sValue.assign(sBuffer, uPos, m_nStringSize);
+  uPos += m_nStringSize + 2;
   build_reply();
 }
 
 builder_iface&
-bulk_string_builder::operator<<(std::string& sBuffer) {
+bulk_string_builder::consume(const std::string& sBuffer, std::size_t& uPos) {
 
   //! if we don't have the size, try to get it with the current buffer
-  if (m_bReplyReady || !fetch_size(sBuffer))
+  if (m_bReplyReady || !fetch_size(sBuffer, uPos))
     return *this;
 
-  fetch_str(sBuffer);
+  //! null bulk strings are complete as soon as the size is read
+  if (!m_bReplyReady)
+    fetch_str(sBuffer, uPos);
 
   return *this;
 }
 
+std::size_t
+bulk_string_builder::pending_size(void) const {
+  if (m_bReplyReady || !m_intBuilder.reply_ready() || m_nStringSize < 0)
+    return 0;
+
+  return static_cast<std::size_t>(m_nStringSize) + 2;
+}
+
 bool
 bulk_string_builder::reply_ready(void) const {
   return m_bReplyReady;
@@ -99,6 +109,11 @@ bulk_string_builder::get_reply(void) const {
   return reply{m_reply};
 }
 
+reply
+bulk_string_builder::take_reply(void) {
+  return std::move(m_reply);
+}
+
 const std::string&
 bulk_string_builder::get_bulk_string(void) const {
   return m_sValue;
@@ -27,8 +27,8 @@ namespace cpp_redis {
 namespace builders {
 
 builder_iface&
-error_builder::operator<<(std::string& sBuffer) {
-  m_stringBuilder << sBuffer;
+error_builder::consume(const std::string& sBuffer, std::size_t& uPos) {
+  m_stringBuilder.consume(sBuffer, uPos);
 
   if (m_stringBuilder.reply_ready())
     m_reply.set(m_stringBuilder.get_simple_string(), reply::string_type::error);
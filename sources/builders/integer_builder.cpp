@@ -20,11 +20,10 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include <cctype>
-
 #include <cpp_redis/builders/integer_builder.hpp>
 #include <cpp_redis/misc/error.hpp>
 #include <cpp_redis/misc/logger.hpp>
+#include <cpp_redis/misc/scan.hpp>
 
 namespace cpp_redis {
 
@@ -32,35 +31,28 @@ namespace builders {
 
 integer_builder::integer_builder(void)
 : m_nbr(0)
-, m_negative_multiplicator(1)
 , m_reply_ready(false) {}
 
 builder_iface&
-integer_builder::operator<<(std::string& buffer) {
+integer_builder::consume(const std::string& buffer, std::size_t& pos) {
   if (m_reply_ready)
     return *this;
 
-  auto end_sequence = buffer.find("\r\n");
-  if (end_sequence == std::string::npos)
+  const char* data         = buffer.data();
+  const char* end_sequence = scan::find_crlf(data + pos, data + buffer.size());
+  if (end_sequence == data + buffer.size())
     return *this;
 
-  std::size_t i;
-  for (i = 0; i < end_sequence; i++) {
-    //! check for negative numbers
-    if (!i && m_negative_multiplicator == 1 && buffer[i] == '-') {
-      m_negative_multiplicator = -1;
-      continue;
-    } else if (!std::isdigit(buffer[i])) {
-      __CPP_REDIS_LOG(error, "cpp_redis::builders::integer_builder receives invalid digit character");
-      throw redis_error("Invalid character for integer redis reply");
-    }
-
-    m_nbr *= 10;
-    m_nbr += buffer[i] - '0';
+  int64_t nbr = 0;
+  if (!scan::parse_integer(data + pos, end_sequence, nbr)) {
+    __CPP_REDIS_LOG(error, "cpp_redis::builders::integer_builder receives invalid digit character");
+    throw redis_error("Invalid character for integer redis reply");
   }
 
-  buffer.erase(0, end_sequence + 2);
-  m_reply.set(m_negative_multiplicator * m_nbr);
+  m_nbr = nbr;
+
+  pos = static_cast<std::size_t>(end_sequence - data) + 2;
+  m_reply.set(m_nbr);
   m_reply_ready = true;
 
   return *this;
@@ -78,7 +70,7 @@ integer_builder::get_reply(void) const {
 
 int64_t
 integer_builder::get_integer(void) const {
-  return m_negative_multiplicator * m_nbr;
+  return m_nbr;
 }
 
 } // namespace builders
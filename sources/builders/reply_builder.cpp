@@ -20,52 +20,222 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include <cpp_redis/builders/builders_factory.hpp>
 #include <cpp_redis/builders/reply_builder.hpp>
 #include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/logger.hpp>
+
+#include <algorithm>
 
 namespace cpp_redis {
 
 namespace builders {
 
+//!
+//! reservations above this size (redis default proto-max-bulk-len) are not performed upfront
+//!
+static const std::size_t max_reserved_size = 512 * 1024 * 1024;
+
 reply_builder::reply_builder(void)
-: m_ptrBuilder(nullptr) {}
+: m_uBufferPos(0)
+, m_bPoolEnabled(false)
+, m_bReplyStarted(false)
+, m_bReplyIsView(false)
+, m_ptrReplyHandler(nullptr)
+, m_uReplyBegin(0)
+, m_szError(nullptr) {}
 
 reply_builder&
 reply_builder::operator<<(const std::string& sData) {
-  m_sBuffer += sData;
+  if (!try_append(sData))
+    throw redis_error(get_error());
+
+  return *this;
+}
+
+bool
+reply_builder::try_append(const std::string& sData) {
+  return try_append(sData.data(), sData.size());
+}
+
+bool
+reply_builder::try_append(const char* pData, std::size_t uSize) {
+  if (get_error())
+    return false;
+
+  m_sBuffer.append(pData, uSize);
 
   while (build_reply()) {}
 
-  return *this;
+  compact(false);
+  if (!check_buffer_size())
+    return false;
+
+  reserve_pending();
+
+  return !get_error();
+}
+
+const char*
+reply_builder::get_error(void) const {
+  return m_szError ? m_szError : m_parser.get_error();
+}
+
+void
+reply_builder::resume(void) {
+  if (!try_resume())
+    throw redis_error(get_error());
+}
+
+bool
+reply_builder::try_resume(void) {
+  if (reply_available())
+    return !get_error();
+
+  while (build_reply()) {}
+
+  compact(false);
+  if (!check_buffer_size())
+    return false;
+
+  reserve_pending();
+
+  return !get_error();
 }
 
 void
 reply_builder::reset(void) {
-  m_ptrBuilder = nullptr;
+  m_parser.reset();
   m_sBuffer.clear();
+  m_uBufferPos    = 0;
+  m_bReplyStarted = false;
+  m_szError       = nullptr;
+  shrink();
+
+  //! views point into the buffer: they can not be kept
+  m_deqAvailableReplies.clear();
+}
+
+void
+reply_builder::compact(bool bForce) {
+  //! bytes of pending views (the first one is the oldest) and of the view in progress must be kept
+  std::size_t uDiscard = m_uBufferPos;
+
+  if (m_bReplyStarted && m_bReplyIsView)
+    uDiscard = m_uReplyBegin;
+
+  for (const auto& available : m_deqAvailableReplies) {
+    if (available.bView) {
+      uDiscard = std::min(uDiscard, available.uBegin);
+      break;
+    }
+  }
+
+  if (uDiscard == m_sBuffer.size()) {
+    //! everything has been consumed: keep the allocated capacity (unless a large reply made it grow), no copy required
+    m_sBuffer.clear();
+    m_uBufferPos = 0;
+    shrink();
+  } else if (uDiscard && (bForce || uDiscard >= __CPP_REDIS_BUFFER_COMPACT_THRESHOLD)) {
+    m_sBuffer.erase(0, uDiscard);
+    m_uBufferPos -= uDiscard;
+
+    if (m_bReplyStarted && m_bReplyIsView)
+      m_uReplyBegin -= uDiscard;
+
+    for (auto& available : m_deqAvailableReplies) {
+      if (available.bView) {
+        available.uBegin -= uDiscard;
+        available.uEnd -= uDiscard;
+      }
+    }
+  }
+}
+
+bool
+reply_builder::check_buffer_size(void) {
+  if (!m_limits.uMaxBufferSize)
+    return true;
+
+  //! once compacted, only the bytes still required remain before the current position (or a few unused ones,
+  //! below the compaction threshold)
+  std::size_t uKept = m_sBuffer.size() - m_uBufferPos;
+  if (m_bReplyStarted && m_bReplyIsView)
+    uKept = m_sBuffer.size() - m_uReplyBegin;
+
+  for (const auto& available : m_deqAvailableReplies) {
+    if (available.bView) {
+      uKept = m_sBuffer.size() - available.uBegin;
+      break;
+    }
+  }
+
+  if (uKept <= m_limits.uMaxBufferSize)
+    return true;
+
+  __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_builder receive buffer exceeds the maximum size");
+  m_szError = "Receive buffer exceeds the maximum size";
+
+  return false;
+}
+
+void
+reply_builder::shrink(void) {
+  //! the buffer reserved for a bulk string in progress is still needed
+  if (!m_sBuffer.empty() || !m_limits.uShrinkThreshold || m_sBuffer.capacity() <= m_limits.uShrinkThreshold ||
+      m_parser.pending_size())
+    return;
+
+  std::string().swap(m_sBuffer);
+}
+
+void
+reply_builder::reserve_pending(void) {
+  std::size_t uPending = m_parser.pending_size();
+  if (uPending > max_reserved_size || uPending <= m_sBuffer.size() - m_uBufferPos || m_uBufferPos + uPending <= m_sBuffer.capacity())
+    return;
+
+  compact(true);
+  m_sBuffer.reserve(m_uBufferPos + uPending);
 }
 
 bool
 reply_builder::build_reply(void) {
-  if (!m_sBuffer.size())
+  if (m_uBufferPos >= m_sBuffer.size() || m_szError)
     return false;
 
-  if (!m_ptrBuilder) {
-    m_ptrBuilder = create_builder(m_sBuffer.front());
-    m_sBuffer.erase(0, 1);
+  if (!m_bReplyStarted) {
+    reply_handler_iface* ptrHandler = m_fnHandlerSelector ? m_fnHandlerSelector(m_deqAvailableReplies.size()) : nullptr;
+
+    //! events must not be emitted before the preceding replies have been popped: wait for resume()
+    if (ptrHandler && reply_available())
+      return false;
+
+    m_bReplyStarted   = true;
+    m_ptrReplyHandler = ptrHandler;
+    m_bReplyIsView    = !ptrHandler && m_fnViewPredicate && m_fnViewPredicate(m_deqAvailableReplies.size());
+    m_uReplyBegin     = m_uBufferPos;
   }
 
-  *m_ptrBuilder << m_sBuffer;
+  if (m_ptrReplyHandler) {
+    if (m_parser.try_emit(m_sBuffer, m_uBufferPos, *m_ptrReplyHandler) != reply_parser::status::complete)
+      return false;
 
-  if (m_ptrBuilder->reply_ready()) {
-    m_deqAvailableReplies.push_back(m_ptrBuilder->get_reply());
-    m_ptrBuilder = nullptr;
+    m_deqAvailableReplies.push_back({reply(), false, 0, 0});
+  } else if (m_bReplyIsView) {
+    if (m_parser.try_skip(m_sBuffer, m_uBufferPos) != reply_parser::status::complete)
+      return false;
 
-    return true;
+    m_deqAvailableReplies.push_back({reply(), true, m_uReplyBegin, m_uBufferPos});
+  } else {
+    if (m_parser.try_consume(m_sBuffer, m_uBufferPos) != reply_parser::status::complete)
+      return false;
+
+    m_deqAvailableReplies.push_back({m_parser.take_reply(), false, 0, 0});
   }
 
-  return false;
+  m_bReplyStarted = false;
+
+  return true;
 }
 
 void
@@ -78,7 +248,27 @@ reply_builder::get_front(void) const {
   if (!reply_available())
     throw redis_error("No available reply");
 
-  return m_deqAvailableReplies.front();
+  if (m_deqAvailableReplies.front().bView)
+    throw redis_error("Reply is only available as a view");
+
+  return m_deqAvailableReplies.front().value;
+}
+
+bool
+reply_builder::front_is_view(void) const {
+  return reply_available() && m_deqAvailableReplies.front().bView;
+}
+
+reply_view
+reply_builder::get_front_view(void) const {
+  if (!reply_available())
+    throw redis_error("No available reply");
+
+  const available_reply& front = m_deqAvailableReplies.front();
+  if (!front.bView)
+    throw redis_error("Reply is not a view");
+
+  return reply_view(m_sBuffer.data() + front.uBegin, front.uEnd - front.uBegin);
 }
 
 void
@@ -89,6 +279,53 @@ reply_builder::pop_front(void) {
   m_deqAvailableReplies.pop_front();
 }
 
+reply
+reply_builder::take_front(void) {
+  if (!reply_available())
+    throw redis_error("No available reply");
+
+  reply front = front_is_view() ? get_front_view().to_reply() : std::move(m_deqAvailableReplies.front().value);
+  m_deqAvailableReplies.pop_front();
+
+  return front;
+}
+
+void
+reply_builder::set_pool_enabled(bool bEnabled) {
+  m_bPoolEnabled = bEnabled;
+  m_parser.set_pool(bEnabled ? &m_pool : nullptr);
+
+  if (!bEnabled)
+    m_pool.clear();
+}
+
+bool
+reply_builder::is_pool_enabled(void) const {
+  return m_bPoolEnabled;
+}
+
+void
+reply_builder::recycle(reply& reply) {
+  if (m_bPoolEnabled)
+    m_pool.release(reply);
+}
+
+void
+reply_builder::set_limits(const reply_limits& limits) {
+  m_limits = limits;
+  m_parser.set_limits(limits);
+}
+
+void
+reply_builder::set_view_predicate(const view_predicate_t& predicate) {
+  m_fnViewPredicate = predicate;
+}
+
+void
+reply_builder::set_handler_selector(const handler_selector_t& selector) {
+  m_fnHandlerSelector = selector;
+}
+
 bool
 reply_builder::reply_available(void) const {
   return m_deqAvailableReplies.size() > 0;
@@ -0,0 +1,70 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_event_parser.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+reply_event_parser::reply_event_parser(reply_handler_iface& handler)
+: m_handler(handler)
+, m_uRepliesCount(0) {}
+
+reply_event_parser&
+reply_event_parser::operator<<(const std::string& sData) {
+  std::size_t uPos = 0;
+
+  if (m_sBuffer.empty()) {
+    //! nothing left from previous calls: parse the data in place
+    parse(sData, uPos);
+    m_sBuffer.assign(sData, uPos, std::string::npos);
+  } else {
+    m_sBuffer += sData;
+    parse(m_sBuffer, uPos);
+    m_sBuffer.erase(0, uPos);
+  }
+
+  return *this;
+}
+
+void
+reply_event_parser::parse(const std::string& sBuffer, std::size_t& uPos) {
+  while (uPos < sBuffer.size() && m_parser.emit(sBuffer, uPos, m_handler))
+    ++m_uRepliesCount;
+}
+
+std::size_t
+reply_event_parser::replies_count(void) const {
+  return m_uRepliesCount;
+}
+
+void
+reply_event_parser::reset(void) {
+  m_parser.reset();
+  m_sBuffer.clear();
+  m_uRepliesCount = 0;
+}
+
+} // namespace builders
+
+} // namespace cpp_redis
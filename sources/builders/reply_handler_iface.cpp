@@ -0,0 +1,52 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_handler_iface.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+void
+reply_handler_iface::on_array_begin(std::size_t) {}
+
+void
+reply_handler_iface::on_array_end(void) {}
+
+void
+reply_handler_iface::on_bulk(const string_ref&, bool) {}
+
+void
+reply_handler_iface::on_simple_string(const string_ref&) {}
+
+void
+reply_handler_iface::on_error(const string_ref&) {}
+
+void
+reply_handler_iface::on_integer(int64_t) {}
+
+void
+reply_handler_iface::on_null(void) {}
+
+} // namespace builders
+
+} // namespace cpp_redis
@@ -0,0 +1,400 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_parser.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/logger.hpp>
+#include <cpp_redis/misc/scan.hpp>
+
+#include <algorithm>
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! maximum number of rows reserved upfront for an array, whatever its announced size
+//!
+static const int64_t max_reserved_rows = 65536;
+
+reply_parser::reply_parser(void)
+: m_uDepth(0)
+, m_nBulkSize(-1)
+, m_uScanned(0)
+, m_eMode(mode::build)
+, m_ptrHandler(nullptr)
+, m_szError(nullptr)
+, m_ptrPool(nullptr) {}
+
+//!
+//! convert a status to the result of the throwing parsing functions
+//!
+static bool
+check_status(reply_parser::status eStatus, const char* szError) {
+  if (eStatus == reply_parser::status::invalid)
+    throw redis_error(szError);
+
+  return eStatus == reply_parser::status::complete;
+}
+
+bool
+reply_parser::consume(const std::string& sBuffer, std::size_t& uPos) {
+  status eStatus = try_consume(sBuffer, uPos);
+
+  return check_status(eStatus, m_szError);
+}
+
+bool
+reply_parser::skip(const std::string& sBuffer, std::size_t& uPos) {
+  status eStatus = try_skip(sBuffer, uPos);
+
+  return check_status(eStatus, m_szError);
+}
+
+bool
+reply_parser::emit(const std::string& sBuffer, std::size_t& uPos, reply_handler_iface& handler) {
+  status eStatus = try_emit(sBuffer, uPos, handler);
+
+  return check_status(eStatus, m_szError);
+}
+
+reply_parser::status
+reply_parser::try_consume(const std::string& sBuffer, std::size_t& uPos) {
+  m_eMode = mode::build;
+
+  return parse(sBuffer, uPos);
+}
+
+reply_parser::status
+reply_parser::try_skip(const std::string& sBuffer, std::size_t& uPos) {
+  m_eMode = mode::skip;
+
+  return parse(sBuffer, uPos);
+}
+
+reply_parser::status
+reply_parser::try_emit(const std::string& sBuffer, std::size_t& uPos, reply_handler_iface& handler) {
+  m_eMode      = mode::events;
+  m_ptrHandler = &handler;
+
+  return parse(sBuffer, uPos);
+}
+
+const char*
+reply_parser::get_error(void) const {
+  return m_szError;
+}
+
+reply_parser::status
+reply_parser::parse(const std::string& sBuffer, std::size_t& uPos) {
+  if (m_szError)
+    return status::invalid;
+
+  for (;;) {
+    reply value;
+
+    if (m_nBulkSize >= 0) {
+      if (!read_bulk_string(sBuffer, uPos, value))
+        return m_szError ? status::invalid : status::incomplete;
+    } else {
+      std::size_t uHeaderPos = uPos;
+
+      if (!read_header(sBuffer, uPos, value)) {
+        if (m_szError)
+          return status::invalid;
+
+        //! nothing consumed: wait for more data
+        if (uPos == uHeaderPos)
+          return status::incomplete;
+
+        //! header of an array or a bulk string consumed: keep going with its content
+        continue;
+      }
+    }
+
+    if (add_value(value))
+      return status::complete;
+  }
+}
+
+bool
+reply_parser::fail(const char* szError) {
+  m_szError = szError;
+
+  return false;
+}
+
+bool
+reply_parser::read_header(const std::string& sBuffer, std::size_t& uPos, reply& value) {
+  if (uPos >= sBuffer.size())
+    return false;
+
+  //! do not scan again what has been scanned by previous calls (keep the last byte, it may be a '\r')
+  std::size_t uScanFrom = uPos + 1 + (m_uScanned ? m_uScanned - 1 : 0);
+  const char* pLineEnd  = scan::find_crlf(sBuffer.data() + uScanFrom, sBuffer.data() + sBuffer.size());
+  if (pLineEnd == sBuffer.data() + sBuffer.size()) {
+    m_uScanned = sBuffer.size() - uPos - 1;
+    return false;
+  }
+
+  std::size_t uEnd = static_cast<std::size_t>(pLineEnd - sBuffer.data());
+
+  char cType   = sBuffer[uPos];
+  m_uScanned   = 0;
+
+  switch (cType) {
+  case '+':
+    if (m_eMode == mode::build)
+      value.set(make_string(sBuffer, uPos + 1, uEnd - uPos - 1), reply::string_type::simple_string);
+    else if (m_eMode == mode::events)
+      m_ptrHandler->on_simple_string(string_ref(sBuffer.data() + uPos + 1, uEnd - uPos - 1));
+    break;
+  case '-':
+    if (m_eMode == mode::build)
+      value.set(make_string(sBuffer, uPos + 1, uEnd - uPos - 1), reply::string_type::error);
+    else if (m_eMode == mode::events)
+      m_ptrHandler->on_error(string_ref(sBuffer.data() + uPos + 1, uEnd - uPos - 1));
+    break;
+  case ':': {
+    int64_t nValue;
+    if (!parse_integer(sBuffer, uPos + 1, uEnd, nValue))
+      return false;
+
+    if (m_eMode == mode::build)
+      value.set(nValue);
+    else if (m_eMode == mode::events)
+      m_ptrHandler->on_integer(nValue);
+    break;
+  }
+  case '$': {
+    int64_t nSize;
+    if (!parse_integer(sBuffer, uPos + 1, uEnd, nSize))
+      return false;
+
+    if (nSize == -1) {
+      if (m_eMode == mode::events)
+        m_ptrHandler->on_null();
+      value.set();
+      break;
+    } else if (nSize < 0) {
+      __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives invalid bulk string size");
+      return fail("Invalid bulk string size");
+    } else if (m_limits.uMaxBulkLength && static_cast<uint64_t>(nSize) > m_limits.uMaxBulkLength) {
+      __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives bulk string over the maximum length");
+      return fail("Bulk string exceeds the maximum length");
+    }
+
+    if (m_eMode == mode::events && nSize == 0)
+      m_ptrHandler->on_bulk(string_ref(), true);
+
+    m_nBulkSize = nSize;
+    uPos        = uEnd + 2;
+    return false;
+  }
+  case '*': {
+    int64_t nSize;
+    if (!parse_integer(sBuffer, uPos + 1, uEnd, nSize))
+      return false;
+
+    if (nSize < 0) {
+      if (m_eMode == mode::events)
+        m_ptrHandler->on_null();
+      value.set();
+      break;
+    } else if (nSize == 0) {
+      if (m_eMode == mode::events) {
+        m_ptrHandler->on_array_begin(0);
+        m_ptrHandler->on_array_end();
+      }
+      value.set(std::vector<reply>{});
+      break;
+    } else if (m_limits.uMaxArraySize && static_cast<uint64_t>(nSize) > m_limits.uMaxArraySize) {
+      __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives array over the maximum size");
+      return fail("Array exceeds the maximum number of elements");
+    }
+
+    if (m_eMode == mode::events)
+      m_ptrHandler->on_array_begin(static_cast<std::size_t>(nSize));
+
+    if (!push_frame(nSize))
+      return false;
+
+    uPos = uEnd + 2;
+    return false;
+  }
+  default:
+    __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives invalid data type");
+    return fail("Invalid data");
+  }
+
+  uPos = uEnd + 2;
+
+  return true;
+}
+
+bool
+reply_parser::read_bulk_string(const std::string& sBuffer, std::size_t& uPos, reply& value) {
+  std::size_t uSize = static_cast<std::size_t>(m_nBulkSize);
+
+  //! events: pass the content as soon as it is received, it does not have to be kept in the buffer
+  if (m_eMode == mode::events && uSize) {
+    std::size_t uChunk = std::min(sBuffer.size() - uPos, uSize);
+    if (!uChunk)
+      return false;
+
+    uSize -= uChunk;
+    m_nBulkSize = static_cast<int64_t>(uSize);
+    m_ptrHandler->on_bulk(string_ref(sBuffer.data() + uPos, uChunk), uSize == 0);
+    uPos += uChunk;
+
+    if (uSize)
+      return false;
+  }
+
+  //! also wait for end sequence
+  if (sBuffer.size() - uPos < uSize + 2)
+    return false;
+
+  if (sBuffer[uPos + uSize] != '\r' || sBuffer[uPos + uSize + 1] != '\n') {
+    __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives invalid ending sequence");
+    return fail("Wrong ending sequence");
+  }
+
+  if (m_eMode == mode::build)
+    value.set(make_string(sBuffer, uPos, uSize), reply::string_type::bulk_string);
+  uPos += uSize + 2;
+  m_nBulkSize = -1;
+
+  return true;
+}
+
+bool
+reply_parser::push_frame(int64_t nSize) {
+  if (m_uDepth == __CPP_REDIS_MAX_NESTING_DEPTH) {
+    __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives too deeply nested arrays");
+    return fail("Reply nesting too deep");
+  }
+
+  frame& current = m_frames[m_uDepth++];
+  current.nRemaining = nSize;
+
+  if (m_eMode != mode::build)
+    return true;
+
+  if (m_ptrPool)
+    current.vctRows = m_ptrPool->acquire_rows();
+  current.vctRows.clear();
+  current.vctRows.reserve(static_cast<std::size_t>(nSize < max_reserved_rows ? nSize : max_reserved_rows));
+
+  return true;
+}
+
+bool
+reply_parser::add_value(reply& value) {
+  while (m_uDepth) {
+    frame& current = m_frames[m_uDepth - 1];
+
+    if (m_eMode == mode::build)
+      current.vctRows.push_back(std::move(value));
+    if (--current.nRemaining)
+      return false;
+
+    //! array is complete: pop it and append it to its parent
+    if (m_eMode == mode::build) {
+      value.set(std::move(current.vctRows));
+      current.vctRows.clear();
+    } else if (m_eMode == mode::events) {
+      m_ptrHandler->on_array_end();
+    }
+    --m_uDepth;
+  }
+
+  if (m_eMode == mode::build)
+    m_reply = std::move(value);
+
+  return true;
+}
+
+bool
+reply_parser::parse_integer(const std::string& sBuffer, std::size_t uBegin, std::size_t uEnd, int64_t& nValue) {
+  if (!scan::parse_integer(sBuffer.data() + uBegin, sBuffer.data() + uEnd, nValue)) {
+    __CPP_REDIS_LOG(error, "cpp_redis::builders::reply_parser receives invalid digit character");
+    return fail("Invalid character for integer redis reply");
+  }
+
+  return true;
+}
+
+std::string
+reply_parser::make_string(const std::string& sBuffer, std::size_t uPos, std::size_t uSize) {
+  if (!m_ptrPool)
+    return sBuffer.substr(uPos, uSize);
+
+  std::string str = m_ptrPool->acquire_string();
+  str.assign(sBuffer, uPos, uSize);
+
+  return str;
+}
+
+const reply&
+reply_parser::get_reply(void) const {
+  return m_reply;
+}
+
+reply
+reply_parser::take_reply(void) {
+  return std::move(m_reply);
+}
+
+std::size_t
+reply_parser::pending_size(void) const {
+  //! events do not require the content of bulk strings to be buffered
+  if (m_eMode == mode::events)
+    return 0;
+
+  return m_nBulkSize >= 0 ? static_cast<std::size_t>(m_nBulkSize) + 2 : 0;
+}
+
+void
+reply_parser::reset(void) {
+  for (std::size_t i = 0; i < m_uDepth; ++i)
+    m_frames[i].vctRows.clear();
+
+  m_uDepth    = 0;
+  m_nBulkSize = -1;
+  m_uScanned  = 0;
+  m_szError   = nullptr;
+}
+
+void
+reply_parser::set_pool(reply_pool* ptrPool) {
+  m_ptrPool = ptrPool;
+}
+
+void
+reply_parser::set_limits(const reply_limits& limits) {
+  m_limits = limits;
+}
+
+} // namespace builders
+
+} // namespace cpp_redis
@@ -0,0 +1,97 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_pool.hpp>
+
+namespace cpp_redis {
+
+namespace builders {
+
+//!
+//! strings or row vectors using more memory than this are freed instead of being kept in the pool
+//! so that a single huge reply does not pin its memory forever
+//!
+static const std::size_t max_pooled_string_capacity = 64 * 1024;
+static const std::size_t max_pooled_rows_capacity   = 4096;
+
+std::string
+reply_pool::acquire_string(void) {
+  if (m_vctStrings.empty())
+    return std::string();
+
+  std::string str = std::move(m_vctStrings.back());
+  m_vctStrings.pop_back();
+
+  return str;
+}
+
+std::vector<reply>
+reply_pool::acquire_rows(void) {
+  if (m_vctRows.empty())
+    return std::vector<reply>();
+
+  std::vector<reply> rows = std::move(m_vctRows.back());
+  m_vctRows.pop_back();
+
+  return rows;
+}
+
+void
+reply_pool::release(reply& r) {
+  switch (r.m_eType) {
+  case reply::type::array:
+    for (auto& row : r.m_vctRows)
+      release(row);
+
+    if (m_vctRows.size() < __CPP_REDIS_REPLY_POOL_SIZE && r.m_vctRows.capacity() <= max_pooled_rows_capacity) {
+      r.m_vctRows.clear();
+      m_vctRows.push_back(std::move(r.m_vctRows));
+    }
+    break;
+  case reply::type::error:
+  case reply::type::bulk_string:
+  case reply::type::simple_string:
+    //! strings small enough to be stored inline do not own any allocated storage
+    if (m_vctStrings.size() < __CPP_REDIS_REPLY_POOL_SIZE && r.m_sValue.capacity() > std::string().capacity() &&
+        r.m_sValue.capacity() <= max_pooled_string_capacity) {
+      r.m_sValue.clear();
+      m_vctStrings.push_back(std::move(r.m_sValue));
+    }
+    break;
+  default:
+    break;
+  }
+
+  r.set();
+}
+
+void
+reply_pool::clear(void) {
+  m_vctStrings.clear();
+  m_vctStrings.shrink_to_fit();
+  m_vctRows.clear();
+  m_vctRows.shrink_to_fit();
+}
+
+} // namespace builders
+
+} // namespace cpp_redis
@@ -22,6 +22,7 @@
 
 #include <cpp_redis/builders/simple_string_builder.hpp>
 #include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/scan.hpp>
 
 namespace cpp_redis {
 
@@ -32,17 +33,18 @@ simple_string_builder::simple_string_builder(void)
 , m_bReplyReady(false) {}
 
 builder_iface&
-simple_string_builder::operator<<(std::string& buffer) {
+simple_string_builder::consume(const std::string& buffer, std::size_t& pos) {
   if (m_bReplyReady)
     return *this;
 
-  auto end_sequence = buffer.find("\r\n");
-  if (end_sequence == std::string::npos)
+  const char* data         = buffer.data();
+  const char* end_sequence = scan::find_crlf(data + pos, data + buffer.size());
+  if (end_sequence == data + buffer.size())
     return *this;
 
-  m_sValue = buffer.substr(0, end_sequence);
+  m_sValue.assign(data + pos, end_sequence);
   m_reply.set(m_sValue, reply::string_type::simple_string);
-  buffer.erase(0, end_sequence + 2);
+  pos = static_cast<std::size_t>(end_sequence - data) + 2;
   m_bReplyReady = true;
 
   return *this;
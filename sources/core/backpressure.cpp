@@ -0,0 +1,34 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/backpressure.hpp>
+
+namespace cpp_redis {
+
+backpressure_limits::backpressure_limits(void)
+: uHighBytes(__CPP_REDIS_HIGH_WATERMARK_BYTES)
+, uLowBytes(__CPP_REDIS_LOW_WATERMARK_BYTES)
+, uHighCommands(__CPP_REDIS_HIGH_WATERMARK_COMMANDS)
+, uLowCommands(__CPP_REDIS_LOW_WATERMARK_COMMANDS)
+, ePolicy(backpressure_policy::block)
+, callback(nullptr) {}
+
+} // namespace cpp_redis
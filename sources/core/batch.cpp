@@ -0,0 +1,78 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/batch.hpp>
+#include <cpp_redis/network/command_encoder.hpp>
+
+namespace cpp_redis {
+
+batch&
+batch::send(const std::vector<std::string>& vctRedisCmd) {
+  network::command_encoder::encode(vctRedisCmd, m_vctBuffer);
+  end_command();
+
+  return *this;
+}
+
+void
+batch::end_command(void) {
+  m_vctEnds.push_back(m_vctBuffer.size());
+}
+
+void
+batch::reserve(std::size_t uBytes, std::size_t uCommands) {
+  m_vctBuffer.reserve(uBytes);
+  m_vctEnds.reserve(uCommands);
+}
+
+void
+batch::clear(void) {
+  m_vctBuffer.clear();
+  m_vctEnds.clear();
+}
+
+std::size_t
+batch::size(void) const {
+  return m_vctEnds.size();
+}
+
+bool
+batch::empty(void) const {
+  return m_vctEnds.empty();
+}
+
+const std::vector<char>&
+batch::get_buffer(void) const {
+  return m_vctBuffer;
+}
+
+std::size_t
+batch::get_offset(std::size_t uIndex) const {
+  return uIndex ? m_vctEnds[uIndex - 1] : 0;
+}
+
+std::size_t
+batch::get_size(std::size_t uIndex) const {
+  return m_vctEnds[uIndex] - get_offset(uIndex);
+}
+
+} // namespace cpp_redis
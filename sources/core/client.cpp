@@ -30,7 +30,16 @@ namespace cpp_redis {
 client::client(void)
 : m_bReconnecting_a(false)
 , m_bCancel_a(false)
-, m_uRunningCallbacks_a(0) {
+, m_uRunningCallbacks_a(0)
+, m_uPendingViews_a(0)
+, m_uPendingHandlers_a(0)
+, m_bAutoCommit_a(false)
+, m_uSubmittedBytes_a(0)
+, m_uSubmittedCommands_a(0)
+, m_uPendingBytes_a(0)
+, m_uPendingCommands_a(0)
+, m_bSaturated_a(false)
+, m_idReceiving_a(std::thread::id()) {
   __CPP_REDIS_LOG(debug, "cpp_redis::client created");
 }
 #endif /* __CPP_REDIS_USE_CUSTOM_TCP_CLIENT */
@@ -40,11 +49,23 @@ client::client(const std::shared_ptr<network::tcp_client_iface>& ptrTcpClient)
 , m_sentinel(ptrTcpClient)
 , m_bReconnecting_a(false)
 , m_bCancel_a(false)
-, m_uRunningCallbacks_a(0) {
+, m_uRunningCallbacks_a(0)
+, m_uPendingViews_a(0)
+, m_uPendingHandlers_a(0)
+, m_bAutoCommit_a(false)
+, m_uSubmittedBytes_a(0)
+, m_uSubmittedCommands_a(0)
+, m_uPendingBytes_a(0)
+, m_uPendingCommands_a(0)
+, m_bSaturated_a(false)
+, m_idReceiving_a(std::thread::id()) {
   __CPP_REDIS_LOG(debug, "cpp_redis::client created");
 }
 
 client::~client(void) {
+  //! the auto commit thread commits through this instance
+  stop_auto_commit();
+
   //! ensure we stopped reconnection attemps
   if (!m_bCancel_a) {
     cancel_reconnect();
@@ -60,6 +81,10 @@ client::~client(void) {
     m_redisConnection.disconnect(true);
   }
 
+  //! wait for the threads calling the callbacks of the failed commands, which use this instance
+  std::unique_lock<std::mutex> lock_callback(m_mtxCallbacks);
+  m_cvSync.wait(lock_callback, [=] { return m_uRunningCallbacks_a == 0; });
+
   __CPP_REDIS_LOG(debug, "cpp_redis::client destroyed");
 }
 
@@ -105,9 +130,12 @@ client::connect(
   }
 
   auto const& handlerDisconnection = std::bind(&client::connection_disconnection_handler, this, std::placeholders::_1);
-  auto const& handlerReceive       = std::bind(&client::connection_receive_handler, this, std::placeholders::_1,
-      std::placeholders::_2);
-  m_redisConnection.connect(sHost, uPort, handlerDisconnection, handlerReceive, uTimeoutMsecs);
+  m_redisConnection.set_replies_callback(std::bind(&client::connection_receive_handler, this, std::placeholders::_1,
+      std::placeholders::_2));
+  m_redisConnection.set_reply_view_handlers(std::bind(&client::is_view_reply, this, std::placeholders::_1),
+      std::bind(&client::connection_view_receive_handler, this, std::placeholders::_1, std::placeholders::_2));
+  m_redisConnection.set_reply_handler_selector(std::bind(&client::reply_handler_for, this, std::placeholders::_1));
+  m_redisConnection.connect(sHost, uPort, handlerDisconnection, nullptr, uTimeoutMsecs);
 
   __CPP_REDIS_LOG(info, "cpp_redis::client connected");
 
@@ -124,8 +152,9 @@ client::disconnect(bool bWaitForRemoval) {
   //! close connection
   m_redisConnection.disconnect(bWaitForRemoval);
 
-  //! make sure we clear buffer of unsent commands
-  clear_callbacks();
+  //! make sure we clear buffer of unsent commands, including the ones not drained yet
+  std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+  clear_commands();
 
   __CPP_REDIS_LOG(info, "cpp_redis::client disconnected");
 }
@@ -145,6 +174,118 @@ client::is_reconnecting(void) const {
   return m_bReconnecting_a;
 }
 
+void
+client::set_reply_pool_enabled(bool bEnabled) {
+  m_redisConnection.set_reply_pool_enabled(bEnabled);
+}
+
+void
+client::set_reply_limits(const builders::reply_limits& limits) {
+  m_redisConnection.set_reply_limits(limits);
+}
+
+void
+client::set_bulk_split_limits(std::size_t uMaxArgs, std::size_t uMaxBytes) {
+  m_uBulkMaxArgs  = uMaxArgs;
+  m_uBulkMaxBytes = uMaxBytes;
+}
+
+void
+client::set_auto_commit(std::size_t uMaxBytes, std::size_t uMaxCommands, const std::chrono::microseconds& durDelay) {
+  stop_auto_commit();
+
+  {
+    std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+
+    //! the commands submitted so far are drained in the previous mode, which maintained the counters or not
+    drain_submissions();
+
+    m_uAutoCommitMaxBytes    = uMaxBytes;
+    m_uAutoCommitMaxCommands = uMaxCommands;
+    m_durAutoCommitDelay     = durDelay;
+    m_bAutoCommit_a          = uMaxBytes || uMaxCommands || durDelay.count() > 0;
+    m_uSubmittedBytes_a      = 0;
+    m_uSubmittedCommands_a   = 0;
+  }
+
+  if (m_durAutoCommitDelay.count() > 0) {
+    m_bAutoCommitPending = false;
+    m_bAutoCommitStop    = false;
+    m_threadAutoCommit   = std::thread(&client::auto_commit_loop, this);
+  }
+}
+
+void
+client::set_backpressure(const backpressure_limits& limits) {
+  m_backpressure  = limits;
+  m_bBackpressure = limits.uHighBytes || limits.uHighCommands;
+}
+
+pending_depth
+client::get_pending_depth(void) const {
+  return {m_uPendingBytes_a, m_uPendingCommands_a};
+}
+
+void
+client::set_replay_enabled(bool bEnabled) {
+  m_bReplay = bEnabled;
+}
+
+void
+client::stop_auto_commit(void) {
+  if (!m_threadAutoCommit.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mtxAutoCommit);
+    m_bAutoCommitStop = true;
+  }
+
+  m_cvAutoCommit.notify_all();
+  m_threadAutoCommit.join();
+}
+
+void
+client::auto_commit(void) {
+  try {
+    commit();
+  }
+  catch (const cpp_redis::redis_error&) {
+    //! the pending callbacks have already been notified of the failure
+    __CPP_REDIS_LOG(warn, "cpp_redis::client could not auto commit pipelined commands");
+  }
+}
+
+void
+client::auto_commit_loop(void) {
+  std::unique_lock<std::mutex> ulock(m_mtxAutoCommit);
+
+  while (!m_bAutoCommitStop) {
+    m_cvAutoCommit.wait(ulock, [=] { return m_bAutoCommitPending || m_bAutoCommitStop; });
+
+    //! let the commands submitted in the meantime join the batch
+    if (m_cvAutoCommit.wait_for(ulock, m_durAutoCommitDelay, [=] { return m_bAutoCommitStop; })) {
+      break;
+    }
+
+    m_bAutoCommitPending = false;
+    ulock.unlock();
+
+    //! the batch may already have been committed, by a threshold or by the user
+    if (m_uSubmittedCommands_a > 0) {
+      auto_commit();
+    }
+
+    ulock.lock();
+
+    //! commands whose submission was in progress may not have been drained, nor have armed the delay again
+    if (m_uSubmittedCommands_a > 0) {
+      m_bAutoCommitPending = true;
+    }
+  }
+}
+
 void
 client::add_sentinel(const std::string& host, std::size_t port, std::uint32_t timeout_msecs) {
   m_sentinel.add_sentinel(host, port, timeout_msecs);
@@ -167,19 +308,357 @@ client::clear_sentinels(void) {
 
 client&
 client::send(const std::vector<std::string>& vctRedisCmd, const reply_callback_t& callback) {
-  std::lock_guard<std::mutex> lockCallback(m_mtxCallbacks);
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(vctRedisCmd, vctFrame);
+  submit({std::move(vctFrame), nullptr, 0, take_callback(callback), nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+client&
+client::send(const std::vector<std::string>& vctRedisCmd, std::nullptr_t) {
+  return send(vctRedisCmd, reply_callback_t(nullptr));
+}
+
+client&
+client::send(const std::vector<std::string>& vctRedisCmd, const reply_view_callback_t& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(vctRedisCmd, vctFrame);
+  submit({std::move(vctFrame), nullptr, 0, nullptr, callback, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+client&
+client::send(const std::vector<std::string>& vctRedisCmd, const reply_handler_t& handler) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(vctRedisCmd, vctFrame);
+  submit({std::move(vctFrame), nullptr, 0, nullptr, nullptr, handler});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+client&
+client::send(const std::vector<std::string>& vctRedisCmd, const shared_value_t& value,
+    const reply_callback_t& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  //! the value is kept aside, to be written without being copied
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(vctRedisCmd, vctFrame, 1);
+  submit({std::move(vctFrame), value ? value : std::make_shared<const std::string>(), 0, take_callback(callback),
+      nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
 
-  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to store new command in the send buffer");
-  unprotected_send(vctRedisCmd, callback);
-  __CPP_REDIS_LOG(info, "cpp_redis::client stored new command in the send buffer");
+  return *this;
+}
+
+client&
+client::send(command_id eCommand, const std::vector<std::string>& vctArgs, const reply_callback_t& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(command_table::get(eCommand), vctArgs, vctFrame);
+  submit({std::move(vctFrame), nullptr, 0, take_callback(callback), nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+client&
+client::send(command_id eCommand, const std::vector<std::string>& vctArgs, const shared_value_t& value,
+    const reply_callback_t& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  //! the value is kept aside, to be written without being copied
+  std::vector<char> vctFrame;
+  network::command_encoder::encode(command_table::get(eCommand), vctArgs, vctFrame, 1);
+  submit({std::move(vctFrame), value ? value : std::make_shared<const std::string>(), 0, take_callback(callback),
+      nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
+
+  return *this;
+}
+
+client&
+client::send_encoded(std::vector<char>&& vctFrame, stored_reply_callback_t&& callback) {
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to submit new command");
+  submit({std::move(vctFrame), nullptr, 0, std::move(callback), nullptr, nullptr});
+  __CPP_REDIS_LOG(info, "cpp_redis::client submitted new command");
 
   return *this;
 }
 
+client::reply_future_t
+client::send_encoded(std::vector<char>&& vctFrame) {
+  reply_promise_t promise;
+  reply_future_t future = promise.get_future();
+
+  send_encoded(std::move(vctFrame), future_callback(std::move(promise)));
+
+  return future;
+}
+
+client&
+client::send_batch(const batch& commands, const batch_callback_t& callback) {
+  std::size_t uCommands = commands.size();
+
+  if (!uCommands) {
+    std::vector<reply> vctReplies;
+    if (callback) {
+      callback(vctReplies);
+    }
+    return *this;
+  }
+
+  auto ptrRequest = std::make_shared<batch_request>();
+  ptrRequest->vctReplies.resize(uCommands);
+  ptrRequest->uRemaining_a = uCommands;
+  ptrRequest->callback     = callback;
+
+  //! one callback per command, small enough to be stored without allocation
+  auto make_callback = [&ptrRequest](std::size_t uIndex) -> stored_reply_callback_t {
+    return [ptrRequest, uIndex](reply& reply) {
+      ptrRequest->vctReplies[uIndex] = std::move(reply);
+
+      if (--ptrRequest->uRemaining_a == 0 && ptrRequest->callback) {
+        ptrRequest->callback(ptrRequest->vctReplies);
+      }
+    };
+  };
+
+  const std::vector<char>& vctBuffer = commands.get_buffer();
+
+  if (!admit(vctBuffer.size(), uCommands)) {
+    for (std::size_t i = 0; i < uCommands; ++i) {
+      command_request request = {{}, nullptr, 0, make_callback(i), nullptr, nullptr};
+      fail_request(request, "too many pending commands");
+    }
+    return *this;
+  }
+
+  __CPP_REDIS_LOG(info, "cpp_redis::client attemps to send a batch of commands");
+  {
+    std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+
+    //! commands submitted before the batch are sent first
+    drain_submissions();
+
+    m_redisConnection.send_encoded(vctBuffer);
+
+    for (std::size_t i = 0; i < uCommands; ++i) {
+      command_request request = {{}, nullptr, commands.get_size(i), make_callback(i), nullptr, nullptr};
+
+      //! each command keeps its own frame to be replayed, the replies received before a reconnection being dequeued
+      if (m_bReplay) {
+        auto itBegin = vctBuffer.begin() + static_cast<std::ptrdiff_t>(commands.get_offset(i));
+        request.vctFrame.assign(itBegin, itBegin + static_cast<std::ptrdiff_t>(request.uSize));
+      }
+
+      m_queCommands.push_back(std::move(request));
+    }
+  }
+  __CPP_REDIS_LOG(info, "cpp_redis::client stored a batch of commands in the send buffer");
+
+  return commit();
+}
+
+std::future<std::vector<reply>>
+client::send_batch(const batch& commands) {
+  auto prms = std::make_shared<std::promise<std::vector<reply>>>();
+
+  send_batch(commands, [prms](std::vector<reply>& vctReplies) { prms->set_value(std::move(vctReplies)); });
+
+  return prms->get_future();
+}
+
+void
+client::unprotected_send(command_request&& request) {
+  if (request.value)
+    m_redisConnection.send_encoded(request.vctFrame, request.value);
+  else
+    m_redisConnection.send_encoded(request.vctFrame);
+
+  if (request.view_callback)
+    m_uPendingViews_a += 1;
+  if (request.handler)
+    m_uPendingHandlers_a += 1;
+
+  //! the pending command only keeps its callback when it is not to be replayed
+  if (!m_bReplay) {
+    std::vector<char>().swap(request.vctFrame);
+    request.value = nullptr;
+  }
+
+  m_queCommands.push_back(std::move(request));
+}
+
+void
+client::submit(command_request&& request) {
+  std::size_t uSize = request.vctFrame.size();
+  if (request.value)
+    uSize += network::command_encoder::bulk_size(request.value->size());
+  request.uSize = uSize;
+
+  //! accounted for before being pushed, so that the counters never go below the number of queued commands
+  if (!admit(uSize, 1)) {
+    fail_request(request, "too many pending commands");
+    return;
+  }
+
+  if (!m_bAutoCommit_a) {
+    m_queSubmissions.push(std::move(request));
+    return;
+  }
+
+  std::size_t uPrevBytes    = m_uSubmittedBytes_a.fetch_add(uSize);
+  std::size_t uPrevCommands = m_uSubmittedCommands_a.fetch_add(1);
+  m_queSubmissions.push(std::move(request));
+
+  //! only the sender crossing a threshold commits
+  if ((m_uAutoCommitMaxBytes && uPrevBytes < m_uAutoCommitMaxBytes && uPrevBytes + uSize >= m_uAutoCommitMaxBytes)
+      || (m_uAutoCommitMaxCommands && uPrevCommands + 1 == m_uAutoCommitMaxCommands)) {
+    auto_commit();
+  } else if (uPrevCommands == 0 && m_durAutoCommitDelay.count() > 0) {
+    //! first command of the batch: arm the delay
+    {
+      std::lock_guard<std::mutex> lock(m_mtxAutoCommit);
+      m_bAutoCommitPending = true;
+    }
+    m_cvAutoCommit.notify_one();
+  }
+}
+
 void
-client::unprotected_send(const std::vector<std::string>& vctRedisCmd, const reply_callback_t& callback) {
-  m_redisConnection.send(vctRedisCmd);
-  m_queCommands.push({vctRedisCmd, callback});
+client::drain_submissions(void) {
+  command_request request;
+
+  if (!m_bAutoCommit_a) {
+    while (m_queSubmissions.pop(request))
+      unprotected_send(std::move(request));
+    return;
+  }
+
+  std::size_t uBytes    = 0;
+  std::size_t uCommands = 0;
+
+  while (m_queSubmissions.pop(request)) {
+    uBytes += request.uSize;
+    uCommands += 1;
+    unprotected_send(std::move(request));
+  }
+
+  m_uSubmittedBytes_a -= uBytes;
+  m_uSubmittedCommands_a -= uCommands;
+}
+
+bool
+client::admit(std::size_t uBytes, std::size_t uCommands) {
+  for (;;) {
+    //! accounted for first, so that concurrent senders see each other's commands
+    std::size_t uPendingBytes    = m_uPendingBytes_a += uBytes;
+    std::size_t uPendingCommands = m_uPendingCommands_a += uCommands;
+
+    if (!m_bBackpressure) {
+      return true;
+    }
+
+    if (!m_bSaturated_a) {
+      if (!above_high_watermark(uPendingBytes, uPendingCommands)) {
+        return true;
+      }
+
+      //! no reply of the other pending commands would clear the saturation: the commands reaching the high
+      //! watermark on their own are sent
+      if (below_low_watermark(uPendingBytes - uBytes, uPendingCommands - uCommands)) {
+        return true;
+      }
+
+      //! only the sender reaching the high watermark reports the saturation
+      if (!m_bSaturated_a.exchange(true)) {
+        __CPP_REDIS_LOG(warn, "cpp_redis::client pending commands reached their high watermark");
+
+        if (m_backpressure.ePolicy == backpressure_policy::callback && m_backpressure.callback) {
+          m_backpressure.callback(true, get_pending_depth());
+        }
+      }
+    }
+
+    //! a reply callback blocked until the replies are received would prevent them from being received
+    if (m_backpressure.ePolicy == backpressure_policy::callback || m_idReceiving_a == std::this_thread::get_id()) {
+      return true;
+    }
+
+    //! not admitted: released, which clears the saturation if the pending commands completed in the meantime
+    release_pending(uBytes, uCommands);
+
+    if (m_backpressure.ePolicy == backpressure_policy::fail) {
+      return false;
+    }
+
+    //! the pending commands must be written for their replies to be received
+    auto_commit();
+
+    {
+      std::unique_lock<std::mutex> ulock(m_mtxBackpressure);
+      m_cvBackpressure.wait(ulock, [=] { return !m_bSaturated_a; });
+    }
+
+    //! the senders woken together check the high watermark again
+  }
+}
+
+bool
+client::above_high_watermark(std::size_t uBytes, std::size_t uCommands) const {
+  return (m_backpressure.uHighBytes && uBytes > m_backpressure.uHighBytes)
+    || (m_backpressure.uHighCommands && uCommands > m_backpressure.uHighCommands);
+}
+
+bool
+client::below_low_watermark(std::size_t uBytes, std::size_t uCommands) const {
+  return (!m_backpressure.uHighBytes || uBytes <= m_backpressure.uLowBytes)
+    && (!m_backpressure.uHighCommands || uCommands <= m_backpressure.uLowCommands);
+}
+
+void
+client::release_pending(std::size_t uBytes, std::size_t uCount) {
+  std::size_t uPendingBytes    = m_uPendingBytes_a -= uBytes;
+  std::size_t uPendingCommands = m_uPendingCommands_a -= uCount;
+
+  if (!m_bSaturated_a || !below_low_watermark(uPendingBytes, uPendingCommands)) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mtxBackpressure);
+
+    if (!m_bSaturated_a.exchange(false)) {
+      return;
+    }
+  }
+
+  __CPP_REDIS_LOG(info, "cpp_redis::client pending commands fell below their low watermark");
+  m_cvBackpressure.notify_all();
+
+  if (m_backpressure.ePolicy == backpressure_policy::callback && m_backpressure.callback) {
+    m_backpressure.callback(false, {uPendingBytes, uPendingCommands});
+  }
+}
+
+void
+client::fail_request(command_request& request, const std::string& sError) {
+  if (request.callback) {
+    reply r = {sError, reply::string_type::error};
+    request.callback(r);
+  } else if (request.view_callback) {
+    std::string sEncoded = "-" + sError + "\r\n";
+    request.view_callback(reply_view(sEncoded.data(), sEncoded.size()));
+  } else if (request.handler) {
+    request.handler->on_error(string_ref(sError.data(), sError.size()));
+  }
 }
 
 //! commit pipelined transaction
@@ -204,13 +683,25 @@ client::sync_commit(void) {
 
   std::unique_lock<std::mutex> ulockCallback(m_mtxCallbacks);
   __CPP_REDIS_LOG(debug, "cpp_redis::client waiting for callbacks to complete");
-  m_cvSync.wait(ulockCallback, [=] { return m_uRunningCallbacks_a == 0 && m_queCommands.empty(); });
+  m_cvSync.wait(ulockCallback, [=] {
+    return m_uRunningCallbacks_a == 0 && m_queCommands.empty() && m_queSubmissions.empty();
+  });
   __CPP_REDIS_LOG(debug, "cpp_redis::client finished waiting for callback completion");
   return *this;
 }
 
 void
 client::try_commit(void) {
+  {
+    std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+    drain_submissions();
+  }
+
+  unprotected_try_commit();
+}
+
+void
+client::unprotected_try_commit(void) {
   try {
     __CPP_REDIS_LOG(debug, "cpp_redis::client attempts to send pipelined commands");
     m_redisConnection.commit();
@@ -225,30 +716,131 @@ client::try_commit(void) {
 }
 
 void
-client::connection_receive_handler(network::redis_connection&, reply& reply) {
-  reply_callback_t callback = nullptr;
+client::dequeue_command(command_request& request) {
+  bool bDequeued = false;
 
-  __CPP_REDIS_LOG(info, "cpp_redis::client received reply");
   {
     std::lock_guard<std::mutex> lock(m_mtxCallbacks);
     m_uRunningCallbacks_a += 1;
 
     if (m_queCommands.size()) {
-      callback = m_queCommands.front().callback;
-      m_queCommands.pop();
+      request = std::move(m_queCommands.front());
+      m_queCommands.pop_front();
+      bDequeued = true;
+
+      if (request.view_callback)
+        m_uPendingViews_a -= 1;
+      if (request.handler)
+        m_uPendingHandlers_a -= 1;
     }
   }
 
-  if (callback) {
-    __CPP_REDIS_LOG(debug, "cpp_redis::client executes reply callback");
-    callback(reply);
+  if (bDequeued) {
+    release_pending(request.uSize, 1);
   }
+}
+
+void
+client::dequeue_commands(std::vector<command_request>& vctRequests, std::size_t uCount) {
+  std::size_t uBytes    = 0;
+  std::size_t uDequeued = 0;
+
+  vctRequests.resize(uCount);
 
   {
     std::lock_guard<std::mutex> lock(m_mtxCallbacks);
-    m_uRunningCallbacks_a -= 1;
-    m_cvSync.notify_all();
+    m_uRunningCallbacks_a += __CPP_REDIS_LENGTH(uCount);
+
+    for (; uDequeued < uCount && !m_queCommands.empty(); ++uDequeued) {
+      vctRequests[uDequeued] = std::move(m_queCommands.front());
+      m_queCommands.pop_front();
+
+      if (vctRequests[uDequeued].view_callback)
+        m_uPendingViews_a -= 1;
+      if (vctRequests[uDequeued].handler)
+        m_uPendingHandlers_a -= 1;
+    }
   }
+
+  for (std::size_t i = 0; i < uDequeued; ++i)
+    uBytes += vctRequests[i].uSize;
+
+  if (uDequeued) {
+    release_pending(uBytes, uDequeued);
+  }
+}
+
+void
+client::release_running_callbacks(std::size_t uCount) {
+  std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+  m_uRunningCallbacks_a -= __CPP_REDIS_LENGTH(uCount);
+  m_cvSync.notify_all();
+}
+
+void
+client::connection_receive_handler(network::redis_connection&, std::vector<reply>& vctReplies) {
+  std::vector<command_request> vctRequests;
+
+  __CPP_REDIS_LOG(info, "cpp_redis::client received replies");
+  dequeue_commands(vctRequests, vctReplies.size());
+
+  m_idReceiving_a = std::this_thread::get_id();
+
+  for (std::size_t i = 0; i < vctReplies.size(); ++i) {
+    //! for commands with a reply handler, the content of the reply has already been passed to the handler
+    if (vctRequests[i].callback) {
+      __CPP_REDIS_LOG(debug, "cpp_redis::client executes reply callback");
+      vctRequests[i].callback(vctReplies[i]);
+    }
+  }
+
+  m_idReceiving_a = std::thread::id();
+
+  release_running_callbacks(vctReplies.size());
+}
+
+void
+client::connection_view_receive_handler(network::redis_connection&, const reply_view& reply) {
+  command_request request;
+
+  __CPP_REDIS_LOG(info, "cpp_redis::client received reply");
+  dequeue_command(request);
+
+  m_idReceiving_a = std::this_thread::get_id();
+
+  if (request.view_callback) {
+    __CPP_REDIS_LOG(debug, "cpp_redis::client executes reply view callback");
+    request.view_callback(reply);
+  } else if (request.callback) {
+    auto built_reply = reply.to_reply();
+    request.callback(built_reply);
+  }
+
+  m_idReceiving_a = std::thread::id();
+
+  release_running_callbacks();
+}
+
+bool
+client::is_view_reply(std::size_t uIndex) {
+  //! only look the queue up when some commands expect a view
+  if (m_uPendingViews_a == 0)
+    return false;
+
+  std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+
+  return uIndex < m_queCommands.size() && m_queCommands[uIndex].view_callback;
+}
+
+builders::reply_handler_iface*
+client::reply_handler_for(std::size_t uIndex) {
+  //! only look the queue up when some commands have a reply handler
+  if (m_uPendingHandlers_a == 0)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock(m_mtxCallbacks);
+
+  return uIndex < m_queCommands.size() ? m_queCommands[uIndex].handler.get() : nullptr;
 }
 
 void
@@ -258,42 +850,83 @@ client::clear_callbacks(void) {
   }
 
   //! dequeue commands and move them to a local variable
-  std::queue<command_request> queCommands = std::move(m_queCommands);
+  ring_buffer<command_request> queCommands = std::move(m_queCommands);
+  m_uPendingViews_a    = 0;
+  m_uPendingHandlers_a = 0;
 
-  m_uRunningCallbacks_a += __CPP_REDIS_LENGTH(queCommands.size());
+  fail_commands(std::move(queCommands));
+}
 
-  std::thread t([=]() mutable {
-    while (!queCommands.empty()) {
-      const auto& callback = queCommands.front().callback;
+void
+client::clear_commands(void) {
+  ring_buffer<command_request> queCommands = std::move(m_queCommands);
+  m_uPendingViews_a    = 0;
+  m_uPendingHandlers_a = 0;
+
+  //! failed after the pending commands, to keep their order
+  std::size_t uBytes    = 0;
+  std::size_t uCommands = 0;
+  command_request request;
+
+  while (m_queSubmissions.pop(request)) {
+    uBytes += request.uSize;
+    uCommands += 1;
+    queCommands.push_back(std::move(request));
+  }
 
-      if (callback) {
-        reply r = {"network failure", reply::string_type::error};
-        callback(r);
-      }
+  if (m_bAutoCommit_a) {
+    m_uSubmittedBytes_a -= uBytes;
+    m_uSubmittedCommands_a -= uCommands;
+  }
 
-      --m_uRunningCallbacks_a;
-      queCommands.pop();
-    }
+  fail_commands(std::move(queCommands));
+}
 
-    m_cvSync.notify_all();
-  });
+void
+client::fail_commands(ring_buffer<command_request>&& queCommands) {
+  if (queCommands.empty()) {
+    return;
+  }
+
+  m_uRunningCallbacks_a += __CPP_REDIS_LENGTH(queCommands.size());
+
+  //! the callbacks are called from another thread, m_mtxCallbacks being possibly locked by the caller
+  std::thread t(&client::call_failed_callbacks, this, std::move(queCommands));
   t.detach();
 }
 
 void
-client::resend_failed_commands(void) {
-  if (m_queCommands.empty()) {
-    return;
+client::call_failed_callbacks(ring_buffer<command_request>&& queCommands) {
+  std::size_t uBytes = 0;
+  for (std::size_t i = 0; i < queCommands.size(); ++i)
+    uBytes += queCommands[i].uSize;
+
+  //! the commands will not get their reply: unblock the senders waiting for them first
+  release_pending(uBytes, queCommands.size());
+
+  std::size_t uCount = queCommands.size();
+  while (!queCommands.empty()) {
+    fail_request(queCommands.front(), "network failure");
+    queCommands.pop_front();
   }
 
-  //! dequeue commands and move them to a local variable
-  std::queue<command_request> queCommands = std::move(m_queCommands);
+  //! released under the callbacks mutex: this instance is not used anymore once the destructor sees them released
+  release_running_callbacks(uCount);
+}
+
+void
+client::resend_failed_commands(ring_buffer<command_request>&& queCommands) {
+  //! in no-replay mode, the pending commands only kept their callback: they fail as on a disconnection
+  if (!m_bReplay) {
+    fail_commands(std::move(queCommands));
+    return;
+  }
 
   while (queCommands.size() > 0) {
-    //! Reissue the pending command and its callback.
-    unprotected_send(queCommands.front().vctCommand, queCommands.front().callback);
+    //! Reissue the pending command and its callbacks.
+    unprotected_send(std::move(queCommands.front()));
 
-    queCommands.pop();
+    queCommands.pop_front();
   }
 }
 
@@ -324,7 +957,7 @@ client::connection_disconnection_handler(network::redis_connection&) {
   }
 
   if (!is_connected()) {
-    clear_callbacks();
+    clear_commands();
 
     //! Tell the user we gave up!
     if (m_callbackConnect) {
@@ -421,10 +1054,17 @@ client::reconnect(void) {
 
   __CPP_REDIS_LOG(info, "client reconnected ok");
 
+  //! the commands sent before the disconnection are replayed once authenticated on the selected database
+  ring_buffer<command_request> queFailed = std::move(m_queCommands);
+  m_uPendingViews_a    = 0;
+  m_uPendingHandlers_a = 0;
+
   re_auth();
   re_select();
-  resend_failed_commands();
-  try_commit();
+  resend_failed_commands(std::move(queFailed));
+  //! commands submitted during the reconnection are sent after the ones being replayed
+  drain_submissions();
+  unprotected_try_commit();
 }
 
 std::string
@@ -490,7 +1130,7 @@ client::bitfield_operation::incrby(const std::string& type, int offset, int incr
 
 client&
 client::append(const std::string& key, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"APPEND", key, value}, reply_callback);
+  send_args(reply_callback, command_id::append, key, value);
   return *this;
 }
 
@@ -498,6 +1138,8 @@ client&
 client::auth(const std::string& password, const reply_callback_t& reply_callback) {
   std::lock_guard<std::mutex> lock(m_mtxCallbacks);
 
+  //! keep the order with the commands submitted before
+  drain_submissions();
   unprotected_auth(password, reply_callback);
 
   return *this;
@@ -508,46 +1150,46 @@ client::unprotected_auth(const std::string& password, const reply_callback_t& re
   //! save the password for reconnect attempts.
   m_sPassword = password;
   //! store command in pipeline
-  unprotected_send({"AUTH", password}, reply_callback);
+  unprotected_send_args(reply_callback, command_id::auth, password);
 }
 
 client&
 client::bgrewriteaof(const reply_callback_t& reply_callback) {
-  send({"BGREWRITEAOF"}, reply_callback);
+  send_args(reply_callback, command_id::bgrewriteaof);
   return *this;
 }
 
 client&
 client::bgsave(const reply_callback_t& reply_callback) {
-  send({"BGSAVE"}, reply_callback);
+  send_args(reply_callback, command_id::bgsave);
   return *this;
 }
 
 client&
 client::bitcount(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"BITCOUNT", key}, reply_callback);
+  send_args(reply_callback, command_id::bitcount, key);
   return *this;
 }
 
 client&
 client::bitcount(const std::string& key, int start, int end, const reply_callback_t& reply_callback) {
-  send({"BITCOUNT", key, std::to_string(start), std::to_string(end)}, reply_callback);
+  send_args(reply_callback, command_id::bitcount, key, start, end);
   return *this;
 }
 
 client&
 client::bitfield(const std::string& key, const std::vector<bitfield_operation>& operations,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"BITFIELD", key};
+  command_frame cmd(command_id::bitfield, key);
 
   for (const auto& operation : operations) {
     cmd.push_back(bitfield_operation_type_to_string(operation.operation_type));
     cmd.push_back(operation.type);
-    cmd.push_back(std::to_string(operation.offset));
+    cmd.push_back(operation.offset);
 
     if (operation.operation_type == bitfield_operation_type::set ||
         operation.operation_type == bitfield_operation_type::incrby) {
-      cmd.push_back(std::to_string(operation.value));
+      cmd.push_back(operation.value);
     }
 
     if (operation.overflow != overflow_type::server_default) {
@@ -556,384 +1198,360 @@ client::bitfield(const std::string& key, const std::vector<bitfield_operation>&
     }
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::bitop(const std::string& operation, const std::string& destkey, const std::vector<std::string>& keys,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"BITOP", operation, destkey};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::bitop, operation, destkey, keys);
   return *this;
 }
 
 client&
 client::bitpos(const std::string& key, int bit, const reply_callback_t& reply_callback) {
-  send({"BITPOS", key, std::to_string(bit)}, reply_callback);
+  send_args(reply_callback, command_id::bitpos, key, bit);
   return *this;
 }
 
 client&
 client::bitpos(const std::string& key, int bit, int start, const reply_callback_t& reply_callback) {
-  send({"BITPOS", key, std::to_string(bit), std::to_string(start)}, reply_callback);
+  send_args(reply_callback, command_id::bitpos, key, bit, start);
   return *this;
 }
 
 client&
 client::bitpos(const std::string& key, int bit, int start, int end, const reply_callback_t& reply_callback) {
-  send({"BITPOS", key, std::to_string(bit), std::to_string(start), std::to_string(end)}, reply_callback);
+  send_args(reply_callback, command_id::bitpos, key, bit, start, end);
   return *this;
 }
 
 client&
 client::blpop(const std::vector<std::string>& keys, int timeout, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"BLPOP"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  cmd.push_back(std::to_string(timeout));
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::blpop, keys, timeout);
   return *this;
 }
 
 client&
 client::brpop(const std::vector<std::string>& keys, int timeout, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"BRPOP"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  cmd.push_back(std::to_string(timeout));
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::brpop, keys, timeout);
   return *this;
 }
 
 client&
 client::brpoplpush(const std::string& src, const std::string& dst, int timeout,
     const reply_callback_t& reply_callback) {
-  send({"BRPOPLPUSH", src, dst, std::to_string(timeout)}, reply_callback);
+  send_args(reply_callback, command_id::brpoplpush, src, dst, timeout);
   return *this;
 }
 
 client&
 client::client_list(const reply_callback_t& reply_callback) {
-  send({"CLIENT", "LIST"}, reply_callback);
+  send_args(reply_callback, command_id::client_list);
   return *this;
 }
 
 client&
 client::client_getname(const reply_callback_t& reply_callback) {
-  send({"CLIENT", "GETNAME"}, reply_callback);
+  send_args(reply_callback, command_id::client_getname);
   return *this;
 }
 
 client&
 client::client_pause(int timeout, const reply_callback_t& reply_callback) {
-  send({"CLIENT", "PAUSE", std::to_string(timeout)}, reply_callback);
+  send_args(reply_callback, command_id::client_pause, timeout);
   return *this;
 }
 
 client&
 client::client_reply(const std::string& mode, const reply_callback_t& reply_callback) {
-  send({"CLIENT", "REPLY", mode}, reply_callback);
+  send_args(reply_callback, command_id::client_reply, mode);
   return *this;
 }
 
 client&
 client::client_setname(const std::string& name, const reply_callback_t& reply_callback) {
-  send({"CLIENT", "SETNAME", name}, reply_callback);
+  send_args(reply_callback, command_id::client_setname, name);
   return *this;
 }
 
 client&
 client::cluster_addslots(const std::vector<std::string>& p_slots, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"CLUSTER", "ADDSLOTS"};
-  cmd.insert(cmd.end(), p_slots.begin(), p_slots.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::cluster_addslots, p_slots);
   return *this;
 }
 
 client&
 client::cluster_count_failure_reports(const std::string& node_id, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "COUNT-FAILURE-REPORTS", node_id}, reply_callback);
+  send_args(reply_callback, command_id::cluster_count_failure_reports, node_id);
   return *this;
 }
 
 client&
 client::cluster_countkeysinslot(const std::string& slot, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "COUNTKEYSINSLOT", slot}, reply_callback);
+  send_args(reply_callback, command_id::cluster_countkeysinslot, slot);
   return *this;
 }
 
 client&
 client::cluster_delslots(const std::vector<std::string>& p_slots, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"CLUSTER", "DELSLOTS"};
-  cmd.insert(cmd.end(), p_slots.begin(), p_slots.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::cluster_delslots, p_slots);
   return *this;
 }
 
 client&
 client::cluster_failover(const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "FAILOVER"}, reply_callback);
+  send_args(reply_callback, command_id::cluster_failover);
   return *this;
 }
 
 client&
 client::cluster_failover(const std::string& mode, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "FAILOVER", mode}, reply_callback);
+  send_args(reply_callback, command_id::cluster_failover, mode);
   return *this;
 }
 
 client&
 client::cluster_forget(const std::string& node_id, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "FORGET", node_id}, reply_callback);
+  send_args(reply_callback, command_id::cluster_forget, node_id);
   return *this;
 }
 
 client&
 client::cluster_getkeysinslot(const std::string& slot, int count, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "GETKEYSINSLOT", slot, std::to_string(count)}, reply_callback);
+  send_args(reply_callback, command_id::cluster_getkeysinslot, slot, count);
   return *this;
 }
 
 client&
 client::cluster_info(const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "INFO"}, reply_callback);
+  send_args(reply_callback, command_id::cluster_info);
   return *this;
 }
 
 client&
 client::cluster_keyslot(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "KEYSLOT", key}, reply_callback);
+  send_args(reply_callback, command_id::cluster_keyslot, key);
   return *this;
 }
 
 client&
 client::cluster_meet(const std::string& ip, int port, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "MEET", ip, std::to_string(port)}, reply_callback);
+  send_args(reply_callback, command_id::cluster_meet, ip, port);
   return *this;
 }
 
 client&
 client::cluster_nodes(const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "NODES"}, reply_callback);
+  send_args(reply_callback, command_id::cluster_nodes);
   return *this;
 }
 
 client&
 client::cluster_replicate(const std::string& node_id, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "REPLICATE", node_id}, reply_callback);
+  send_args(reply_callback, command_id::cluster_replicate, node_id);
   return *this;
 }
 
 client&
 client::cluster_reset(const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "RESET"}, reply_callback);
+  send_args(reply_callback, command_id::cluster_reset);
   return *this;
 }
 
 client&
 client::cluster_reset(const std::string& mode, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "RESET", mode}, reply_callback);
+  send_args(reply_callback, command_id::cluster_reset, mode);
   return *this;
 }
 
 client&
 client::cluster_saveconfig(const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "SAVECONFIG"}, reply_callback);
+  send_args(reply_callback, command_id::cluster_saveconfig);
   return *this;
 }
 
 client&
 client::cluster_set_config_epoch(const std::string& epoch, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "SET-CONFIG-EPOCH", epoch}, reply_callback);
+  send_args(reply_callback, command_id::cluster_set_config_epoch, epoch);
   return *this;
 }
 
 client&
 client::cluster_setslot(const std::string& slot, const std::string& mode, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "SETSLOT", slot, mode}, reply_callback);
+  send_args(reply_callback, command_id::cluster_setslot, slot, mode);
   return *this;
 }
 
 client&
 client::cluster_setslot(const std::string& slot, const std::string& mode, const std::string& node_id,
     const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "SETSLOT", slot, mode, node_id}, reply_callback);
+  send_args(reply_callback, command_id::cluster_setslot, slot, mode, node_id);
   return *this;
 }
 
 client&
 client::cluster_slaves(const std::string& node_id, const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "SLAVES", node_id}, reply_callback);
+  send_args(reply_callback, command_id::cluster_slaves, node_id);
   return *this;
 }
 
 client&
 client::cluster_slots(const reply_callback_t& reply_callback) {
-  send({"CLUSTER", "SLOTS"}, reply_callback);
+  send_args(reply_callback, command_id::cluster_slots);
   return *this;
 }
 
 client&
 client::command(const reply_callback_t& reply_callback) {
-  send({"COMMAND"}, reply_callback);
+  send_args(reply_callback, command_id::command);
   return *this;
 }
 
 client&
 client::command_count(const reply_callback_t& reply_callback) {
-  send({"COMMAND", "COUNT"}, reply_callback);
+  send_args(reply_callback, command_id::command_count);
   return *this;
 }
 
 client&
 client::command_getkeys(const reply_callback_t& reply_callback) {
-  send({"COMMAND", "GETKEYS"}, reply_callback);
+  send_args(reply_callback, command_id::command_getkeys);
   return *this;
 }
 
 client&
 client::command_info(const std::vector<std::string>& command_name, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"COMMAND", "COUNT"};
-  cmd.insert(cmd.end(), command_name.begin(), command_name.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::command_count, command_name);
   return *this;
 }
 
 client&
 client::config_get(const std::string& param, const reply_callback_t& reply_callback) {
-  send({"CONFIG", "GET", param}, reply_callback);
+  send_args(reply_callback, command_id::config_get, param);
   return *this;
 }
 
 client&
 client::config_rewrite(const reply_callback_t& reply_callback) {
-  send({"CONFIG", "REWRITE"}, reply_callback);
+  send_args(reply_callback, command_id::config_rewrite);
   return *this;
 }
 
 client&
 client::config_set(const std::string& param, const std::string& val, const reply_callback_t& reply_callback) {
-  send({"CONFIG", "SET", param, val}, reply_callback);
+  send_args(reply_callback, command_id::config_set, param, val);
   return *this;
 }
 
 client&
 client::config_resetstat(const reply_callback_t& reply_callback) {
-  send({"CONFIG", "RESETSTAT"}, reply_callback);
+  send_args(reply_callback, command_id::config_resetstat);
   return *this;
 }
 
 client&
 client::dbsize(const reply_callback_t& reply_callback) {
-  send({"DBSIZE"}, reply_callback);
+  send_args(reply_callback, command_id::dbsize);
   return *this;
 }
 
 client&
 client::debug_object(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"DEBUG", "OBJECT", key}, reply_callback);
+  send_args(reply_callback, command_id::debug_object, key);
   return *this;
 }
 
 client&
 client::debug_segfault(const reply_callback_t& reply_callback) {
-  send({"DEBUG", "SEGFAULT"}, reply_callback);
+  send_args(reply_callback, command_id::debug_segfault);
   return *this;
 }
 
 client&
 client::decr(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"DECR", key}, reply_callback);
+  send_args(reply_callback, command_id::decr, key);
   return *this;
 }
 
 client&
 client::decrby(const std::string& key, int val, const reply_callback_t& reply_callback) {
-  send({"DECRBY", key, std::to_string(val)}, reply_callback);
+  send_args(reply_callback, command_id::decrby, key, val);
   return *this;
 }
 
 client&
 client::del(const std::vector<std::string>& key, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"DEL"};
-  cmd.insert(cmd.end(), key.begin(), key.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::del, key);
   return *this;
 }
 
 client&
 client::discard(const reply_callback_t& reply_callback) {
-  send({"DISCARD"}, reply_callback);
+  send_args(reply_callback, command_id::discard);
   return *this;
 }
 
 client&
 client::dump(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"DUMP", key}, reply_callback);
+  send_args(reply_callback, command_id::dump, key);
   return *this;
 }
 
 client&
 client::echo(const std::string& msg, const reply_callback_t& reply_callback) {
-  send({"ECHO", msg}, reply_callback);
+  send_args(reply_callback, command_id::echo, msg);
   return *this;
 }
 
 client&
 client::eval(const std::string& script, int numkeys, const std::vector<std::string>& keys,
     const std::vector<std::string>& args, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"EVAL", script, std::to_string(numkeys)};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  cmd.insert(cmd.end(), args.begin(), args.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::eval, script, numkeys, keys, args);
   return *this;
 }
 
 client&
 client::evalsha(const std::string& sha1, int numkeys, const std::vector<std::string>& keys,
     const std::vector<std::string>& args, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"EVALSHA", sha1, std::to_string(numkeys)};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  cmd.insert(cmd.end(), args.begin(), args.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::evalsha, sha1, numkeys, keys, args);
   return *this;
 }
 
 client&
 client::exec(const reply_callback_t& reply_callback) {
-  send({"EXEC"}, reply_callback);
+  send_args(reply_callback, command_id::exec);
   return *this;
 }
 
 client&
 client::exists(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"EXISTS"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::exists, keys);
   return *this;
 }
 
 client&
 client::expire(const std::string& key, int seconds, const reply_callback_t& reply_callback) {
-  send({"EXPIRE", key, std::to_string(seconds)}, reply_callback);
+  send_args(reply_callback, command_id::expire, key, seconds);
   return *this;
 }
 
 client&
 client::expireat(const std::string& key, int timestamp, const reply_callback_t& reply_callback) {
-  send({"EXPIREAT", key, std::to_string(timestamp)}, reply_callback);
+  send_args(reply_callback, command_id::expireat, key, timestamp);
   return *this;
 }
 
 client&
 client::flushall(const reply_callback_t& reply_callback) {
-  send({"FLUSHALL"}, reply_callback);
+  send_args(reply_callback, command_id::flushall);
   return *this;
 }
 
 client&
 client::flushdb(const reply_callback_t& reply_callback) {
-  send({"FLUSHDB"}, reply_callback);
+  send_args(reply_callback, command_id::flushdb);
   return *this;
 }
 
@@ -941,45 +1559,41 @@ client&
 client::geoadd(const std::string& key,
     const std::vector<std::tuple<std::string, std::string, std::string>>& long_lat_memb,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"GEOADD", key};
+  command_frame cmd(command_id::geoadd, key);
   for (const auto& obj : long_lat_memb) {
     cmd.push_back(std::get<0>(obj));
     cmd.push_back(std::get<1>(obj));
     cmd.push_back(std::get<2>(obj));
   }
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::geohash(const std::string& key, const std::vector<std::string>& members,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"GEOHASH", key};
-  cmd.insert(cmd.end(), members.begin(), members.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::geohash, key, members);
   return *this;
 }
 
 client&
 client::geopos(const std::string& key, const std::vector<std::string>& members,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"GEOPOS", key};
-  cmd.insert(cmd.end(), members.begin(), members.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::geopos, key, members);
   return *this;
 }
 
 client&
 client::geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
     const reply_callback_t& reply_callback) {
-  send({"GEODIST", key, member_1, member_2}, reply_callback);
+  send_args(reply_callback, command_id::geodist, key, member_1, member_2);
   return *this;
 }
 
 client&
 client::geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
     const std::string& unit, const reply_callback_t& reply_callback) {
-  send({"GEODIST", key, member_1, member_2, unit}, reply_callback);
+  send_args(reply_callback, command_id::geodist, key, member_1, member_2, unit);
   return *this;
 }
 
@@ -1026,8 +1640,7 @@ client&
 client::georadius(const std::string& key, double longitude, double latitude, double radius, geo_unit unit,
     bool with_coord, bool with_dist, bool with_hash, bool asc_order, std::size_t count, const std::string& store_key,
     const std::string& storedist_key, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"GEORADIUS", key, std::to_string(longitude), std::to_string(latitude),
-      std::to_string(radius), geo_unit_to_string(unit)};
+  command_frame cmd(command_id::georadius, key, longitude, latitude, radius, geo_unit_to_string(unit));
 
   //! with_coord (optional)
   if (with_coord) {
@@ -1050,7 +1663,7 @@ client::georadius(const std::string& key, double longitude, double latitude, dou
   //! count (optional)
   if (count > 0) {
     cmd.push_back("COUNT");
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(count);
   }
 
   //! store_key (optional)
@@ -1065,7 +1678,7 @@ client::georadius(const std::string& key, double longitude, double latitude, dou
     cmd.push_back(storedist_key);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
@@ -1112,7 +1725,7 @@ client&
 client::georadiusbymember(const std::string& key, const std::string& member, double radius, geo_unit unit,
     bool with_coord, bool with_dist, bool with_hash, bool asc_order, std::size_t count, const std::string& store_key,
     const std::string& storedist_key, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"GEORADIUSBYMEMBER", key, member, std::to_string(radius), geo_unit_to_string(unit)};
+  command_frame cmd(command_id::georadiusbymember, key, member, radius, geo_unit_to_string(unit));
 
   //! with_coord (optional)
   if (with_coord) {
@@ -1135,7 +1748,7 @@ client::georadiusbymember(const std::string& key, const std::string& member, dou
   //! count (optional)
   if (count > 0) {
     cmd.push_back("COUNT");
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(count);
   }
 
   //! store_key (optional)
@@ -1150,104 +1763,100 @@ client::georadiusbymember(const std::string& key, const std::string& member, dou
     cmd.push_back(storedist_key);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::get(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"GET", key}, reply_callback);
+  send_args(reply_callback, command_id::get, key);
   return *this;
 }
 
 client&
 client::getbit(const std::string& key, int offset, const reply_callback_t& reply_callback) {
-  send({"GETBIT", key, std::to_string(offset)}, reply_callback);
+  send_args(reply_callback, command_id::getbit, key, offset);
   return *this;
 }
 
 client&
 client::getrange(const std::string& key, int start, int end, const reply_callback_t& reply_callback) {
-  send({"GETRANGE", key, std::to_string(start), std::to_string(end)}, reply_callback);
+  send_args(reply_callback, command_id::getrange, key, start, end);
   return *this;
 }
 
 client&
 client::getset(const std::string& key, const std::string& val, const reply_callback_t& reply_callback) {
-  send({"GETSET", key, val}, reply_callback);
+  send_args(reply_callback, command_id::getset, key, val);
   return *this;
 }
 
 client&
 client::hdel(const std::string& key, const std::vector<std::string>& fields, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"HDEL", key};
-  cmd.insert(cmd.end(), fields.begin(), fields.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::hdel, key, fields);
   return *this;
 }
 
 client&
 client::hexists(const std::string& key, const std::string& field, const reply_callback_t& reply_callback) {
-  send({"HEXISTS", key, field}, reply_callback);
+  send_args(reply_callback, command_id::hexists, key, field);
   return *this;
 }
 
 client&
 client::hget(const std::string& key, const std::string& field, const reply_callback_t& reply_callback) {
-  send({"HGET", key, field}, reply_callback);
+  send_args(reply_callback, command_id::hget, key, field);
   return *this;
 }
 
 client&
 client::hgetall(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"HGETALL", key}, reply_callback);
+  send_args(reply_callback, command_id::hgetall, key);
   return *this;
 }
 
 client&
 client::hincrby(const std::string& key, const std::string& field, int incr,
     const reply_callback_t& reply_callback) {
-  send({"HINCRBY", key, field, std::to_string(incr)}, reply_callback);
+  send_args(reply_callback, command_id::hincrby, key, field, incr);
   return *this;
 }
 
 client&
 client::hincrbyfloat(const std::string& key, const std::string& field, float incr,
     const reply_callback_t& reply_callback) {
-  send({"HINCRBYFLOAT", key, field, std::to_string(incr)}, reply_callback);
+  send_args(reply_callback, command_id::hincrbyfloat, key, field, incr);
   return *this;
 }
 
 client&
 client::hkeys(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"HKEYS", key}, reply_callback);
+  send_args(reply_callback, command_id::hkeys, key);
   return *this;
 }
 
 client&
 client::hlen(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"HLEN", key}, reply_callback);
+  send_args(reply_callback, command_id::hlen, key);
   return *this;
 }
 
 client&
 client::hmget(const std::string& key, const std::vector<std::string>& fields,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"HMGET", key};
-  cmd.insert(cmd.end(), fields.begin(), fields.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::hmget, key, fields);
   return *this;
 }
 
 client&
 client::hmset(const std::string& key, const std::vector<std::pair<std::string, std::string>>& field_val,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"HMSET", key};
+  command_frame cmd(command_id::hmset, key);
   for (const auto& obj : field_val) {
     cmd.push_back(obj.first);
     cmd.push_back(obj.second);
   }
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
@@ -1270,7 +1879,7 @@ client::hscan(const std::string& key, std::size_t cursor, std::size_t count, con
 client&
 client::hscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"HSCAN", key, std::to_string(cursor)};
+  command_frame cmd(command_id::hscan, key, cursor);
 
   if (!pattern.empty()) {
     cmd.push_back("MATCH");
@@ -1279,401 +1888,397 @@ client::hscan(const std::string& key, std::size_t cursor, const std::string& pat
 
   if (count > 0) {
     cmd.push_back("COUNT");
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::hset(const std::string& key, const std::string& field, const std::string& value,
     const reply_callback_t& reply_callback) {
-  send({"HSET", key, field, value}, reply_callback);
+  send_args(reply_callback, command_id::hset, key, field, value);
+  return *this;
+}
+
+client&
+client::hset(const std::string& key, const std::string& field, const shared_value_t& value,
+    const reply_callback_t& reply_callback) {
+  send_shared_args(reply_callback, value, command_id::hset, key, field);
   return *this;
 }
 
 client&
 client::hsetnx(const std::string& key, const std::string& field, const std::string& value,
     const reply_callback_t& reply_callback) {
-  send({"HSETNX", key, field, value}, reply_callback);
+  send_args(reply_callback, command_id::hsetnx, key, field, value);
   return *this;
 }
 
 client&
 client::hstrlen(const std::string& key, const std::string& field, const reply_callback_t& reply_callback) {
-  send({"HSTRLEN", key, field}, reply_callback);
+  send_args(reply_callback, command_id::hstrlen, key, field);
   return *this;
 }
 
 client&
 client::hvals(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"HVALS", key}, reply_callback);
+  send_args(reply_callback, command_id::hvals, key);
   return *this;
 }
 
 client&
 client::incr(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"INCR", key}, reply_callback);
+  send_args(reply_callback, command_id::incr, key);
   return *this;
 }
 
 client&
 client::incrby(const std::string& key, int incr, const reply_callback_t& reply_callback) {
-  send({"INCRBY", key, std::to_string(incr)}, reply_callback);
+  send_args(reply_callback, command_id::incrby, key, incr);
   return *this;
 }
 
 client&
 client::incrbyfloat(const std::string& key, float incr, const reply_callback_t& reply_callback) {
-  send({"INCRBYFLOAT", key, std::to_string(incr)}, reply_callback);
+  send_args(reply_callback, command_id::incrbyfloat, key, incr);
   return *this;
 }
 
 client&
 client::info(const reply_callback_t& reply_callback) {
-  send({"INFO"}, reply_callback);
+  send_args(reply_callback, command_id::info);
   return *this;
 }
 
 client&
 client::info(const std::string& section, const reply_callback_t& reply_callback) {
-  send({"INFO", section}, reply_callback);
+  send_args(reply_callback, command_id::info, section);
   return *this;
 }
 
 client&
 client::keys(const std::string& pattern, const reply_callback_t& reply_callback) {
-  send({"KEYS", pattern}, reply_callback);
+  send_args(reply_callback, command_id::keys, pattern);
   return *this;
 }
 
 client&
 client::lastsave(const reply_callback_t& reply_callback) {
-  send({"LASTSAVE"}, reply_callback);
+  send_args(reply_callback, command_id::lastsave);
   return *this;
 }
 
 client&
 client::lindex(const std::string& key, int index, const reply_callback_t& reply_callback) {
-  send({"LINDEX", key, std::to_string(index)}, reply_callback);
+  send_args(reply_callback, command_id::lindex, key, index);
   return *this;
 }
 
 client&
 client::linsert(const std::string& key, const std::string& before_after, const std::string& pivot,
     const std::string& value, const reply_callback_t& reply_callback) {
-  send({"LINSERT", key, before_after, pivot, value}, reply_callback);
+  send_args(reply_callback, command_id::linsert, key, before_after, pivot, value);
   return *this;
 }
 
 client&
 client::llen(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"LLEN", key}, reply_callback);
+  send_args(reply_callback, command_id::llen, key);
   return *this;
 }
 
 client&
 client::lpop(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"LPOP", key}, reply_callback);
+  send_args(reply_callback, command_id::lpop, key);
   return *this;
 }
 
 client&
 client::lpush(const std::string& key, const std::vector<std::string>& values, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"LPUSH", key};
-  cmd.insert(cmd.end(), values.begin(), values.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::lpush, key, values);
   return *this;
 }
 
 client&
 client::lpushx(const std::string& key, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"LPUSHX", key, value}, reply_callback);
+  send_args(reply_callback, command_id::lpushx, key, value);
   return *this;
 }
 
 client&
 client::lrange(const std::string& key, int start, int stop, const reply_callback_t& reply_callback) {
-  send({"LRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::lrange, key, start, stop);
   return *this;
 }
 
 client&
 client::lrem(const std::string& key, int count, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"LREM", key, std::to_string(count), value}, reply_callback);
+  send_args(reply_callback, command_id::lrem, key, count, value);
   return *this;
 }
 
 client&
 client::lset(const std::string& key, int index, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"LSET", key, std::to_string(index), value}, reply_callback);
+  send_args(reply_callback, command_id::lset, key, index, value);
   return *this;
 }
 
 client&
 client::ltrim(const std::string& key, int start, int stop, const reply_callback_t& reply_callback) {
-  send({"LTRIM", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::ltrim, key, start, stop);
   return *this;
 }
 
 client&
 client::mget(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"MGET"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::mget, keys);
   return *this;
 }
 
 client&
 client::migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db, int timeout,
     const reply_callback_t& reply_callback) {
-  send({"MIGRATE", host, std::to_string(port), key, dest_db, std::to_string(timeout)}, reply_callback);
+  send_args(reply_callback, command_id::migrate, host, port, key, dest_db, timeout);
   return *this;
 }
 
 client&
 client::migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db, int timeout,
     bool copy, bool replace, const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"MIGRATE", host, std::to_string(port), key, dest_db, std::to_string(timeout)};
+  command_frame cmd(command_id::migrate, host, port, key, dest_db, timeout);
   if (copy) { cmd.push_back("COPY"); }
   if (replace) { cmd.push_back("REPLACE"); }
   if (keys.size()) {
     cmd.push_back("KEYS");
-    cmd.insert(cmd.end(), keys.begin(), keys.end());
+    cmd.push_back(keys);
   }
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::monitor(const reply_callback_t& reply_callback) {
-  send({"MONITOR"}, reply_callback);
+  send_args(reply_callback, command_id::monitor);
   return *this;
 }
 
 client&
 client::move(const std::string& key, const std::string& db, const reply_callback_t& reply_callback) {
-  send({"MOVE", key, db}, reply_callback);
+  send_args(reply_callback, command_id::move, key, db);
   return *this;
 }
 
 client&
 client::mset(const std::vector<std::pair<std::string, std::string>>& key_vals,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"MSET"};
+  command_frame cmd(command_id::mset);
   for (const auto& obj : key_vals) {
     cmd.push_back(obj.first);
     cmd.push_back(obj.second);
   }
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::msetnx(const std::vector<std::pair<std::string, std::string>>& key_vals,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"MSETNX"};
+  command_frame cmd(command_id::msetnx);
   for (const auto& obj : key_vals) {
     cmd.push_back(obj.first);
     cmd.push_back(obj.second);
   }
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::multi(const reply_callback_t& reply_callback) {
-  send({"MULTI"}, reply_callback);
+  send_args(reply_callback, command_id::multi);
   return *this;
 }
 
 client&
 client::object(const std::string& subcommand, const std::vector<std::string>& args,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"OBJECT", subcommand};
-  cmd.insert(cmd.end(), args.begin(), args.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::object, subcommand, args);
   return *this;
 }
 
 client&
 client::persist(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"PERSIST", key}, reply_callback);
+  send_args(reply_callback, command_id::persist, key);
   return *this;
 }
 
 client&
 client::pexpire(const std::string& key, int milliseconds, const reply_callback_t& reply_callback) {
-  send({"PEXPIRE", key, std::to_string(milliseconds)}, reply_callback);
+  send_args(reply_callback, command_id::pexpire, key, milliseconds);
   return *this;
 }
 
 client&
 client::pexpireat(const std::string& key, int milliseconds_timestamp, const reply_callback_t& reply_callback) {
-  send({"PEXPIREAT", key, std::to_string(milliseconds_timestamp)}, reply_callback);
+  send_args(reply_callback, command_id::pexpireat, key, milliseconds_timestamp);
   return *this;
 }
 
 client&
 client::pfadd(const std::string& key, const std::vector<std::string>& elements,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"PFADD", key};
-  cmd.insert(cmd.end(), elements.begin(), elements.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::pfadd, key, elements);
   return *this;
 }
 
 client&
 client::pfcount(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"PFCOUNT"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::pfcount, keys);
   return *this;
 }
 
 client&
 client::pfmerge(const std::string& destkey, const std::vector<std::string>& sourcekeys,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"PFMERGE", destkey};
-  cmd.insert(cmd.end(), sourcekeys.begin(), sourcekeys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::pfmerge, destkey, sourcekeys);
   return *this;
 }
 
 client&
 client::ping(const reply_callback_t& reply_callback) {
-  send({"PING"}, reply_callback);
+  send_args(reply_callback, command_id::ping);
   return *this;
 }
 
 client&
 client::ping(const std::string& message, const reply_callback_t& reply_callback) {
-  send({"PING", message}, reply_callback);
+  send_args(reply_callback, command_id::ping, message);
   return *this;
 }
 
 client&
 client::psetex(const std::string& key, int milliseconds, const std::string& val,
     const reply_callback_t& reply_callback) {
-  send({"PSETEX", key, std::to_string(milliseconds), val}, reply_callback);
+  send_args(reply_callback, command_id::psetex, key, milliseconds, val);
   return *this;
 }
 
 client&
 client::publish(const std::string& channel, const std::string& message, const reply_callback_t& reply_callback) {
-  send({"PUBLISH", channel, message}, reply_callback);
+  send_args(reply_callback, command_id::publish, channel, message);
   return *this;
 }
 
 client&
 client::pubsub(const std::string& subcommand, const std::vector<std::string>& args,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"PUBSUB", subcommand};
-  cmd.insert(cmd.end(), args.begin(), args.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::pubsub, subcommand, args);
   return *this;
 }
 
 client&
 client::pttl(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"PTTL", key}, reply_callback);
+  send_args(reply_callback, command_id::pttl, key);
   return *this;
 }
 
 client&
 client::quit(const reply_callback_t& reply_callback) {
-  send({"QUIT"}, reply_callback);
+  send_args(reply_callback, command_id::quit);
   return *this;
 }
 
 client&
 client::randomkey(const reply_callback_t& reply_callback) {
-  send({"RANDOMKEY"}, reply_callback);
+  send_args(reply_callback, command_id::randomkey);
   return *this;
 }
 
 client&
 client::readonly(const reply_callback_t& reply_callback) {
-  send({"READONLY"}, reply_callback);
+  send_args(reply_callback, command_id::readonly);
   return *this;
 }
 
 client&
 client::readwrite(const reply_callback_t& reply_callback) {
-  send({"READWRITE"}, reply_callback);
+  send_args(reply_callback, command_id::readwrite);
   return *this;
 }
 
 client&
 client::rename(const std::string& key, const std::string& newkey, const reply_callback_t& reply_callback) {
-  send({"RENAME", key, newkey}, reply_callback);
+  send_args(reply_callback, command_id::rename, key, newkey);
   return *this;
 }
 
 client&
 client::renamenx(const std::string& key, const std::string& newkey, const reply_callback_t& reply_callback) {
-  send({"RENAMENX", key, newkey}, reply_callback);
+  send_args(reply_callback, command_id::renamenx, key, newkey);
   return *this;
 }
 
 client&
 client::restore(const std::string& key, int ttl, const std::string& serialized_value,
     const reply_callback_t& reply_callback) {
-  send({"RESTORE", key, std::to_string(ttl), serialized_value}, reply_callback);
+  send_args(reply_callback, command_id::restore, key, ttl, serialized_value);
+  return *this;
+}
+
+client&
+client::restore(const std::string& key, int ttl, const shared_value_t& serialized_value,
+    const reply_callback_t& reply_callback) {
+  send_shared_args(reply_callback, serialized_value, command_id::restore, key, ttl);
   return *this;
 }
 
 client&
 client::restore(const std::string& key, int ttl, const std::string& serialized_value, const std::string& replace,
     const reply_callback_t& reply_callback) {
-  send({"RESTORE", key, std::to_string(ttl), serialized_value, replace}, reply_callback);
+  send_args(reply_callback, command_id::restore, key, ttl, serialized_value, replace);
   return *this;
 }
 
 client&
 client::role(const reply_callback_t& reply_callback) {
-  send({"ROLE"}, reply_callback);
+  send_args(reply_callback, command_id::role);
   return *this;
 }
 
 client&
 client::rpop(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"RPOP", key}, reply_callback);
+  send_args(reply_callback, command_id::rpop, key);
   return *this;
 }
 
 client&
 client::rpoplpush(const std::string& source, const std::string& destination, const reply_callback_t& reply_callback) {
-  send({"RPOPLPUSH", source, destination}, reply_callback);
+  send_args(reply_callback, command_id::rpoplpush, source, destination);
   return *this;
 }
 
 client&
 client::rpush(const std::string& key, const std::vector<std::string>& values, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"RPUSH", key};
-  cmd.insert(cmd.end(), values.begin(), values.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::rpush, key, values);
   return *this;
 }
 
 client&
 client::rpushx(const std::string& key, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"RPUSHX", key, value}, reply_callback);
+  send_args(reply_callback, command_id::rpushx, key, value);
   return *this;
 }
 
 client&
 client::sadd(const std::string& key, const std::vector<std::string>& members, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SADD", key};
-  cmd.insert(cmd.end(), members.begin(), members.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sadd, key, members);
   return *this;
 }
 
 client&
 client::save(const reply_callback_t& reply_callback) {
-  send({"SAVE"}, reply_callback);
+  send_args(reply_callback, command_id::save);
   return *this;
 }
 
@@ -1695,7 +2300,7 @@ client::scan(std::size_t cursor, std::size_t count, const reply_callback_t& repl
 client&
 client::scan(std::size_t cursor, const std::string& pattern, std::size_t count,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SCAN", std::to_string(cursor)};
+  command_frame cmd(command_id::scan, cursor);
 
   if (!pattern.empty()) {
     cmd.push_back("MATCH");
@@ -1704,65 +2309,59 @@ client::scan(std::size_t cursor, const std::string& pattern, std::size_t count,
 
   if (count > 0) {
     cmd.push_back("COUNT");
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::scard(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"SCARD", key}, reply_callback);
+  send_args(reply_callback, command_id::scard, key);
   return *this;
 }
 
 client&
 client::script_debug(const std::string& mode, const reply_callback_t& reply_callback) {
-  send({"SCRIPT", "DEBUG", mode}, reply_callback);
+  send_args(reply_callback, command_id::script_debug, mode);
   return *this;
 }
 
 client&
 client::script_exists(const std::vector<std::string>& scripts, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SCRIPT", "EXISTS"};
-  cmd.insert(cmd.end(), scripts.begin(), scripts.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::script_exists, scripts);
   return *this;
 }
 
 client&
 client::script_flush(const reply_callback_t& reply_callback) {
-  send({"SCRIPT", "FLUSH"}, reply_callback);
+  send_args(reply_callback, command_id::script_flush);
   return *this;
 }
 
 client&
 client::script_kill(const reply_callback_t& reply_callback) {
-  send({"SCRIPT", "KILL"}, reply_callback);
+  send_args(reply_callback, command_id::script_kill);
   return *this;
 }
 
 client&
 client::script_load(const std::string& script, const reply_callback_t& reply_callback) {
-  send({"SCRIPT", "LOAD", script}, reply_callback);
+  send_args(reply_callback, command_id::script_load, script);
   return *this;
 }
 
 client&
 client::sdiff(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SDIFF"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sdiff, keys);
   return *this;
 }
 
 client&
 client::sdiffstore(const std::string& destination, const std::vector<std::string>& keys,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SDIFFSTORE", destination};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sdiffstore, destination, keys);
   return *this;
 }
 
@@ -1770,6 +2369,8 @@ client&
 client::select(int index, const reply_callback_t& reply_callback) {
   std::lock_guard<std::mutex> lock(m_mtxCallbacks);
 
+  //! keep the order with the commands submitted before
+  drain_submissions();
   unprotected_select(index, reply_callback);
 
   return *this;
@@ -1780,134 +2381,136 @@ client::unprotected_select(int index, const reply_callback_t& reply_callback) {
   //! save the index of the database for reconnect attempts.
   m_nDatabaseIndex = index;
   //! save command in the pipeline
-  unprotected_send({"SELECT", std::to_string(index)}, reply_callback);
+  unprotected_send_args(reply_callback, command_id::select, index);
 }
 
 client&
 client::set(const std::string& key, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"SET", key, value}, reply_callback);
+  send_args(reply_callback, command_id::set, key, value);
+  return *this;
+}
+
+client&
+client::set(const std::string& key, const shared_value_t& value, const reply_callback_t& reply_callback) {
+  send_shared_args(reply_callback, value, command_id::set, key);
   return *this;
 }
 
 client&
 client::set_advanced(const std::string& key, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"SET", key, value}, reply_callback);
+  send_args(reply_callback, command_id::set, key, value);
   return *this;
 }
 
 client&
 client::set_advanced(const std::string& key, const std::string& value, bool ex, int ex_sec, bool px, int px_milli,
     bool nx, bool xx, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SET", key, value};
+  command_frame cmd(command_id::set, key, value);
   if (ex) {
     cmd.push_back("EX");
-    cmd.push_back(std::to_string(ex_sec));
+    cmd.push_back(ex_sec);
   }
   if (px) {
     cmd.push_back("PX");
-    cmd.push_back(std::to_string(px_milli));
+    cmd.push_back(px_milli);
   }
   if (nx) { cmd.push_back("NX"); }
   if (xx) { cmd.push_back("XX"); }
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::setbit_(const std::string& key, int offset, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"SETBIT", key, std::to_string(offset), value}, reply_callback);
+  send_args(reply_callback, command_id::setbit, key, offset, value);
   return *this;
 }
 
 client&
 client::setex(const std::string& key, int seconds, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"SETEX", key, std::to_string(seconds), value}, reply_callback);
+  send_args(reply_callback, command_id::setex, key, seconds, value);
   return *this;
 }
 
 client&
 client::setnx(const std::string& key, const std::string& value, const reply_callback_t& reply_callback) {
-  send({"SETNX", key, value}, reply_callback);
+  send_args(reply_callback, command_id::setnx, key, value);
   return *this;
 }
 
 client&
 client::setrange(const std::string& key, int offset, const std::string& value,
     const reply_callback_t& reply_callback) {
-  send({"SETRANGE", key, std::to_string(offset), value}, reply_callback);
+  send_args(reply_callback, command_id::setrange, key, offset, value);
   return *this;
 }
 
 client&
 client::shutdown(const reply_callback_t& reply_callback) {
-  send({"SHUTDOWN"}, reply_callback);
+  send_args(reply_callback, command_id::shutdown);
   return *this;
 }
 
 client&
 client::shutdown(const std::string& save, const reply_callback_t& reply_callback) {
-  send({"SHUTDOWN", save}, reply_callback);
+  send_args(reply_callback, command_id::shutdown, save);
   return *this;
 }
 
 client&
 client::sinter(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SINTER"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sinter, keys);
   return *this;
 }
 
 client&
 client::sinterstore(const std::string& destination, const std::vector<std::string>& keys,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SINTERSTORE", destination};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sinterstore, destination, keys);
   return *this;
 }
 
 client&
 client::sismember(const std::string& key, const std::string& member, const reply_callback_t& reply_callback) {
-  send({"SISMEMBER", key, member}, reply_callback);
+  send_args(reply_callback, command_id::sismember, key, member);
   return *this;
 }
 
 client&
 client::slaveof(const std::string& host, int port, const reply_callback_t& reply_callback) {
-  send({"SLAVEOF", host, std::to_string(port)}, reply_callback);
+  send_args(reply_callback, command_id::slaveof, host, port);
   return *this;
 }
 
 client&
 client::slowlog(const std::string subcommand, const reply_callback_t& reply_callback) {
-  send({"SLOWLOG", subcommand}, reply_callback);
+  send_args(reply_callback, command_id::slowlog, subcommand);
   return *this;
 }
 
 client&
 client::slowlog(const std::string subcommand, const std::string& argument, const reply_callback_t& reply_callback) {
-  send({"SLOWLOG", subcommand, argument}, reply_callback);
+  send_args(reply_callback, command_id::slowlog, subcommand, argument);
   return *this;
 }
 
 client&
 client::smembers(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"SMEMBERS", key}, reply_callback);
+  send_args(reply_callback, command_id::smembers, key);
   return *this;
 }
 
 client&
 client::smove(const std::string& source, const std::string& destination, const std::string& member,
     const reply_callback_t& reply_callback) {
-  send({"SMOVE", source, destination, member}, reply_callback);
+  send_args(reply_callback, command_id::smove, source, destination, member);
   return *this;
 }
 
 
 client&
 client::sort(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"SORT", key}, reply_callback);
+  send_args(reply_callback, command_id::sort, key);
   return *this;
 }
 
@@ -1965,7 +2568,7 @@ client&
 client::sort(const std::string& key, const std::string& by_pattern, bool limit, std::size_t offset, std::size_t count,
     const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SORT", key};
+  command_frame cmd(command_id::sort, key);
 
   //! add by pattern (optional)
   if (!by_pattern.empty()) {
@@ -1976,8 +2579,8 @@ client::sort(const std::string& key, const std::string& by_pattern, bool limit,
   //! add limit (optional)
   if (limit) {
     cmd.push_back("LIMIT");
-    cmd.push_back(std::to_string(offset));
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(offset);
+    cmd.push_back(count);
   }
 
   //! add get pattern (optional)
@@ -2004,40 +2607,38 @@ client::sort(const std::string& key, const std::string& by_pattern, bool limit,
     cmd.push_back(store_dest);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::spop(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"SPOP", key}, reply_callback);
+  send_args(reply_callback, command_id::spop, key);
   return *this;
 }
 
 client&
 client::spop(const std::string& key, int count, const reply_callback_t& reply_callback) {
-  send({"SPOP", key, std::to_string(count)}, reply_callback);
+  send_args(reply_callback, command_id::spop, key, count);
   return *this;
 }
 
 client&
 client::srandmember(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"SRANDMEMBER", key}, reply_callback);
+  send_args(reply_callback, command_id::srandmember, key);
   return *this;
 }
 
 client&
 client::srandmember(const std::string& key, int count, const reply_callback_t& reply_callback) {
-  send({"SRANDMEMBER", key, std::to_string(count)}, reply_callback);
+  send_args(reply_callback, command_id::srandmember, key, count);
   return *this;
 }
 
 client&
 client::srem(const std::string& key, const std::vector<std::string>& members,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SREM", key};
-  cmd.insert(cmd.end(), members.begin(), members.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::srem, key, members);
   return *this;
 }
 
@@ -2060,7 +2661,7 @@ client::sscan(const std::string& key, std::size_t cursor, std::size_t count, con
 client&
 client::sscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SSCAN", key, std::to_string(cursor)};
+  command_frame cmd(command_id::sscan, key, cursor);
 
   if (!pattern.empty()) {
     cmd.push_back("MATCH");
@@ -2069,87 +2670,81 @@ client::sscan(const std::string& key, std::size_t cursor, const std::string& pat
 
   if (count > 0) {
     cmd.push_back("COUNT");
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::strlen(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"STRLEN", key}, reply_callback);
+  send_args(reply_callback, command_id::strlen, key);
   return *this;
 }
 
 client&
 client::sunion(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SUNION"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sunion, keys);
   return *this;
 }
 
 client&
 client::sunionstore(const std::string& destination, const std::vector<std::string>& keys,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"SUNIONSTORE", destination};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::sunionstore, destination, keys);
   return *this;
 }
 
 client&
 client::sync(const reply_callback_t& reply_callback) {
-  send({"SYNC"}, reply_callback);
+  send_args(reply_callback, command_id::sync);
   return *this;
 }
 
 client&
 client::time(const reply_callback_t& reply_callback) {
-  send({"TIME"}, reply_callback);
+  send_args(reply_callback, command_id::time);
   return *this;
 }
 
 client&
 client::ttl(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"TTL", key}, reply_callback);
+  send_args(reply_callback, command_id::ttl, key);
   return *this;
 }
 
 client&
 client::type(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"TYPE", key}, reply_callback);
+  send_args(reply_callback, command_id::type, key);
   return *this;
 }
 
 client&
 client::unwatch(const reply_callback_t& reply_callback) {
-  send({"UNWATCH"}, reply_callback);
+  send_args(reply_callback, command_id::unwatch);
   return *this;
 }
 
 client&
 client::wait(int numslaves, int timeout, const reply_callback_t& reply_callback) {
-  send({"WAIT", std::to_string(numslaves), std::to_string(timeout)}, reply_callback);
+  send_args(reply_callback, command_id::wait, numslaves, timeout);
   return *this;
 }
 
 client&
 client::watch(const std::vector<std::string>& keys, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"WATCH"};
-  cmd.insert(cmd.end(), keys.begin(), keys.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::watch, keys);
   return *this;
 }
 
 client&
 client::zadd(const std::string& key, const std::vector<std::string>& options,
     const std::multimap<std::string, std::string>& score_members, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZADD", key};
+  command_frame cmd(command_id::zadd, key);
 
   //! options
-  cmd.insert(cmd.end(), options.begin(), options.end());
+  cmd.push_back(options);
 
   //! score members
   for (auto& sm : score_members) {
@@ -2157,59 +2752,59 @@ client::zadd(const std::string& key, const std::vector<std::string>& options,
     cmd.push_back(sm.second);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::zcard(const std::string& key, const reply_callback_t& reply_callback) {
-  send({"ZCARD", key}, reply_callback);
+  send_args(reply_callback, command_id::zcard, key);
   return *this;
 }
 
 client&
 client::zcount(const std::string& key, int min, int max, const reply_callback_t& reply_callback) {
-  send({"ZCOUNT", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zcount, key, min, max);
   return *this;
 }
 
 client&
 client::zcount(const std::string& key, double min, double max, const reply_callback_t& reply_callback) {
-  send({"ZCOUNT", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zcount, key, min, max);
   return *this;
 }
 
 client&
 client::zcount(const std::string& key, const std::string& min, const std::string& max,
     const reply_callback_t& reply_callback) {
-  send({"ZCOUNT", key, min, max}, reply_callback);
+  send_args(reply_callback, command_id::zcount, key, min, max);
   return *this;
 }
 
 client&
 client::zincrby(const std::string& key, int incr, const std::string& member, const reply_callback_t& reply_callback) {
-  send({"ZINCRBY", key, std::to_string(incr), member}, reply_callback);
+  send_args(reply_callback, command_id::zincrby, key, incr, member);
   return *this;
 }
 
 client&
 client::zincrby(const std::string& key, double incr, const std::string& member,
     const reply_callback_t& reply_callback) {
-  send({"ZINCRBY", key, std::to_string(incr), member}, reply_callback);
+  send_args(reply_callback, command_id::zincrby, key, incr, member);
   return *this;
 }
 
 client&
 client::zincrby(const std::string& key, const std::string& incr, const std::string& member,
     const reply_callback_t& reply_callback) {
-  send({"ZINCRBY", key, incr, member}, reply_callback);
+  send_args(reply_callback, command_id::zincrby, key, incr, member);
   return *this;
 }
 
 client&
 client::zinterstore(const std::string& destination, std::size_t numkeys, const std::vector<std::string>& keys,
     const std::vector<std::size_t> weights, aggregate_method method, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZINTERSTORE", destination, std::to_string(numkeys)};
+  command_frame cmd(command_id::zinterstore, destination, numkeys);
 
   //! keys
   for (const auto& key : keys) {
@@ -2221,7 +2816,7 @@ client::zinterstore(const std::string& destination, std::size_t numkeys, const s
     cmd.push_back("WEIGHTS");
 
     for (auto weight : weights) {
-      cmd.push_back(std::to_string(weight));
+      cmd.push_back(weight);
     }
   }
 
@@ -2231,47 +2826,47 @@ client::zinterstore(const std::string& destination, std::size_t numkeys, const s
     cmd.push_back(aggregate_method_to_string(method));
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::zlexcount(const std::string& key, int min, int max, const reply_callback_t& reply_callback) {
-  send({"ZLEXCOUNT", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zlexcount, key, min, max);
   return *this;
 }
 
 client&
 client::zlexcount(const std::string& key, double min, double max, const reply_callback_t& reply_callback) {
-  send({"ZLEXCOUNT", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zlexcount, key, min, max);
   return *this;
 }
 
 client&
 client::zlexcount(const std::string& key, const std::string& min, const std::string& max,
     const reply_callback_t& reply_callback) {
-  send({"ZLEXCOUNT", key, min, max}, reply_callback);
+  send_args(reply_callback, command_id::zlexcount, key, min, max);
   return *this;
 }
 
 client&
 client::zrange(const std::string& key, int start, int stop, const reply_callback_t& reply_callback) {
-  send({"ZRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::zrange, key, start, stop);
   return *this;
 }
 
 client&
 client::zrange(const std::string& key, int start, int stop, bool withscores, const reply_callback_t& reply_callback) {
   if (withscores)
-    send({"ZRANGE", key, std::to_string(start), std::to_string(stop), "WITHSCORES"}, reply_callback);
+    send_args(reply_callback, command_id::zrange, key, start, stop, "WITHSCORES");
   else
-    send({"ZRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+    send_args(reply_callback, command_id::zrange, key, start, stop);
   return *this;
 }
 
 client&
 client::zrange(const std::string& key, double start, double stop, const reply_callback_t& reply_callback) {
-  send({"ZRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::zrange, key, start, stop);
   return *this;
 }
 
@@ -2279,16 +2874,16 @@ client&
 client::zrange(const std::string& key, double start, double stop, bool withscores,
     const reply_callback_t& reply_callback) {
   if (withscores)
-    send({"ZRANGE", key, std::to_string(start), std::to_string(stop), "WITHSCORES"}, reply_callback);
+    send_args(reply_callback, command_id::zrange, key, start, stop, "WITHSCORES");
   else
-    send({"ZRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+    send_args(reply_callback, command_id::zrange, key, start, stop);
   return *this;
 }
 
 client&
 client::zrange(const std::string& key, const std::string& start, const std::string& stop,
     const reply_callback_t& reply_callback) {
-  send({"ZRANGE", key, start, stop}, reply_callback);
+  send_args(reply_callback, command_id::zrange, key, start, stop);
   return *this;
 }
 
@@ -2296,9 +2891,9 @@ client&
 client::zrange(const std::string& key, const std::string& start, const std::string& stop, bool withscores,
     const reply_callback_t& reply_callback) {
   if (withscores)
-    send({"ZRANGE", key, start, stop, "WITHSCORES"}, reply_callback);
+    send_args(reply_callback, command_id::zrange, key, start, stop, "WITHSCORES");
   else
-    send({"ZRANGE", key, start, stop}, reply_callback);
+    send_args(reply_callback, command_id::zrange, key, start, stop);
   return *this;
 }
 
@@ -2375,7 +2970,7 @@ client::zrangebylex(const std::string& key, const std::string& min, const std::s
 client&
 client::zrangebylex(const std::string& key, const std::string& min, const std::string& max, bool limit,
     std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZRANGEBYLEX", key, min, max};
+  command_frame cmd(command_id::zrangebylex, key, min, max);
 
   //! withscores (optional)
   if (withscores) {
@@ -2385,11 +2980,11 @@ client::zrangebylex(const std::string& key, const std::string& min, const std::s
   //! limit (optional)
   if (limit) {
     cmd.push_back("LIMIT");
-    cmd.push_back(std::to_string(offset));
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(offset);
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
@@ -2466,7 +3061,7 @@ client::zrangebyscore(const std::string& key, const std::string& min, const std:
 client&
 client::zrangebyscore(const std::string& key, const std::string& min, const std::string& max, bool limit,
     std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZRANGEBYSCORE", key, min, max};
+  command_frame cmd(command_id::zrangebyscore, key, min, max);
 
   //! withscores (optional)
   if (withscores) {
@@ -2476,89 +3071,87 @@ client::zrangebyscore(const std::string& key, const std::string& min, const std:
   //! limit (optional)
   if (limit) {
     cmd.push_back("LIMIT");
-    cmd.push_back(std::to_string(offset));
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(offset);
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::zrank(const std::string& key, const std::string& member, const reply_callback_t& reply_callback) {
-  send({"ZRANK", key, member}, reply_callback);
+  send_args(reply_callback, command_id::zrank, key, member);
   return *this;
 }
 
 client&
 client::zrem(const std::string& key, const std::vector<std::string>& members,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZREM", key};
-  cmd.insert(cmd.end(), members.begin(), members.end());
-  send(cmd, reply_callback);
+  send_args(reply_callback, command_id::zrem, key, members);
   return *this;
 }
 
 client&
 client::zremrangebylex(const std::string& key, int min, int max, const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYLEX", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebylex, key, min, max);
   return *this;
 }
 
 client&
 client::zremrangebylex(const std::string& key, double min, double max, const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYLEX", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebylex, key, min, max);
   return *this;
 }
 
 client&
 client::zremrangebylex(const std::string& key, const std::string& min, const std::string& max,
     const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYLEX", key, min, max}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebylex, key, min, max);
   return *this;
 }
 
 client&
 client::zremrangebyrank(const std::string& key, int start, int stop, const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYRANK", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebyrank, key, start, stop);
   return *this;
 }
 
 client&
 client::zremrangebyrank(const std::string& key, double start, double stop, const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYRANK", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebyrank, key, start, stop);
   return *this;
 }
 
 client&
 client::zremrangebyrank(const std::string& key, const std::string& start, const std::string& stop,
     const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYRANK", key, start, stop}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebyrank, key, start, stop);
   return *this;
 }
 
 client&
 client::zremrangebyscore(const std::string& key, int min, int max, const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYSCORE", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebyscore, key, min, max);
   return *this;
 }
 
 client&
 client::zremrangebyscore(const std::string& key, double min, double max, const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYSCORE", key, std::to_string(min), std::to_string(max)}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebyscore, key, min, max);
   return *this;
 }
 
 client&
 client::zremrangebyscore(const std::string& key, const std::string& min, const std::string& max,
     const reply_callback_t& reply_callback) {
-  send({"ZREMRANGEBYSCORE", key, min, max}, reply_callback);
+  send_args(reply_callback, command_id::zremrangebyscore, key, min, max);
   return *this;
 }
 
 client&
 client::zrevrange(const std::string& key, int start, int stop, const reply_callback_t& reply_callback) {
-  send({"ZREVRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::zrevrange, key, start, stop);
   return *this;
 }
 
@@ -2566,15 +3159,15 @@ client&
 client::zrevrange(const std::string& key, int start, int stop, bool withscores,
     const reply_callback_t& reply_callback) {
   if (withscores)
-    send({"ZREVRANGE", key, std::to_string(start), std::to_string(stop), "WITHSCORES"}, reply_callback);
+    send_args(reply_callback, command_id::zrevrange, key, start, stop, "WITHSCORES");
   else
-    send({"ZREVRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+    send_args(reply_callback, command_id::zrevrange, key, start, stop);
   return *this;
 }
 
 client&
 client::zrevrange(const std::string& key, double start, double stop, const reply_callback_t& reply_callback) {
-  send({"ZREVRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+  send_args(reply_callback, command_id::zrevrange, key, start, stop);
   return *this;
 }
 
@@ -2582,16 +3175,16 @@ client&
 client::zrevrange(const std::string& key, double start, double stop, bool withscores,
     const reply_callback_t& reply_callback) {
   if (withscores)
-    send({"ZREVRANGE", key, std::to_string(start), std::to_string(stop), "WITHSCORES"}, reply_callback);
+    send_args(reply_callback, command_id::zrevrange, key, start, stop, "WITHSCORES");
   else
-    send({"ZREVRANGE", key, std::to_string(start), std::to_string(stop)}, reply_callback);
+    send_args(reply_callback, command_id::zrevrange, key, start, stop);
   return *this;
 }
 
 client&
 client::zrevrange(const std::string& key, const std::string& start, const std::string& stop,
     const reply_callback_t& reply_callback) {
-  send({"ZREVRANGE", key, start, stop}, reply_callback);
+  send_args(reply_callback, command_id::zrevrange, key, start, stop);
   return *this;
 }
 
@@ -2599,9 +3192,9 @@ client&
 client::zrevrange(const std::string& key, const std::string& start, const std::string& stop, bool withscores,
     const reply_callback_t& reply_callback) {
   if (withscores)
-    send({"ZREVRANGE", key, start, stop, "WITHSCORES"}, reply_callback);
+    send_args(reply_callback, command_id::zrevrange, key, start, stop, "WITHSCORES");
   else
-    send({"ZREVRANGE", key, start, stop}, reply_callback);
+    send_args(reply_callback, command_id::zrevrange, key, start, stop);
   return *this;
 }
 
@@ -2679,7 +3272,7 @@ client::zrevrangebylex(const std::string& key, const std::string& max, const std
 client&
 client::zrevrangebylex(const std::string& key, const std::string& max, const std::string& min, bool limit,
     std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZREVRANGEBYLEX", key, max, min};
+  command_frame cmd(command_id::zrevrangebylex, key, max, min);
 
   //! withscores (optional)
   if (withscores) {
@@ -2689,11 +3282,11 @@ client::zrevrangebylex(const std::string& key, const std::string& max, const std
   //! limit (optional)
   if (limit) {
     cmd.push_back("LIMIT");
-    cmd.push_back(std::to_string(offset));
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(offset);
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
@@ -2773,7 +3366,7 @@ client::zrevrangebyscore(const std::string& key, const std::string& max, const s
 client&
 client::zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min, bool limit,
     std::size_t offset, std::size_t count, bool withscores, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZREVRANGEBYSCORE", key, max, min};
+  command_frame cmd(command_id::zrevrangebyscore, key, max, min);
 
   //! withscores (optional)
   if (withscores) {
@@ -2783,17 +3376,17 @@ client::zrevrangebyscore(const std::string& key, const std::string& max, const s
   //! limit (optional)
   if (limit) {
     cmd.push_back("LIMIT");
-    cmd.push_back(std::to_string(offset));
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(offset);
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::zrevrank(const std::string& key, const std::string& member, const reply_callback_t& reply_callback) {
-  send({"ZREVRANK", key, member}, reply_callback);
+  send_args(reply_callback, command_id::zrevrank, key, member);
   return *this;
 }
 
@@ -2816,7 +3409,7 @@ client::zscan(const std::string& key, std::size_t cursor, std::size_t count, con
 client&
 client::zscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count,
     const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZSCAN", key, std::to_string(cursor)};
+  command_frame cmd(command_id::zscan, key, cursor);
 
   if (!pattern.empty()) {
     cmd.push_back("MATCH");
@@ -2825,23 +3418,23 @@ client::zscan(const std::string& key, std::size_t cursor, const std::string& pat
 
   if (count > 0) {
     cmd.push_back("COUNT");
-    cmd.push_back(std::to_string(count));
+    cmd.push_back(count);
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
 client&
 client::zscore(const std::string& key, const std::string& member, const reply_callback_t& reply_callback) {
-  send({"ZSCORE", key, member}, reply_callback);
+  send_args(reply_callback, command_id::zscore, key, member);
   return *this;
 }
 
 client&
 client::zunionstore(const std::string& destination, std::size_t numkeys, const std::vector<std::string>& keys,
     const std::vector<std::size_t> weights, aggregate_method method, const reply_callback_t& reply_callback) {
-  std::vector<std::string> cmd = {"ZUNIONSTORE", destination, std::to_string(numkeys)};
+  command_frame cmd(command_id::zunionstore, destination, numkeys);
 
   //! keys
   for (const auto& key : keys) {
@@ -2853,7 +3446,7 @@ client::zunionstore(const std::string& destination, std::size_t numkeys, const s
     cmd.push_back("WEIGHTS");
 
     for (auto weight : weights) {
-      cmd.push_back(std::to_string(weight));
+      cmd.push_back(weight);
     }
   }
 
@@ -2863,7 +3456,7 @@ client::zunionstore(const std::string& destination, std::size_t numkeys, const s
     cmd.push_back(aggregate_method_to_string(method));
   }
 
-  send(cmd, reply_callback);
+  send_encoded(cmd.release(), take_callback(reply_callback));
   return *this;
 }
 
@@ -2872,1433 +3465,1481 @@ client::zunionstore(const std::string& destination, std::size_t numkeys, const s
 //! std::future-based
 //!
 
-std::future<reply>
-client::exec_cmd(const std::function<client&(const reply_callback_t&)>& task) {
-  auto replay_p = std::make_shared<std::promise<reply>>();
+client::stored_reply_callback_t
+client::bulk_reply_callback(const std::shared_ptr<bulk_request>& ptrRequest) {
+  return [ptrRequest](reply& replyChunk) {
+    std::unique_lock<std::mutex> lock(ptrRequest->mtx);
+    reply& result = ptrRequest->result;
+
+    //! the first error is kept, otherwise integers are merged and other replies (OK) are passed as is
+    if (result.is_error()) {
+      //! nothing to merge
+    } else if (replyChunk.is_integer() && (result.is_integer() || result.is_null())) {
+      int64_t nValue = (result.is_integer() ? result.as_integer() : 0) + replyChunk.as_integer();
+      result.set(ptrRequest->bBoolean ? (nValue ? 1 : 0) : nValue);
+    } else {
+      result = std::move(replyChunk);
+    }
 
-  task([replay_p](reply& reply) {
-    replay_p->set_value(reply);
-  });
+    if (++ptrRequest->uReceived < ptrRequest->uSent || !ptrRequest->bComplete)
+      return;
 
-  return replay_p->get_future();
+    lock.unlock();
+    if (ptrRequest->callback)
+      ptrRequest->callback(result);
+  };
 }
 
-std::future<reply>
+void
+client::complete_bulk_request(const std::shared_ptr<bulk_request>& ptrRequest) {
+  std::unique_lock<std::mutex> lock(ptrRequest->mtx);
+  ptrRequest->bComplete = true;
+
+  //! replies can all be received before the end of the range, if another thread commits in the meantime
+  if (ptrRequest->uReceived < ptrRequest->uSent)
+    return;
+
+  lock.unlock();
+  if (ptrRequest->callback)
+    ptrRequest->callback(ptrRequest->result);
+}
+
+client::reply_future_t
 client::send(const std::vector<std::string>& vctRedisCmd) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return send(vctRedisCmd, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return send(vctRedisCmd, cb); });
+}
+
+client::reply_future_t
+client::send(const std::vector<std::string>& vctRedisCmd, const shared_value_t& value) {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return send(vctRedisCmd, value, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::append(const std::string& key, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return append(key, value, cb); });
+  return send_args_future(command_id::append, key, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::auth(const std::string& password) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return auth(password, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return auth(password, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::bgrewriteaof() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bgrewriteaof(cb); });
+  return send_args_future(command_id::bgrewriteaof);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bgsave() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bgsave(cb); });
+  return send_args_future(command_id::bgsave);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitcount(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitcount(key, cb); });
+  return send_args_future(command_id::bitcount, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitcount(const std::string& key, int start, int end) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitcount(key, start, end, cb); });
+  return send_args_future(command_id::bitcount, key, start, end);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitfield(const std::string& key, const std::vector<bitfield_operation>& operations) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitfield(key, operations, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return bitfield(key, operations, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitop(const std::string& operation, const std::string& destkey, const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitop(operation, destkey, keys, cb); });
+  return send_args_future(command_id::bitop, operation, destkey, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitpos(const std::string& key, int bit) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitpos(key, bit, cb); });
+  return send_args_future(command_id::bitpos, key, bit);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitpos(const std::string& key, int bit, int start) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitpos(key, bit, start, cb); });
+  return send_args_future(command_id::bitpos, key, bit, start);
 }
 
-std::future<reply>
+client::reply_future_t
 client::bitpos(const std::string& key, int bit, int start, int end) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return bitpos(key, bit, start, end, cb); });
+  return send_args_future(command_id::bitpos, key, bit, start, end);
 }
 
-std::future<reply>
+client::reply_future_t
 client::blpop(const std::vector<std::string>& keys, int timeout) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return blpop(keys, timeout, cb); });
+  return send_args_future(command_id::blpop, keys, timeout);
 }
 
-std::future<reply>
+client::reply_future_t
 client::brpop(const std::vector<std::string>& keys, int timeout) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return brpop(keys, timeout, cb); });
+  return send_args_future(command_id::brpop, keys, timeout);
 }
 
-std::future<reply>
+client::reply_future_t
 client::brpoplpush(const std::string& src, const std::string& dst, int timeout) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return brpoplpush(src, dst, timeout, cb); });
+  return send_args_future(command_id::brpoplpush, src, dst, timeout);
 }
 
-std::future<reply>
+client::reply_future_t
 client::client_list() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return client_list(cb); });
+  return send_args_future(command_id::client_list);
 }
 
-std::future<reply>
+client::reply_future_t
 client::client_getname() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return client_getname(cb); });
+  return send_args_future(command_id::client_getname);
 }
 
-std::future<reply>
+client::reply_future_t
 client::client_pause(int timeout) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return client_pause(timeout, cb); });
+  return send_args_future(command_id::client_pause, timeout);
 }
 
-std::future<reply>
+client::reply_future_t
 client::client_reply(const std::string& mode) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return client_reply(mode, cb); });
+  return send_args_future(command_id::client_reply, mode);
 }
 
-std::future<reply>
+client::reply_future_t
 client::client_setname(const std::string& name) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return client_setname(name, cb); });
+  return send_args_future(command_id::client_setname, name);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_addslots(const std::vector<std::string>& p_slots) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_addslots(p_slots, cb); });
+  return send_args_future(command_id::cluster_addslots, p_slots);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_count_failure_reports(const std::string& node_id) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_count_failure_reports(node_id, cb); });
+  return send_args_future(command_id::cluster_count_failure_reports, node_id);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_countkeysinslot(const std::string& slot) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_countkeysinslot(slot, cb); });
+  return send_args_future(command_id::cluster_countkeysinslot, slot);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_delslots(const std::vector<std::string>& p_slots) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_delslots(p_slots, cb); });
+  return send_args_future(command_id::cluster_delslots, p_slots);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_failover() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_failover(cb); });
+  return send_args_future(command_id::cluster_failover);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_failover(const std::string& mode) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_failover(mode, cb); });
+  return send_args_future(command_id::cluster_failover, mode);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_forget(const std::string& node_id) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_forget(node_id, cb); });
+  return send_args_future(command_id::cluster_forget, node_id);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_getkeysinslot(const std::string& slot, int count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_getkeysinslot(slot, count, cb); });
+  return send_args_future(command_id::cluster_getkeysinslot, slot, count);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_info() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_info(cb); });
+  return send_args_future(command_id::cluster_info);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_keyslot(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_keyslot(key, cb); });
+  return send_args_future(command_id::cluster_keyslot, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_meet(const std::string& ip, int port) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_meet(ip, port, cb); });
+  return send_args_future(command_id::cluster_meet, ip, port);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_nodes() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_nodes(cb); });
+  return send_args_future(command_id::cluster_nodes);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_replicate(const std::string& node_id) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_replicate(node_id, cb); });
+  return send_args_future(command_id::cluster_replicate, node_id);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_reset(const std::string& mode) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_reset(mode, cb); });
+  return send_args_future(command_id::cluster_reset, mode);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_saveconfig() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_saveconfig(cb); });
+  return send_args_future(command_id::cluster_saveconfig);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_set_config_epoch(const std::string& epoch) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_set_config_epoch(epoch, cb); });
+  return send_args_future(command_id::cluster_set_config_epoch, epoch);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_setslot(const std::string& slot, const std::string& mode) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_setslot(slot, mode, cb); });
+  return send_args_future(command_id::cluster_setslot, slot, mode);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_setslot(const std::string& slot, const std::string& mode, const std::string& node_id) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_setslot(slot, mode, node_id, cb); });
+  return send_args_future(command_id::cluster_setslot, slot, mode, node_id);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_slaves(const std::string& node_id) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_slaves(node_id, cb); });
+  return send_args_future(command_id::cluster_slaves, node_id);
 }
 
-std::future<reply>
+client::reply_future_t
 client::cluster_slots() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return cluster_slots(cb); });
+  return send_args_future(command_id::cluster_slots);
 }
 
-std::future<reply>
+client::reply_future_t
 client::command() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return command(cb); });
+  return send_args_future(command_id::command);
 }
 
-std::future<reply>
+client::reply_future_t
 client::command_count() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return command_count(cb); });
+  return send_args_future(command_id::command_count);
 }
 
-std::future<reply>
+client::reply_future_t
 client::command_getkeys() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return command_getkeys(cb); });
+  return send_args_future(command_id::command_getkeys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::command_info(const std::vector<std::string>& command_name) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return command_info(command_name, cb); });
+  return send_args_future(command_id::command_count, command_name);
 }
 
-std::future<reply>
+client::reply_future_t
 client::config_get(const std::string& param) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return config_get(param, cb); });
+  return send_args_future(command_id::config_get, param);
 }
 
-std::future<reply>
+client::reply_future_t
 client::config_rewrite() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return config_rewrite(cb); });
+  return send_args_future(command_id::config_rewrite);
 }
 
-std::future<reply>
+client::reply_future_t
 client::config_set(const std::string& param, const std::string& val) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return config_set(param, val, cb); });
+  return send_args_future(command_id::config_set, param, val);
 }
 
-std::future<reply>
+client::reply_future_t
 client::config_resetstat() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return config_resetstat(cb); });
+  return send_args_future(command_id::config_resetstat);
 }
 
-std::future<reply>
+client::reply_future_t
 client::dbsize() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return dbsize(cb); });
+  return send_args_future(command_id::dbsize);
 }
 
-std::future<reply>
+client::reply_future_t
 client::debug_object(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return debug_object(key, cb); });
+  return send_args_future(command_id::debug_object, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::debug_segfault() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return debug_segfault(cb); });
+  return send_args_future(command_id::debug_segfault);
 }
 
-std::future<reply>
+client::reply_future_t
 client::decr(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return decr(key, cb); });
+  return send_args_future(command_id::decr, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::decrby(const std::string& key, int val) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return decrby(key, val, cb); });
+  return send_args_future(command_id::decrby, key, val);
 }
 
-std::future<reply>
+client::reply_future_t
 client::del(const std::vector<std::string>& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return del(key, cb); });
+  return send_args_future(command_id::del, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::discard() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return discard(cb); });
+  return send_args_future(command_id::discard);
 }
 
-std::future<reply>
+client::reply_future_t
 client::dump(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return dump(key, cb); });
+  return send_args_future(command_id::dump, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::echo(const std::string& msg) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return echo(msg, cb); });
+  return send_args_future(command_id::echo, msg);
 }
 
-std::future<reply>
+client::reply_future_t
 client::eval(const std::string& script, int numkeys, const std::vector<std::string>& keys,
     const std::vector<std::string>& args) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return eval(script, numkeys, keys, args, cb); });
+  return send_args_future(command_id::eval, script, numkeys, keys, args);
 }
 
-std::future<reply>
+client::reply_future_t
 client::evalsha(const std::string& sha1, int numkeys, const std::vector<std::string>& keys,
     const std::vector<std::string>& args) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return evalsha(sha1, numkeys, keys, args, cb); });
+  return send_args_future(command_id::evalsha, sha1, numkeys, keys, args);
 }
 
-std::future<reply>
+client::reply_future_t
 client::exec() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return exec(cb); });
+  return send_args_future(command_id::exec);
 }
 
-std::future<reply>
+client::reply_future_t
 client::exists(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return exists(keys, cb); });
+  return send_args_future(command_id::exists, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::expire(const std::string& key, int seconds) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return expire(key, seconds, cb); });
+  return send_args_future(command_id::expire, key, seconds);
 }
 
-std::future<reply>
+client::reply_future_t
 client::expireat(const std::string& key, int timestamp) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return expireat(key, timestamp, cb); });
+  return send_args_future(command_id::expireat, key, timestamp);
 }
 
-std::future<reply>
+client::reply_future_t
 client::flushall() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return flushall(cb); });
+  return send_args_future(command_id::flushall);
 }
 
-std::future<reply>
+client::reply_future_t
 client::flushdb() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return flushdb(cb); });
+  return send_args_future(command_id::flushdb);
 }
 
-std::future<reply>
+client::reply_future_t
 client::geoadd(const std::string& key,
     const std::vector<std::tuple<std::string, std::string, std::string>>& long_lat_memb) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return geoadd(key, long_lat_memb, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return geoadd(key, long_lat_memb, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::geohash(const std::string& key, const std::vector<std::string>& members) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return geohash(key, members, cb); });
+  return send_args_future(command_id::geohash, key, members);
 }
 
-std::future<reply>
+client::reply_future_t
 client::geopos(const std::string& key, const std::vector<std::string>& members) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return geopos(key, members, cb); });
+  return send_args_future(command_id::geopos, key, members);
 }
 
-std::future<reply>
+client::reply_future_t
 client::geodist(const std::string& key, const std::string& member_1, const std::string& member_2,
     const std::string& unit) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return geodist(key, member_1, member_2, unit, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::georadius(const std::string& key, double longitude, double latitude, double radius, geo_unit unit,
     bool with_coord, bool with_dist, bool with_hash, bool asc_order, std::size_t count,
     const std::string& store_key, const std::string& storedist_key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return georadius(key, longitude, latitude, radius, unit, with_coord, with_dist, with_hash, asc_order, count,
           store_key, storedist_key, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::georadiusbymember(const std::string& key, const std::string& member, double radius, geo_unit unit,
     bool with_coord, bool with_dist, bool with_hash, bool asc_order, std::size_t count,
     const std::string& store_key, const std::string& storedist_key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return georadiusbymember(key, member, radius, unit, with_coord, with_dist, with_hash, asc_order, count,
           store_key, storedist_key, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::get(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return get(key, cb); });
+  return send_args_future(command_id::get, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::getbit(const std::string& key, int offset) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return getbit(key, offset, cb); });
+  return send_args_future(command_id::getbit, key, offset);
 }
 
-std::future<reply>
+client::reply_future_t
 client::getrange(const std::string& key, int start, int end) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return getrange(key, start, end, cb); });
+  return send_args_future(command_id::getrange, key, start, end);
 }
 
-std::future<reply>
+client::reply_future_t
 client::getset(const std::string& key, const std::string& val) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return getset(key, val, cb); });
+  return send_args_future(command_id::getset, key, val);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hdel(const std::string& key, const std::vector<std::string>& fields) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hdel(key, fields, cb); });
+  return send_args_future(command_id::hdel, key, fields);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hexists(const std::string& key, const std::string& field) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hexists(key, field, cb); });
+  return send_args_future(command_id::hexists, key, field);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hget(const std::string& key, const std::string& field) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hget(key, field, cb); });
+  return send_args_future(command_id::hget, key, field);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hgetall(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hgetall(key, cb); });
+  return send_args_future(command_id::hgetall, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hincrby(const std::string& key, const std::string& field, int incr) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hincrby(key, field, incr, cb); });
+  return send_args_future(command_id::hincrby, key, field, incr);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hincrbyfloat(const std::string& key, const std::string& field, float incr) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hincrbyfloat(key, field, incr, cb); });
+  return send_args_future(command_id::hincrbyfloat, key, field, incr);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hkeys(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hkeys(key, cb); });
+  return send_args_future(command_id::hkeys, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hlen(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hlen(key, cb); });
+  return send_args_future(command_id::hlen, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hmget(const std::string& key, const std::vector<std::string>& fields) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hmget(key, fields, cb); });
+  return send_args_future(command_id::hmget, key, fields);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hmset(const std::string& key, const std::vector<std::pair<std::string, std::string>>& field_val) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hmset(key, field_val, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return hmset(key, field_val, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::hscan(const std::string& key, std::size_t cursor) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hscan(key, cursor, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return hscan(key, cursor, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::hscan(const std::string& key, std::size_t cursor, const std::string& pattern) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hscan(key, cursor, pattern, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return hscan(key, cursor, pattern, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::hscan(const std::string& key, std::size_t cursor, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hscan(key, cursor, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return hscan(key, cursor, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::hscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hscan(key, cursor, pattern, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return hscan(key, cursor, pattern, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::hset(const std::string& key, const std::string& field, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hset(key, field, value, cb); });
+  return send_args_future(command_id::hset, key, field, value);
+}
+
+client::reply_future_t
+client::hset(const std::string& key, const std::string& field, const shared_value_t& value) {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return hset(key, field, value, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::hsetnx(const std::string& key, const std::string& field, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hsetnx(key, field, value, cb); });
+  return send_args_future(command_id::hsetnx, key, field, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hstrlen(const std::string& key, const std::string& field) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hstrlen(key, field, cb); });
+  return send_args_future(command_id::hstrlen, key, field);
 }
 
-std::future<reply>
+client::reply_future_t
 client::hvals(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return hvals(key, cb); });
+  return send_args_future(command_id::hvals, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::incr(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return incr(key, cb); });
+  return send_args_future(command_id::incr, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::incrby(const std::string& key, int incr) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return incrby(key, incr, cb); });
+  return send_args_future(command_id::incrby, key, incr);
 }
 
-std::future<reply>
+client::reply_future_t
 client::incrbyfloat(const std::string& key, float incr) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return incrbyfloat(key, incr, cb); });
+  return send_args_future(command_id::incrbyfloat, key, incr);
 }
 
-std::future<reply>
+client::reply_future_t
 client::info(const std::string& section) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return info(section, cb); });
+  return send_args_future(command_id::info, section);
 }
 
-std::future<reply>
+client::reply_future_t
 client::keys(const std::string& pattern) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return keys(pattern, cb); });
+  return send_args_future(command_id::keys, pattern);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lastsave() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lastsave(cb); });
+  return send_args_future(command_id::lastsave);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lindex(const std::string& key, int index) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lindex(key, index, cb); });
+  return send_args_future(command_id::lindex, key, index);
 }
 
-std::future<reply>
+client::reply_future_t
 client::linsert(const std::string& key, const std::string& before_after, const std::string& pivot,
     const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return linsert(key, before_after, pivot, value, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::llen(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return llen(key, cb); });
+  return send_args_future(command_id::llen, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lpop(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lpop(key, cb); });
+  return send_args_future(command_id::lpop, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lpush(const std::string& key, const std::vector<std::string>& values) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lpush(key, values, cb); });
+  return send_args_future(command_id::lpush, key, values);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lpushx(const std::string& key, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lpushx(key, value, cb); });
+  return send_args_future(command_id::lpushx, key, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lrange(const std::string& key, int start, int stop) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lrange(key, start, stop, cb); });
+  return send_args_future(command_id::lrange, key, start, stop);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lrem(const std::string& key, int count, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lrem(key, count, value, cb); });
+  return send_args_future(command_id::lrem, key, count, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::lset(const std::string& key, int index, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return lset(key, index, value, cb); });
+  return send_args_future(command_id::lset, key, index, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::ltrim(const std::string& key, int start, int stop) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return ltrim(key, start, stop, cb); });
+  return send_args_future(command_id::ltrim, key, start, stop);
 }
 
-std::future<reply>
+client::reply_future_t
 client::mget(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return mget(keys, cb); });
+  return send_args_future(command_id::mget, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::migrate(const std::string& host, int port, const std::string& key, const std::string& dest_db, int timeout,
     bool copy, bool replace, const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return migrate(host, port, key, dest_db, timeout, copy, replace, keys, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::monitor() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return monitor(cb); });
+  return send_args_future(command_id::monitor);
 }
 
-std::future<reply>
+client::reply_future_t
 client::move(const std::string& key, const std::string& db) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return move(key, db, cb); });
+  return send_args_future(command_id::move, key, db);
 }
 
-std::future<reply>
+client::reply_future_t
 client::mset(const std::vector<std::pair<std::string, std::string>>& key_vals) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return mset(key_vals, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return mset(key_vals, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::msetnx(const std::vector<std::pair<std::string, std::string>>& key_vals) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return msetnx(key_vals, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return msetnx(key_vals, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::multi() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return multi(cb); });
+  return send_args_future(command_id::multi);
 }
 
-std::future<reply>
+client::reply_future_t
 client::object(const std::string& subcommand, const std::vector<std::string>& args) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return object(subcommand, args, cb); });
+  return send_args_future(command_id::object, subcommand, args);
 }
 
-std::future<reply>
+client::reply_future_t
 client::persist(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return persist(key, cb); });
+  return send_args_future(command_id::persist, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pexpire(const std::string& key, int milliseconds) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pexpire(key, milliseconds, cb); });
+  return send_args_future(command_id::pexpire, key, milliseconds);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pexpireat(const std::string& key, int milliseconds_timestamp) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pexpireat(key, milliseconds_timestamp, cb); });
+  return send_args_future(command_id::pexpireat, key, milliseconds_timestamp);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pfadd(const std::string& key, const std::vector<std::string>& elements) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pfadd(key, elements, cb); });
+  return send_args_future(command_id::pfadd, key, elements);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pfcount(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pfcount(keys, cb); });
+  return send_args_future(command_id::pfcount, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pfmerge(const std::string& destkey, const std::vector<std::string>& sourcekeys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pfmerge(destkey, sourcekeys, cb); });
+  return send_args_future(command_id::pfmerge, destkey, sourcekeys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::ping() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return ping(cb); });
+  return send_args_future(command_id::ping);
 }
 
-std::future<reply>
+client::reply_future_t
 client::ping(const std::string& message) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return ping(message, cb); });
+  return send_args_future(command_id::ping, message);
 }
 
-std::future<reply>
+client::reply_future_t
 client::psetex(const std::string& key, int milliseconds, const std::string& val) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return psetex(key, milliseconds, val, cb); });
+  return send_args_future(command_id::psetex, key, milliseconds, val);
 }
 
-std::future<reply>
+client::reply_future_t
 client::publish(const std::string& channel, const std::string& message) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return publish(channel, message, cb); });
+  return send_args_future(command_id::publish, channel, message);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pubsub(const std::string& subcommand, const std::vector<std::string>& args) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pubsub(subcommand, args, cb); });
+  return send_args_future(command_id::pubsub, subcommand, args);
 }
 
-std::future<reply>
+client::reply_future_t
 client::pttl(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return pttl(key, cb); });
+  return send_args_future(command_id::pttl, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::quit() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return quit(cb); });
+  return send_args_future(command_id::quit);
 }
 
-std::future<reply>
+client::reply_future_t
 client::randomkey() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return randomkey(cb); });
+  return send_args_future(command_id::randomkey);
 }
 
-std::future<reply>
+client::reply_future_t
 client::readonly() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return readonly(cb); });
+  return send_args_future(command_id::readonly);
 }
 
-std::future<reply>
+client::reply_future_t
 client::readwrite() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return readwrite(cb); });
+  return send_args_future(command_id::readwrite);
 }
 
-std::future<reply>
+client::reply_future_t
 client::rename(const std::string& key, const std::string& newkey) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return rename(key, newkey, cb); });
+  return send_args_future(command_id::rename, key, newkey);
 }
 
-std::future<reply>
+client::reply_future_t
 client::renamenx(const std::string& key, const std::string& newkey) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return renamenx(key, newkey, cb); });
+  return send_args_future(command_id::renamenx, key, newkey);
 }
 
-std::future<reply>
+client::reply_future_t
 client::restore(const std::string& key, int ttl, const std::string& serialized_value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return restore(key, ttl, serialized_value, cb); });
+  return send_args_future(command_id::restore, key, ttl, serialized_value);
 }
 
-std::future<reply>
+client::reply_future_t
+client::restore(const std::string& key, int ttl, const shared_value_t& serialized_value) {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return restore(key, ttl, serialized_value, cb); });
+}
+
+client::reply_future_t
 client::restore(const std::string& key, int ttl, const std::string& serialized_value, const std::string& replace) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return restore(key, ttl, serialized_value, replace, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::role() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return role(cb); });
+  return send_args_future(command_id::role);
 }
 
-std::future<reply>
+client::reply_future_t
 client::rpop(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return rpop(key, cb); });
+  return send_args_future(command_id::rpop, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::rpoplpush(const std::string& src, const std::string& dst) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return rpoplpush(src, dst, cb); });
+  return send_args_future(command_id::rpoplpush, src, dst);
 }
 
-std::future<reply>
+client::reply_future_t
 client::rpush(const std::string& key, const std::vector<std::string>& values) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return rpush(key, values, cb); });
+  return send_args_future(command_id::rpush, key, values);
 }
 
-std::future<reply>
+client::reply_future_t
 client::rpushx(const std::string& key, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return rpushx(key, value, cb); });
+  return send_args_future(command_id::rpushx, key, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sadd(const std::string& key, const std::vector<std::string>& members) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sadd(key, members, cb); });
+  return send_args_future(command_id::sadd, key, members);
 }
 
-std::future<reply>
+client::reply_future_t
 client::scan(std::size_t cursor) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return scan(cursor, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return scan(cursor, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::scan(std::size_t cursor, const std::string& pattern) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return scan(cursor, pattern, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return scan(cursor, pattern, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::scan(std::size_t cursor, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return scan(cursor, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return scan(cursor, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::scan(std::size_t cursor, const std::string& pattern, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return scan(cursor, pattern, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return scan(cursor, pattern, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::save() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return save(cb); });
+  return send_args_future(command_id::save);
 }
 
-std::future<reply>
+client::reply_future_t
 client::scard(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return scard(key, cb); });
+  return send_args_future(command_id::scard, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::script_debug(const std::string& mode) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return script_debug(mode, cb); });
+  return send_args_future(command_id::script_debug, mode);
 }
 
-std::future<reply>
+client::reply_future_t
 client::script_exists(const std::vector<std::string>& scripts) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return script_exists(scripts, cb); });
+  return send_args_future(command_id::script_exists, scripts);
 }
 
-std::future<reply>
+client::reply_future_t
 client::script_flush() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return script_flush(cb); });
+  return send_args_future(command_id::script_flush);
 }
 
-std::future<reply>
+client::reply_future_t
 client::script_kill() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return script_kill(cb); });
+  return send_args_future(command_id::script_kill);
 }
 
-std::future<reply>
+client::reply_future_t
 client::script_load(const std::string& script) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return script_load(script, cb); });
+  return send_args_future(command_id::script_load, script);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sdiff(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sdiff(keys, cb); });
+  return send_args_future(command_id::sdiff, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sdiffstore(const std::string& dst, const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sdiffstore(dst, keys, cb); });
+  return send_args_future(command_id::sdiffstore, dst, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::select(int index) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return select(index, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return select(index, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::set(const std::string& key, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return set(key, value, cb); });
+  return send_args_future(command_id::set, key, value);
+}
+
+client::reply_future_t
+client::set(const std::string& key, const shared_value_t& value) {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return set(key, value, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::set_advanced(const std::string& key, const std::string& value, bool ex, int ex_sec, bool px,
     int px_milli, bool nx, bool xx) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return set_advanced(key, value, ex, ex_sec, px, px_milli, nx, xx, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::setbit_(const std::string& key, int offset, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return setbit_(key, offset, value, cb); });
+  return send_args_future(command_id::setbit, key, offset, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::setex(const std::string& key, int seconds, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return setex(key, seconds, value, cb); });
+  return send_args_future(command_id::setex, key, seconds, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::setnx(const std::string& key, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return setnx(key, value, cb); });
+  return send_args_future(command_id::setnx, key, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::setrange(const std::string& key, int offset, const std::string& value) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return setrange(key, offset, value, cb); });
+  return send_args_future(command_id::setrange, key, offset, value);
 }
 
-std::future<reply>
+client::reply_future_t
 client::shutdown() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return shutdown(cb); });
+  return send_args_future(command_id::shutdown);
 }
 
-std::future<reply>
+client::reply_future_t
 client::shutdown(const std::string& save) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return shutdown(save, cb); });
+  return send_args_future(command_id::shutdown, save);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sinter(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sinter(keys, cb); });
+  return send_args_future(command_id::sinter, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sinterstore(const std::string& dst, const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sinterstore(dst, keys, cb); });
+  return send_args_future(command_id::sinterstore, dst, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sismember(const std::string& key, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sismember(key, member, cb); });
+  return send_args_future(command_id::sismember, key, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::slaveof(const std::string& host, int port) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return slaveof(host, port, cb); });
+  return send_args_future(command_id::slaveof, host, port);
 }
 
-std::future<reply>
+client::reply_future_t
 client::slowlog(const std::string& subcommand) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return slowlog(subcommand, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return slowlog(subcommand, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::slowlog(const std::string& subcommand, const std::string& argument) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return slowlog(subcommand, argument, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return slowlog(subcommand, argument, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::smembers(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return smembers(key, cb); });
+  return send_args_future(command_id::smembers, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::smove(const std::string& src, const std::string& dst, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return smove(src, dst, member, cb); });
+  return send_args_future(command_id::smove, src, dst, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sort(key, cb); });
+  return send_args_future(command_id::sort, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order, bool alpha) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, get_patterns, asc_order, alpha, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, std::size_t offset, std::size_t count,
     const std::vector<std::string>& get_patterns, bool asc_order, bool alpha) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, offset, count, get_patterns, asc_order, alpha, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, const std::string& by_pattern, const std::vector<std::string>& get_patterns,
     bool asc_order, bool alpha) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, by_pattern, get_patterns, asc_order, alpha, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, const std::vector<std::string>& get_patterns, bool asc_order, bool alpha,
     const std::string& store_dest) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, get_patterns, asc_order, alpha, store_dest, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, std::size_t offset, std::size_t count,
     const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, offset, count, get_patterns, asc_order, alpha, store_dest, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, const std::string& by_pattern, const std::vector<std::string>& get_patterns,
     bool asc_order, bool alpha, const std::string& store_dest) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, by_pattern, get_patterns, asc_order, alpha, store_dest, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
     const std::vector<std::string>& get_patterns, bool asc_order, bool alpha) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, by_pattern, offset, count, get_patterns, asc_order, alpha, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sort(const std::string& key, const std::string& by_pattern, std::size_t offset, std::size_t count,
     const std::vector<std::string>& get_patterns, bool asc_order, bool alpha, const std::string& store_dest) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return sort(key, by_pattern, offset, count, get_patterns, asc_order, alpha, store_dest, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::spop(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return spop(key, cb); });
+  return send_args_future(command_id::spop, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::spop(const std::string& key, int count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return spop(key, count, cb); });
+  return send_args_future(command_id::spop, key, count);
 }
 
-std::future<reply>
+client::reply_future_t
 client::srandmember(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return srandmember(key, cb); });
+  return send_args_future(command_id::srandmember, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::srandmember(const std::string& key, int count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return srandmember(key, count, cb); });
+  return send_args_future(command_id::srandmember, key, count);
 }
 
-std::future<reply>
+client::reply_future_t
 client::srem(const std::string& key, const std::vector<std::string>& members) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return srem(key, members, cb); });
+  return send_args_future(command_id::srem, key, members);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sscan(const std::string& key, std::size_t cursor) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sscan(key, cursor, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return sscan(key, cursor, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sscan(const std::string& key, std::size_t cursor, const std::string& pattern) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sscan(key, cursor, pattern, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return sscan(key, cursor, pattern, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sscan(const std::string& key, std::size_t cursor, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sscan(key, cursor, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return sscan(key, cursor, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::sscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sscan(key, cursor, pattern, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return sscan(key, cursor, pattern, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::strlen(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return strlen(key, cb); });
+  return send_args_future(command_id::strlen, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sunion(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sunion(keys, cb); });
+  return send_args_future(command_id::sunion, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sunionstore(const std::string& dst, const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sunionstore(dst, keys, cb); });
+  return send_args_future(command_id::sunionstore, dst, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::sync() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return sync(cb); });
+  return send_args_future(command_id::sync);
 }
 
-std::future<reply>
+client::reply_future_t
 client::time() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return time(cb); });
+  return send_args_future(command_id::time);
 }
 
-std::future<reply>
+client::reply_future_t
 client::ttl(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return ttl(key, cb); });
+  return send_args_future(command_id::ttl, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::type(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return type(key, cb); });
+  return send_args_future(command_id::type, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::unwatch() {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return unwatch(cb); });
+  return send_args_future(command_id::unwatch);
 }
 
-std::future<reply>
+client::reply_future_t
 client::wait(int numslaves, int timeout) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return wait(numslaves, timeout, cb); });
+  return send_args_future(command_id::wait, numslaves, timeout);
 }
 
-std::future<reply>
+client::reply_future_t
 client::watch(const std::vector<std::string>& keys) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return watch(keys, cb); });
+  return send_args_future(command_id::watch, keys);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zadd(const std::string& key, const std::vector<std::string>& options,
     const std::multimap<std::string, std::string>& score_members) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zadd(key, options, score_members, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zcard(const std::string& key) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zcard(key, cb); });
+  return send_args_future(command_id::zcard, key);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zcount(const std::string& key, int min, int max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zcount(key, min, max, cb); });
+  return send_args_future(command_id::zcount, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zcount(const std::string& key, double min, double max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zcount(key, min, max, cb); });
+  return send_args_future(command_id::zcount, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zcount(const std::string& key, const std::string& min, const std::string& max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zcount(key, min, max, cb); });
+  return send_args_future(command_id::zcount, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zincrby(const std::string& key, int incr, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zincrby(key, incr, member, cb); });
+  return send_args_future(command_id::zincrby, key, incr, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zincrby(const std::string& key, double incr, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zincrby(key, incr, member, cb); });
+  return send_args_future(command_id::zincrby, key, incr, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zincrby(const std::string& key, const std::string& incr, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zincrby(key, incr, member, cb); });
+  return send_args_future(command_id::zincrby, key, incr, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zinterstore(const std::string& destination, std::size_t numkeys, const std::vector<std::string>& keys,
     const std::vector<std::size_t> weights, aggregate_method method) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zinterstore(destination, numkeys, keys, weights, method, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zlexcount(const std::string& key, int min, int max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zlexcount(key, min, max, cb); });
+  return send_args_future(command_id::zlexcount, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zlexcount(const std::string& key, double min, double max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zlexcount(key, min, max, cb); });
+  return send_args_future(command_id::zlexcount, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zlexcount(const std::string& key, const std::string& min, const std::string& max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zlexcount(key, min, max, cb); });
+  return send_args_future(command_id::zlexcount, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrange(const std::string& key, int start, int stop, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrange(key, start, stop, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrange(key, start, stop, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrange(const std::string& key, double start, double stop, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrange(key, start, stop, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrange(key, start, stop, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrange(const std::string& key, const std::string& start, const std::string& stop, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrange(key, start, stop, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrange(key, start, stop, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebylex(const std::string& key, int min, int max, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrangebylex(key, min, max, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrangebylex(key, min, max, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebylex(const std::string& key, double min, double max, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrangebylex(key, min, max, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrangebylex(key, min, max, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebylex(const std::string& key, const std::string& min, const std::string& max, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrangebylex(key, min, max, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrangebylex(key, min, max, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebylex(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebylex(key, min, max, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebylex(const std::string& key, double min, double max, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebylex(key, min, max, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebylex(const std::string& key, const std::string& min, const std::string& max, std::size_t offset,
     std::size_t count, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebylex(key, min, max, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebyscore(const std::string& key, int min, int max, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebyscore(key, min, max, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebyscore(const std::string& key, double min, double max, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebyscore(key, min, max, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebyscore(const std::string& key, const std::string& min, const std::string& max, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebyscore(key, min, max, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebyscore(const std::string& key, int min, int max, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebyscore(key, min, max, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebyscore(const std::string& key, double min, double max, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebyscore(key, min, max, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrangebyscore(const std::string& key, const std::string& min, const std::string& max, std::size_t offset,
     std::size_t count, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrangebyscore(key, min, max, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrank(const std::string& key, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrank(key, member, cb); });
+  return send_args_future(command_id::zrank, key, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrem(const std::string& key, const std::vector<std::string>& members) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrem(key, members, cb); });
+  return send_args_future(command_id::zrem, key, members);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebylex(const std::string& key, int min, int max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebylex(key, min, max, cb); });
+  return send_args_future(command_id::zremrangebylex, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebylex(const std::string& key, double min, double max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebylex(key, min, max, cb); });
+  return send_args_future(command_id::zremrangebylex, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebylex(const std::string& key, const std::string& min, const std::string& max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebylex(key, min, max, cb); });
+  return send_args_future(command_id::zremrangebylex, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebyrank(const std::string& key, int start, int stop) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebyrank(key, start, stop, cb); });
+  return send_args_future(command_id::zremrangebyrank, key, start, stop);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebyrank(const std::string& key, double start, double stop) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebyrank(key, start, stop, cb); });
+  return send_args_future(command_id::zremrangebyrank, key, start, stop);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebyrank(const std::string& key, const std::string& start, const std::string& stop) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebyrank(key, start, stop, cb); });
+  return send_args_future(command_id::zremrangebyrank, key, start, stop);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebyscore(const std::string& key, int min, int max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebyscore(key, min, max, cb); });
+  return send_args_future(command_id::zremrangebyscore, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebyscore(const std::string& key, double min, double max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebyscore(key, min, max, cb); });
+  return send_args_future(command_id::zremrangebyscore, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zremrangebyscore(const std::string& key, const std::string& min, const std::string& max) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zremrangebyscore(key, min, max, cb); });
+  return send_args_future(command_id::zremrangebyscore, key, min, max);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrange(const std::string& key, int start, int stop, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrevrange(key, start, stop, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrevrange(key, start, stop, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrange(const std::string& key, double start, double stop, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrevrange(key, start, stop, withscores, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zrevrange(key, start, stop, withscores, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrange(const std::string& key, const std::string& start, const std::string& stop, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrange(key, start, stop, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebylex(const std::string& key, int max, int min, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebylex(key, max, min, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebylex(const std::string& key, double max, double min, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebylex(key, max, min, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebylex(const std::string& key, const std::string& max, const std::string& min, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebylex(key, max, min, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebylex(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebylex(key, max, min, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebylex(const std::string& key, double max, double min, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebylex(key, max, min, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebylex(const std::string& key, const std::string& max, const std::string& min, std::size_t offset,
     std::size_t count, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebylex(key, max, min, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebyscore(const std::string& key, int max, int min, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebyscore(key, max, min, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebyscore(const std::string& key, double max, double min, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebyscore(key, max, min, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebyscore(key, max, min, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebyscore(const std::string& key, int max, int min, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebyscore(key, max, min, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebyscore(const std::string& key, double max, double min, std::size_t offset, std::size_t count,
     bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebyscore(key, max, min, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrangebyscore(const std::string& key, const std::string& max, const std::string& min, std::size_t offset,
     std::size_t count, bool withscores) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zrevrangebyscore(key, max, min, offset, count, withscores, cb);
   });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zrevrank(const std::string& key, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zrevrank(key, member, cb); });
+  return send_args_future(command_id::zrevrank, key, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zscan(const std::string& key, std::size_t cursor) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zscan(key, cursor, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zscan(key, cursor, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zscan(const std::string& key, std::size_t cursor, const std::string& pattern) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zscan(key, cursor, pattern, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zscan(key, cursor, pattern, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zscan(const std::string& key, std::size_t cursor, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zscan(key, cursor, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zscan(key, cursor, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zscan(const std::string& key, std::size_t cursor, const std::string& pattern, std::size_t count) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zscan(key, cursor, pattern, count, cb); });
+  return exec_cmd([&](const reply_callback_t& cb) -> client& { return zscan(key, cursor, pattern, count, cb); });
 }
 
-std::future<reply>
+client::reply_future_t
 client::zscore(const std::string& key, const std::string& member) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& { return zscore(key, member, cb); });
+  return send_args_future(command_id::zscore, key, member);
 }
 
-std::future<reply>
+client::reply_future_t
 client::zunionstore(const std::string& destination, std::size_t numkeys, const std::vector<std::string>& keys,
     const std::vector<std::size_t> weights, aggregate_method method) {
-  return exec_cmd([=](const reply_callback_t& cb) -> client& {
+  return exec_cmd([&](const reply_callback_t& cb) -> client& {
       return zunionstore(destination, numkeys, keys, weights, method, cb);
   });
 }
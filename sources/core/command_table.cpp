@@ -0,0 +1,38 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/command_table.hpp>
+
+namespace cpp_redis {
+
+//! the lengths written in the command list must match the names, as they end up in the pre-encoded headers
+#define __CPP_REDIS_COMMAND(id, name, name_len, arity, flags, first_key, last_key, key_step) \
+  static_assert(sizeof(name) - 1 == name_len, "invalid length for command " name);
+#define __CPP_REDIS_SUBCOMMAND(id, name, name_len, sub, sub_len, arity, flags, first_key, last_key, key_step) \
+  static_assert(sizeof(name) - 1 == name_len && sizeof(sub) - 1 == sub_len, "invalid length for command " name " " sub);
+__CPP_REDIS_COMMAND_LIST(__CPP_REDIS_COMMAND, __CPP_REDIS_SUBCOMMAND)
+#undef __CPP_REDIS_COMMAND
+#undef __CPP_REDIS_SUBCOMMAND
+
+constexpr command_descriptor command_table::s_commands[];
+
+} // namespace cpp_redis
@@ -23,22 +23,146 @@
 #include <cpp_redis/core/reply.hpp>
 #include <cpp_redis/misc/error.hpp>
 
+#include <new>
+
 namespace cpp_redis {
 
 reply::reply(void)
-: m_eType(type::null) {}
+: m_eType(type::null)
+, m_nValue(0) {}
 
 reply::reply(const std::string& value, string_type reply_type)
-: m_eType(static_cast<type>(reply_type))
-, m_sValue(value) {}
+: m_eType(static_cast<type>(reply_type)) {
+  new (&m_sValue) std::string(value);
+}
+
+reply::reply(std::string&& value, string_type reply_type)
+: m_eType(static_cast<type>(reply_type)) {
+  new (&m_sValue) std::string(std::move(value));
+}
 
 reply::reply(int64_t value)
 : m_eType(type::integer)
 , m_nValue(value) {}
 
 reply::reply(const std::vector<reply>& rows)
-: m_eType(type::array)
-, m_vctRows(rows) {}
+: m_eType(type::array) {
+  new (&m_vctRows) std::vector<reply>(rows);
+}
+
+reply::reply(std::vector<reply>&& rows)
+: m_eType(type::array) {
+  new (&m_vctRows) std::vector<reply>(std::move(rows));
+}
+
+reply::~reply(void) {
+  destroy();
+}
+
+reply::reply(const reply& other)
+: m_eType(type::null) {
+  construct_from(other);
+}
+
+reply&
+reply::operator=(const reply& other) {
+  //! other may be one of our rows: copy it before releasing the current value
+  if (this != &other)
+    *this = reply(other);
+
+  return *this;
+}
+
+reply::reply(reply&& other) noexcept
+: m_eType(type::null) {
+  construct_from(std::move(other));
+}
+
+reply&
+reply::operator=(reply&& other) noexcept {
+  if (this == &other)
+    return *this;
+
+  if (is_array()) {
+    //! other may be one of our rows: take it before releasing the current value
+    reply tmp(std::move(other));
+    destroy();
+    construct_from(std::move(tmp));
+  } else {
+    destroy();
+    construct_from(std::move(other));
+  }
+
+  return *this;
+}
+
+void
+reply::destroy(void) noexcept {
+  switch (m_eType) {
+  case type::array:
+    m_vctRows.~vector();
+    break;
+  case type::error:
+  case type::bulk_string:
+  case type::simple_string:
+    m_sValue.~basic_string();
+    break;
+  default:
+    break;
+  }
+
+  m_eType  = type::null;
+  m_nValue = 0;
+}
+
+void
+reply::become_array(void) {
+  if (is_array())
+    return;
+
+  destroy();
+  new (&m_vctRows) std::vector<reply>;
+  m_eType = type::array;
+}
+
+void
+reply::construct_from(const reply& other) {
+  switch (other.m_eType) {
+  case type::array:
+    new (&m_vctRows) std::vector<reply>(other.m_vctRows);
+    break;
+  case type::error:
+  case type::bulk_string:
+  case type::simple_string:
+    new (&m_sValue) std::string(other.m_sValue);
+    break;
+  default:
+    m_nValue = other.m_nValue;
+    break;
+  }
+
+  m_eType = other.m_eType;
+}
+
+void
+reply::construct_from(reply&& other) noexcept {
+  switch (other.m_eType) {
+  case type::array:
+    new (&m_vctRows) std::vector<reply>(std::move(other.m_vctRows));
+    break;
+  case type::error:
+  case type::bulk_string:
+  case type::simple_string:
+    new (&m_sValue) std::string(std::move(other.m_sValue));
+    break;
+  default:
+    m_nValue = other.m_nValue;
+    break;
+  }
+
+  m_eType = other.m_eType;
+  other.destroy();
+}
 
 bool
 reply::ok(void) const {
@@ -52,10 +176,11 @@ reply::ko(void) const {
 
 const std::string&
 reply::error(void) const {
-  if (!is_error())
+  const std::string* ptrError = try_error();
+  if (!ptrError)
     throw cpp_redis::redis_error("Reply is not an error");
 
-  return as_string();
+  return *ptrError;
 }
 
 reply::operator bool() const {
@@ -64,35 +189,65 @@ reply::operator bool() const {
 
 void
 reply::set(void) {
-  m_eType = type::null;
+  destroy();
 }
 
 void
 reply::set(const std::string& value, string_type reply_type) {
-  m_eType   = static_cast<type>(reply_type);
+  if (!is_string()) {
+    //! value may belong to one of our rows
+    *this = reply(value, reply_type);
+    return;
+  }
+
+  m_eType  = static_cast<type>(reply_type);
   m_sValue = value;
 }
 
+void
+reply::set(std::string&& value, string_type reply_type) {
+  if (!is_string()) {
+    *this = reply(std::move(value), reply_type);
+    return;
+  }
+
+  m_eType  = static_cast<type>(reply_type);
+  m_sValue = std::move(value);
+}
+
 void
 reply::set(int64_t value) {
-  m_eType   = type::integer;
+  destroy();
+  m_eType  = type::integer;
   m_nValue = value;
 }
 
 void
 reply::set(const std::vector<reply>& rows) {
-  m_eType = type::array;
-  m_vctRows = rows;
+  *this = reply(rows);
+}
+
+void
+reply::set(std::vector<reply>&& rows) {
+  *this = reply(std::move(rows));
 }
 
 reply&
 reply::operator<<(const reply& reply) {
-  m_eType = type::array;
+  become_array();
   m_vctRows.push_back(reply);
 
   return *this;
 }
 
+reply&
+reply::operator<<(reply&& reply) {
+  become_array();
+  m_vctRows.push_back(std::move(reply));
+
+  return *this;
+}
+
 bool
 reply::is_array(void) const {
   return m_eType == type::array;
@@ -130,26 +285,49 @@ reply::is_null(void) const {
 
 const std::vector<reply>&
 reply::as_array(void) const {
-  if (!is_array())
+  const std::vector<reply>* ptrRows = try_as_array();
+  if (!ptrRows)
     throw cpp_redis::redis_error("Reply is not an array");
 
-  return m_vctRows;
+  return *ptrRows;
 }
 
 const std::string&
 reply::as_string(void) const {
-  if (!is_string())
+  const std::string* ptrValue = try_as_string();
+  if (!ptrValue)
     throw cpp_redis::redis_error("Reply is not a string");
 
-  return m_sValue;
+  return *ptrValue;
 }
 
 int64_t
 reply::as_integer(void) const {
-  if (!is_integer())
+  const int64_t* ptrValue = try_as_integer();
+  if (!ptrValue)
     throw cpp_redis::redis_error("Reply is not an integer");
 
-  return m_nValue;
+  return *ptrValue;
+}
+
+const std::string*
+reply::try_error(void) const noexcept {
+  return is_error() ? &m_sValue : nullptr;
+}
+
+const std::vector<reply>*
+reply::try_as_array(void) const noexcept {
+  return is_array() ? &m_vctRows : nullptr;
+}
+
+const std::string*
+reply::try_as_string(void) const noexcept {
+  return is_string() ? &m_sValue : nullptr;
+}
+
+const int64_t*
+reply::try_as_integer(void) const noexcept {
+  return is_integer() ? &m_nValue : nullptr;
 }
 
 reply::type
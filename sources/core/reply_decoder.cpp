@@ -0,0 +1,91 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/reply_decoder.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/scan.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace cpp_redis {
+
+namespace decoding {
+
+int64_t
+to_integer(const reply_view& reply) {
+  if (reply.is_integer())
+    return reply.as_integer();
+
+  if (!reply.is_bulk_string() && !reply.is_simple_string())
+    throw redis_error("Reply is not an integer");
+
+  string_ref str = reply.as_string();
+  int64_t nValue = 0;
+
+  if (!scan::parse_integer(str.data(), str.data() + str.size(), nValue))
+    throw redis_error("Reply is not an integer");
+
+  return nValue;
+}
+
+double
+to_double(const reply_view& reply) {
+  if (reply.is_integer())
+    return static_cast<double>(reply.as_integer());
+
+  if (!reply.is_bulk_string() && !reply.is_simple_string())
+    throw redis_error("Reply is not a number");
+
+  //! strtod requires a null-terminated string: scores are short, copy them on the stack
+  string_ref str = reply.as_string();
+  char buffer[64];
+
+  if (str.empty() || str.size() >= sizeof(buffer))
+    throw redis_error("Reply is not a number");
+
+  std::copy(str.begin(), str.end(), buffer);
+  buffer[str.size()] = '\0';
+
+  char* pEnd    = nullptr;
+  double dValue = std::strtod(buffer, &pEnd);
+
+  if (pEnd != buffer + str.size())
+    throw redis_error("Reply is not a number");
+
+  return dValue;
+}
+
+} // namespace decoding
+
+void
+reply_decoder<std::string>::decode(const reply_view& reply, std::string& value) {
+  string_ref str = reply.as_string();
+  value.assign(str.data(), str.size());
+}
+
+void
+reply_decoder<reply>::decode(const reply_view& reply, cpp_redis::reply& value) {
+  value = reply.to_reply();
+}
+
+} // namespace cpp_redis
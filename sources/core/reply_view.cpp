@@ -0,0 +1,327 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/reply_view.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/scan.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace cpp_redis {
+
+//!
+//! \param data first byte after the type of a header line
+//! \param end end of the data
+//! \return position of the end sequence of the line (simple strings, errors and integers cannot contain '\r')
+//!
+static const char*
+find_line_end(const char* pData, const char* pEnd) {
+  if (pData >= pEnd)
+    return pEnd;
+
+  const char* pLineEnd = static_cast<const char*>(std::memchr(pData, '\r', static_cast<std::size_t>(pEnd - pData)));
+
+  return pLineEnd ? pLineEnd : pEnd;
+}
+
+//!
+//! \param begin first character of the integer
+//! \param end end sequence following the integer
+//! \return converted integer (the data has already been validated by the parser)
+//!
+static int64_t
+parse_integer(const char* pBegin, const char* pEnd) {
+  int64_t nValue = 0;
+  scan::parse_integer(pBegin, pEnd, nValue);
+
+  return nValue;
+}
+
+reply_view::const_iterator::const_iterator(void)
+: m_pData(nullptr)
+, m_pEnd(nullptr)
+, m_uRemaining(0) {}
+
+reply_view::const_iterator::const_iterator(const char* pData, const char* pEnd, std::size_t uRemaining)
+: m_pData(uRemaining ? pData : nullptr)
+, m_pEnd(pEnd)
+, m_uRemaining(uRemaining) {}
+
+reply_view
+reply_view::const_iterator::operator*(void) const {
+  return reply_view(m_pData, static_cast<std::size_t>(m_pEnd - m_pData));
+}
+
+reply_view::const_iterator&
+reply_view::const_iterator::operator++(void) {
+  if (--m_uRemaining)
+    m_pData = reply_view::skip(m_pData, m_pEnd);
+  else
+    m_pData = nullptr;
+
+  return *this;
+}
+
+reply_view::const_iterator
+reply_view::const_iterator::operator++(int) {
+  const_iterator it = *this;
+  ++*this;
+
+  return it;
+}
+
+bool
+reply_view::const_iterator::operator==(const const_iterator& other) const {
+  return m_uRemaining == other.m_uRemaining && m_pData == other.m_pData;
+}
+
+bool
+reply_view::const_iterator::operator!=(const const_iterator& other) const {
+  return !(*this == other);
+}
+
+reply_view::reply_view(void)
+: m_eType(type::null)
+, m_pData(nullptr)
+, m_pEnd(nullptr)
+, m_uSize(0)
+, m_nValue(0) {}
+
+reply_view::reply_view(const char* pData, std::size_t uSize)
+: reply_view() {
+  if (!uSize)
+    return;
+
+  m_pEnd = pData + uSize;
+
+  const char* pLineEnd = find_line_end(pData + 1, m_pEnd);
+
+  switch (*pData) {
+  case '+':
+  case '-':
+    m_eType = *pData == '+' ? type::simple_string : type::error;
+    m_pData = pData + 1;
+    m_uSize = static_cast<std::size_t>(pLineEnd - m_pData);
+    break;
+  case ':':
+    m_eType  = type::integer;
+    m_nValue = parse_integer(pData + 1, pLineEnd);
+    break;
+  case '$':
+  case '*': {
+    int64_t nSize = parse_integer(pData + 1, pLineEnd);
+    if (nSize < 0)
+      break;
+
+    m_eType = *pData == '$' ? type::bulk_string : type::array;
+    m_pData = pLineEnd + 2;
+    m_uSize = static_cast<std::size_t>(nSize);
+    break;
+  }
+  default:
+    throw redis_error("Invalid data");
+  }
+}
+
+const char*
+reply_view::skip(const char* pData, const char* pEnd) {
+  std::size_t uRemaining = 1;
+
+  while (uRemaining && pData < pEnd) {
+    --uRemaining;
+
+    char cType           = *pData;
+    const char* pLineEnd = find_line_end(pData + 1, pEnd);
+    int64_t nSize        = (cType == '$' || cType == '*') ? parse_integer(pData + 1, pLineEnd) : 0;
+
+    pData = pLineEnd + 2;
+
+    if (cType == '$' && nSize >= 0)
+      pData += nSize + 2;
+    else if (cType == '*' && nSize > 0)
+      uRemaining += static_cast<std::size_t>(nSize);
+  }
+
+  return pData < pEnd ? pData : pEnd;
+}
+
+bool
+reply_view::ok(void) const {
+  return !is_error();
+}
+
+bool
+reply_view::ko(void) const {
+  return !ok();
+}
+
+reply_view::operator bool() const {
+  return !is_error() && !is_null();
+}
+
+bool
+reply_view::is_array(void) const {
+  return m_eType == type::array;
+}
+
+bool
+reply_view::is_string(void) const {
+  return is_simple_string() || is_bulk_string() || is_error();
+}
+
+bool
+reply_view::is_simple_string(void) const {
+  return m_eType == type::simple_string;
+}
+
+bool
+reply_view::is_bulk_string(void) const {
+  return m_eType == type::bulk_string;
+}
+
+bool
+reply_view::is_error(void) const {
+  return m_eType == type::error;
+}
+
+bool
+reply_view::is_integer(void) const {
+  return m_eType == type::integer;
+}
+
+bool
+reply_view::is_null(void) const {
+  return m_eType == type::null;
+}
+
+string_ref
+reply_view::error(void) const {
+  if (!is_error())
+    throw cpp_redis::redis_error("Reply is not an error");
+
+  return as_string();
+}
+
+string_ref
+reply_view::as_string(void) const {
+  if (!is_string())
+    throw cpp_redis::redis_error("Reply is not a string");
+
+  return string_ref(m_pData, m_uSize);
+}
+
+int64_t
+reply_view::as_integer(void) const {
+  if (!is_integer())
+    throw cpp_redis::redis_error("Reply is not an integer");
+
+  return m_nValue;
+}
+
+std::size_t
+reply_view::size(void) const {
+  if (!is_array())
+    throw cpp_redis::redis_error("Reply is not an array");
+
+  return m_uSize;
+}
+
+reply_view
+reply_view::operator[](std::size_t uIndex) const {
+  if (uIndex >= size())
+    throw cpp_redis::redis_error("Reply index out of range");
+
+  const char* pData = m_pData;
+  for (std::size_t i = 0; i < uIndex; ++i)
+    pData = skip(pData, m_pEnd);
+
+  return reply_view(pData, static_cast<std::size_t>(m_pEnd - pData));
+}
+
+reply_view::const_iterator
+reply_view::begin(void) const {
+  return const_iterator(m_pData, m_pEnd, size());
+}
+
+reply_view::const_iterator
+reply_view::end(void) const {
+  if (!is_array())
+    throw cpp_redis::redis_error("Reply is not an array");
+
+  return const_iterator();
+}
+
+reply
+reply_view::to_reply(void) const {
+  switch (m_eType) {
+  case type::error:
+  case type::bulk_string:
+  case type::simple_string:
+    return reply(std::string(m_pData, m_uSize), static_cast<reply::string_type>(m_eType));
+  case type::integer:
+    return reply(m_nValue);
+  case type::array: {
+    std::vector<reply> vctRows;
+    vctRows.reserve(m_uSize);
+
+    for (const auto& element : *this)
+      vctRows.push_back(element.to_reply());
+
+    return reply(std::move(vctRows));
+  }
+  default:
+    return reply();
+  }
+}
+
+reply_view::type
+reply_view::get_type(void) const {
+  return m_eType;
+}
+
+} // namespace cpp_redis
+
+std::ostream&
+operator<<(std::ostream& os, const cpp_redis::reply_view& reply) {
+  switch (reply.get_type()) {
+  case cpp_redis::reply_view::type::error:
+    os << reply.error();
+    break;
+  case cpp_redis::reply_view::type::bulk_string:
+  case cpp_redis::reply_view::type::simple_string:
+    os << reply.as_string();
+    break;
+  case cpp_redis::reply_view::type::null:
+    os << std::string("(nil)");
+    break;
+  case cpp_redis::reply_view::type::integer:
+    os << reply.as_integer();
+    break;
+  case cpp_redis::reply_view::type::array:
+    for (const auto& item : reply)
+      os << item;
+    break;
+  }
+
+  return os;
+}
@@ -25,6 +25,8 @@
 #include <cpp_redis/misc/logger.hpp>
 #include <cpp_redis/network/redis_connection.hpp>
 
+#include <cstdlib>
+
 namespace cpp_redis {
 
 #ifndef __CPP_REDIS_USE_CUSTOM_TCP_CLIENT
@@ -92,11 +94,18 @@ sentinel::get_master_addr_by_name(const std::string& sSentinelName, std::string&
   //! By now we have a connection to a redis sentinel.
   //! Ask it who the master is.
   send({"SENTINEL", "get-master-addr-by-name", sSentinelName}, [&](cpp_redis::reply& reply) {
-    if (reply.is_array()) {
-      auto arr  = reply.as_array();
-      sHost     = arr[0].as_string();
-      nPort     = std::stoi(arr[1].as_string(), nullptr, 10);
-    }
+    //! a null reply is returned for unknown masters
+    const auto* arr = reply.try_as_array();
+    if (!arr || arr->size() < 2)
+      return;
+
+    const auto* host = (*arr)[0].try_as_string();
+    const auto* port = (*arr)[1].try_as_string();
+    if (!host || !port)
+      return;
+
+    sHost = *host;
+    nPort = std::strtoul(port->c_str(), nullptr, 10);
   });
   sync_commit();
 
@@ -170,7 +179,7 @@ sentinel::connect(const std::string& sHost, std::size_t nPort,
 
 void
 sentinel::connection_receive_handler(network::redis_connection&, reply& reply) {
-  reply_callback_t callback = nullptr;
+  stored_reply_callback_t callback;
 
   __CPP_REDIS_LOG(info, "cpp_redis::sentinel received reply");
   {
@@ -178,7 +187,7 @@ sentinel::connection_receive_handler(network::redis_connection&, reply& reply) {
     m_nRunningCallbacks_a += 1;
 
     if (m_queCallbacks.size()) {
-      callback = m_queCallbacks.front();
+      callback = std::move(m_queCallbacks.front());
       m_queCallbacks.pop();
     }
   }
@@ -199,7 +208,7 @@ void
 sentinel::clear_callbacks(void) {
   std::lock_guard<std::mutex> lock(m_mtxCallbacks);
 
-  std::queue<reply_callback_t> empty;
+  std::queue<stored_reply_callback_t> empty;
   std::swap(m_queCallbacks, empty);
 
   m_cvSync.notify_all();
@@ -181,16 +181,15 @@ subscriber::subscribe(const std::string& channel, const subscribe_callback_t& ca
   std::lock_guard<std::mutex> lock(m_subscribed_channels_mutex);
 
   __CPP_REDIS_LOG(debug, "cpp_redis::subscriber attemps to subscribe to channel " + channel);
-  unprotected_subscribe(channel, callback, acknowledgement_callback);
+  unprotected_subscribe(channel, {callback, acknowledgement_callback});
   __CPP_REDIS_LOG(info, "cpp_redis::subscriber subscribed to channel " + channel);
 
   return *this;
 }
 
 void
-subscriber::unprotected_subscribe(const std::string& channel, const subscribe_callback_t& callback,
-    const acknowledgement_callback_t& acknowledgement_callback) {
-  m_subscribed_channels[channel] = {callback, acknowledgement_callback};
+subscriber::unprotected_subscribe(const std::string& channel, callback_holder&& callbacks) {
+  m_subscribed_channels[channel] = std::move(callbacks);
   m_client.send({"SUBSCRIBE", channel});
 }
 
@@ -200,16 +199,15 @@ subscriber::psubscribe(const std::string& pattern, const subscribe_callback_t& c
   std::lock_guard<std::mutex> lock(m_psubscribed_channels_mutex);
 
   __CPP_REDIS_LOG(debug, "cpp_redis::subscriber attemps to psubscribe to channel " + pattern);
-  unprotected_psubscribe(pattern, callback, acknowledgement_callback);
+  unprotected_psubscribe(pattern, {callback, acknowledgement_callback});
   __CPP_REDIS_LOG(info, "cpp_redis::subscriber psubscribed to channel " + pattern);
 
   return *this;
 }
 
 void
-subscriber::unprotected_psubscribe(const std::string& pattern, const subscribe_callback_t& callback,
-    const acknowledgement_callback_t& acknowledgement_callback) {
-  m_psubscribed_channels[pattern] = {callback, acknowledgement_callback};
+subscriber::unprotected_psubscribe(const std::string& pattern, callback_holder&& callbacks) {
+  m_psubscribed_channels[pattern] = std::move(callbacks);
   m_client.send({"PSUBSCRIBE", pattern});
 }
 
@@ -284,21 +282,19 @@ subscriber::handle_acknowledgement_reply(const std::vector<reply>& reply) {
   if (reply.size() != 3)
     return;
 
-  const auto& title    = reply[0];
-  const auto& channel  = reply[1];
-  const auto& nb_chans = reply[2];
+  const auto* title    = reply[0].try_as_string();
+  const auto* channel  = reply[1].try_as_string();
+  const auto* nb_chans = reply[2].try_as_integer();
 
-  if (!title.is_string()
-      || !channel.is_string()
-      || !nb_chans.is_integer())
+  if (!title
+      || !channel
+      || !nb_chans)
     return;
 
-  if (title.as_string() == "subscribe")
-    call_acknowledgement_callback(channel.as_string(), m_subscribed_channels, m_subscribed_channels_mutex,
-        nb_chans.as_integer());
-  else if (title.as_string() == "psubscribe")
-    call_acknowledgement_callback(channel.as_string(), m_psubscribed_channels, m_psubscribed_channels_mutex,
-        nb_chans.as_integer());
+  if (*title == "subscribe")
+    call_acknowledgement_callback(*channel, m_subscribed_channels, m_subscribed_channels_mutex, *nb_chans);
+  else if (*title == "psubscribe")
+    call_acknowledgement_callback(*channel, m_psubscribed_channels, m_psubscribed_channels_mutex, *nb_chans);
 }
 
 void
@@ -306,26 +302,26 @@ subscriber::handle_subscribe_reply(const std::vector<reply>& reply) {
   if (reply.size() != 3)
     return;
 
-  const auto& title   = reply[0];
-  const auto& channel = reply[1];
-  const auto& message = reply[2];
+  const auto* title   = reply[0].try_as_string();
+  const auto* channel = reply[1].try_as_string();
+  const auto* message = reply[2].try_as_string();
 
-  if (!title.is_string()
-      || !channel.is_string()
-      || !message.is_string())
+  if (!title
+      || !channel
+      || !message)
     return;
 
-  if (title.as_string() != "message")
+  if (*title != "message")
     return;
 
   std::lock_guard<std::mutex> lock(m_subscribed_channels_mutex);
 
-  auto it = m_subscribed_channels.find(channel.as_string());
+  auto it = m_subscribed_channels.find(*channel);
   if (it == m_subscribed_channels.end())
     return;
 
-  __CPP_REDIS_LOG(debug, "cpp_redis::subscriber executes subscribe callback for channel " + channel.as_string());
-  it->second.subscribe_callback(channel.as_string(), message.as_string());
+  __CPP_REDIS_LOG(debug, "cpp_redis::subscriber executes subscribe callback for channel " + *channel);
+  it->second.subscribe_callback(*channel, *message);
 }
 
 void
@@ -333,28 +329,28 @@ subscriber::handle_psubscribe_reply(const std::vector<reply>& reply) {
   if (reply.size() != 4)
     return;
 
-  const auto& title    = reply[0];
-  const auto& pchannel = reply[1];
-  const auto& channel  = reply[2];
-  const auto& message  = reply[3];
+  const auto* title    = reply[0].try_as_string();
+  const auto* pchannel = reply[1].try_as_string();
+  const auto* channel  = reply[2].try_as_string();
+  const auto* message  = reply[3].try_as_string();
 
-  if (!title.is_string()
-      || !pchannel.is_string()
-      || !channel.is_string()
-      || !message.is_string())
+  if (!title
+      || !pchannel
+      || !channel
+      || !message)
     return;
 
-  if (title.as_string() != "pmessage")
+  if (*title != "pmessage")
     return;
 
   std::lock_guard<std::mutex> lock(m_psubscribed_channels_mutex);
 
-  auto it = m_psubscribed_channels.find(pchannel.as_string());
+  auto it = m_psubscribed_channels.find(*pchannel);
   if (it == m_psubscribed_channels.end())
     return;
 
-  __CPP_REDIS_LOG(debug, "cpp_redis::subscriber executes psubscribe callback for channel " + channel.as_string());
-  it->second.subscribe_callback(channel.as_string(), message.as_string());
+  __CPP_REDIS_LOG(debug, "cpp_redis::subscriber executes psubscribe callback for channel " + *channel);
+  it->second.subscribe_callback(*channel, *message);
 }
 
 void
@@ -364,7 +360,8 @@ subscriber::connection_receive_handler(network::redis_connection&, reply& reply)
   //! always return an array
   //! otherwise, if auth was defined, this should be the AUTH reply
   //! any other replies from the server are considered as unexepected
-  if (!reply.is_array()) {
+  const auto* array = reply.try_as_array();
+  if (!array) {
     if (m_auth_reply_callback) {
       __CPP_REDIS_LOG(debug, "cpp_redis::subscriber executes auth callback");
 
@@ -375,18 +372,16 @@ subscriber::connection_receive_handler(network::redis_connection&, reply& reply)
     return;
   }
 
-  auto& array = reply.as_array();
-
   //! Array size of 3 -> SUBSCRIBE if array[2] is a string
   //! Array size of 3 -> AKNOWLEDGEMENT if array[2] is an integer
   //! Array size of 4 -> PSUBSCRIBE
   //! Otherwise -> unexpected reply
-  if (array.size() == 3 && array[2].is_integer())
-    handle_acknowledgement_reply(array);
-  else if (array.size() == 3 && array[2].is_string())
-    handle_subscribe_reply(array);
-  else if (array.size() == 4)
-    handle_psubscribe_reply(array);
+  if (array->size() == 3 && (*array)[2].is_integer())
+    handle_acknowledgement_reply(*array);
+  else if (array->size() == 3 && (*array)[2].is_string())
+    handle_subscribe_reply(*array);
+  else if (array->size() == 4)
+    handle_psubscribe_reply(*array);
 }
 
 void
@@ -497,13 +492,13 @@ subscriber::reconnect(void) {
 void
 subscriber::re_subscribe(void) {
   std::map<std::string, callback_holder> sub_chans = std::move(m_subscribed_channels);
-  for (const auto& chan : sub_chans) {
-    unprotected_subscribe(chan.first, chan.second.subscribe_callback, chan.second.acknowledgement_callback);
+  for (auto& chan : sub_chans) {
+    unprotected_subscribe(chan.first, std::move(chan.second));
   }
 
   std::map<std::string, callback_holder> psub_chans = std::move(m_psubscribed_channels);
-  for (const auto& chan : psub_chans) {
-    unprotected_psubscribe(chan.first, chan.second.subscribe_callback, chan.second.acknowledgement_callback);
+  for (auto& chan : psub_chans) {
+    unprotected_psubscribe(chan.first, std::move(chan.second));
   }
 }
 
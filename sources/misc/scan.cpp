@@ -0,0 +1,306 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/misc/scan.hpp>
+
+#include <cstring>
+#include <limits>
+
+#if !defined(__CPP_REDIS_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define __CPP_REDIS_SCAN_SSE2
+#include <emmintrin.h>
+
+//! AVX2 is compiled per function (target attribute) and only used if the cpu supports it
+#if defined(_MSC_VER) || defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define __CPP_REDIS_SCAN_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define __CPP_REDIS_TARGET_AVX2
+#else /* _MSC_VER */
+#define __CPP_REDIS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif /* _MSC_VER */
+#endif /* _MSC_VER || __clang__ || __GNUC__ >= 4.9 */
+#endif /* !__CPP_REDIS_DISABLE_SIMD && SSE2 */
+
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define __CPP_REDIS_SCAN_LITTLE_ENDIAN
+#endif /* _WIN32 || __ORDER_LITTLE_ENDIAN__ */
+
+namespace cpp_redis {
+
+namespace scan {
+
+static const char*
+find_crlf_scalar(const char* pBegin, const char* pEnd) {
+  while (pBegin < pEnd) {
+    const char* pCr = static_cast<const char*>(std::memchr(pBegin, '\r', static_cast<std::size_t>(pEnd - pBegin)));
+    if (!pCr || pCr + 1 == pEnd)
+      return pEnd;
+
+    if (pCr[1] == '\n')
+      return pCr;
+
+    pBegin = pCr + 1;
+  }
+
+  return pEnd;
+}
+
+#ifdef __CPP_REDIS_SCAN_SSE2
+//!
+//! compare 16 bytes with '\r' and the 16 following ones (shifted by one) with '\n':
+//! a bit set in both masks is an end sequence
+//!
+static const char*
+find_crlf_sse2(const char* pBegin, const char* pEnd) {
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+
+  for (; pEnd - pBegin >= 17; pBegin += 16) {
+    __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBegin));
+    __m128i next    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBegin + 1));
+    unsigned int uMask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(current, cr)))
+                       & static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(next, lf)));
+
+    if (uMask) {
+      unsigned int uIndex = 0;
+      while (!(uMask & 1)) {
+        uMask >>= 1;
+        ++uIndex;
+      }
+
+      return pBegin + uIndex;
+    }
+  }
+
+  return find_crlf_scalar(pBegin, pEnd);
+}
+#endif /* __CPP_REDIS_SCAN_SSE2 */
+
+#ifdef __CPP_REDIS_SCAN_AVX2
+//!
+//! same as find_crlf_sse2, 32 bytes at a time
+//!
+__CPP_REDIS_TARGET_AVX2 static const char*
+find_crlf_avx2(const char* pBegin, const char* pEnd) {
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+
+  for (; pEnd - pBegin >= 33; pBegin += 32) {
+    __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pBegin));
+    __m256i next    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pBegin + 1));
+    unsigned int uMask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(current, cr)))
+                       & static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(next, lf)));
+
+    if (uMask) {
+      unsigned int uIndex = 0;
+      while (!(uMask & 1)) {
+        uMask >>= 1;
+        ++uIndex;
+      }
+
+      return pBegin + uIndex;
+    }
+  }
+
+  return find_crlf_sse2(pBegin, pEnd);
+}
+
+//!
+//! \return whether the cpu and the operating system support AVX2
+//!
+static bool
+cpu_supports_avx2(void) {
+#ifdef _MSC_VER
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7)
+    return false;
+
+  //! OSXSAVE and AVX, then YMM state enabled by the OS, then AVX2
+  __cpuid(info, 1);
+  if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+    return false;
+  if ((_xgetbv(0) & 6) != 6)
+    return false;
+
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else  /* _MSC_VER */
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+#endif /* _MSC_VER */
+}
+#endif /* __CPP_REDIS_SCAN_AVX2 */
+
+static isa
+detect_isa(void) {
+#if defined(__CPP_REDIS_SCAN_AVX2)
+  return cpu_supports_avx2() ? isa::avx2 : isa::sse2;
+#elif defined(__CPP_REDIS_SCAN_SSE2)
+  return isa::sse2;
+#else
+  return isa::scalar;
+#endif /* __CPP_REDIS_SCAN_AVX2 */
+}
+
+isa
+best_isa(void) {
+  static const isa level = detect_isa();
+
+  return level;
+}
+
+const char*
+find_crlf(const char* pBegin, const char* pEnd, isa level) {
+  switch (level) {
+#ifdef __CPP_REDIS_SCAN_AVX2
+  case isa::avx2:
+    if (best_isa() == isa::avx2)
+      return find_crlf_avx2(pBegin, pEnd);
+    return find_crlf_sse2(pBegin, pEnd);
+#endif /* __CPP_REDIS_SCAN_AVX2 */
+#ifdef __CPP_REDIS_SCAN_SSE2
+  case isa::sse2:
+    return find_crlf_sse2(pBegin, pEnd);
+#endif /* __CPP_REDIS_SCAN_SSE2 */
+  default:
+    return find_crlf_scalar(pBegin, pEnd);
+  }
+}
+
+const char*
+find_crlf(const char* pBegin, const char* pEnd) {
+  typedef const char* (*find_crlf_t)(const char*, const char*);
+
+  //! resolved once: the next calls only go through the function pointer
+  static const find_crlf_t fnFindCrlf =
+#if defined(__CPP_REDIS_SCAN_AVX2)
+    best_isa() == isa::avx2 ? find_crlf_avx2 : find_crlf_sse2;
+#elif defined(__CPP_REDIS_SCAN_SSE2)
+    find_crlf_sse2;
+#else
+    find_crlf_scalar;
+#endif /* __CPP_REDIS_SCAN_AVX2 */
+
+  return fnFindCrlf(pBegin, pEnd);
+}
+
+#ifdef __CPP_REDIS_SCAN_LITTLE_ENDIAN
+//!
+//! convert up to 8 digits at once (SWAR)
+//! the digits are right-aligned in a block padded with '0', so that the block always holds 8 digits
+//!
+//! \param begin first digit
+//! \param size number of digits (1 to 8)
+//! \param value converted digits
+//! \return whether every character is a digit
+//!
+static bool
+parse_digits(const char* pBegin, std::size_t uSize, uint64_t& uValue) {
+  char block[8];
+  std::memset(block, '0', sizeof(block));
+  std::memcpy(block + sizeof(block) - uSize, pBegin, uSize);
+
+  uint64_t uBlock;
+  std::memcpy(&uBlock, block, sizeof(uBlock));
+
+  //! every byte must be in ['0', '9']: high nibble 3, and adding 6 must not carry into the high nibble
+  if (((uBlock & 0xF0F0F0F0F0F0F0F0ULL) | (((uBlock + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+      != 0x3333333333333333ULL)
+    return false;
+
+  //! first digit is in the lowest byte: combine pairs of digits, then pairs of pairs, then pairs of quads
+  uBlock -= 0x3030303030303030ULL;
+  uBlock = (uBlock * 10 + (uBlock >> 8)) & 0x00FF00FF00FF00FFULL;
+  uBlock = (uBlock * 100 + (uBlock >> 16)) & 0x0000FFFF0000FFFFULL;
+  uBlock = (uBlock * 10000 + (uBlock >> 32)) & 0x00000000FFFFFFFFULL;
+
+  uValue = uBlock;
+
+  return true;
+}
+#else  /* __CPP_REDIS_SCAN_LITTLE_ENDIAN */
+static bool
+parse_digits(const char* pBegin, std::size_t uSize, uint64_t& uValue) {
+  uValue = 0;
+
+  for (const char* p = pBegin; p < pBegin + uSize; ++p) {
+    if (*p < '0' || *p > '9')
+      return false;
+
+    uValue = uValue * 10 + static_cast<uint64_t>(*p - '0');
+  }
+
+  return true;
+}
+#endif /* __CPP_REDIS_SCAN_LITTLE_ENDIAN */
+
+bool
+parse_integer(const char* pBegin, const char* pEnd, int64_t& nValue) {
+  bool bNegative = pBegin < pEnd && *pBegin == '-';
+  if (bNegative)
+    ++pBegin;
+
+  if (pBegin >= pEnd)
+    return false;
+
+  //! leading zeros do not count in the number of digits
+  while (pBegin + 1 < pEnd && *pBegin == '0')
+    ++pBegin;
+
+  //! 19 digits always fit in a uint64_t: longer integers can only overflow an int64_t
+  std::size_t uSize = static_cast<std::size_t>(pEnd - pBegin);
+  if (uSize > 19)
+    return false;
+
+  //! leading block holds the remainder, following blocks hold 8 digits each
+  std::size_t uBlock = uSize % 8 ? uSize % 8 : 8;
+  uint64_t uValue    = 0;
+
+  while (pBegin < pEnd) {
+    uint64_t uDigits;
+    if (!parse_digits(pBegin, uBlock, uDigits))
+      return false;
+
+    uValue = uValue * 100000000ULL + uDigits;
+    pBegin += uBlock;
+    uBlock = 8;
+  }
+
+  //! the magnitude of INT64_MIN is one more than INT64_MAX
+  uint64_t uMax = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  if (uValue > uMax + (bNegative ? 1 : 0))
+    return false;
+
+  if (bNegative)
+    nValue = uValue > uMax ? std::numeric_limits<int64_t>::min() : -static_cast<int64_t>(uValue);
+  else
+    nValue = static_cast<int64_t>(uValue);
+
+  return true;
+}
+
+} // namespace scan
+
+} // namespace cpp_redis
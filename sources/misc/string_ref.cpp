@@ -0,0 +1,95 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/misc/string_ref.hpp>
+
+#include <cstring>
+
+namespace cpp_redis {
+
+string_ref::string_ref(void)
+: m_pData("")
+, m_uSize(0) {}
+
+string_ref::string_ref(const char* pData, std::size_t uSize)
+: m_pData(pData)
+, m_uSize(uSize) {}
+
+string_ref::string_ref(const char* str)
+: m_pData(str)
+, m_uSize(std::strlen(str)) {}
+
+string_ref::string_ref(const std::string& str)
+: m_pData(str.data())
+, m_uSize(str.size()) {}
+
+const char*
+string_ref::data(void) const {
+  return m_pData;
+}
+
+std::size_t
+string_ref::size(void) const {
+  return m_uSize;
+}
+
+bool
+string_ref::empty(void) const {
+  return m_uSize == 0;
+}
+
+const char*
+string_ref::begin(void) const {
+  return m_pData;
+}
+
+const char*
+string_ref::end(void) const {
+  return m_pData + m_uSize;
+}
+
+char
+string_ref::operator[](std::size_t uIndex) const {
+  return m_pData[uIndex];
+}
+
+std::string
+string_ref::to_string(void) const {
+  return std::string(m_pData, m_uSize);
+}
+
+bool
+operator==(const string_ref& lhs, const string_ref& rhs) {
+  return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+bool
+operator!=(const string_ref& lhs, const string_ref& rhs) {
+  return !(lhs == rhs);
+}
+
+} // namespace cpp_redis
+
+std::ostream&
+operator<<(std::ostream& os, const cpp_redis::string_ref& str) {
+  return os.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
@@ -0,0 +1,310 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/network/command_encoder.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+namespace cpp_redis {
+
+namespace network {
+
+//! largest array header: "*", 20 digits and the end sequence
+static const std::size_t max_header_size = 1 + 20 + 2;
+
+//!
+//! write the decimal representation of value, two digits at a time from a lookup table, ending at the given position
+//!
+//! \param end position following the last digit
+//! \param value value to be written
+//! \return position of the first digit
+//!
+static char*
+write_digits(char* pEnd, std::uint64_t uValue) {
+  static const char szDigitsPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+  char* pPos = pEnd;
+
+  while (uValue >= 100) {
+    std::size_t uPair = static_cast<std::size_t>(uValue % 100) * 2;
+    uValue /= 100;
+    *--pPos = szDigitsPairs[uPair + 1];
+    *--pPos = szDigitsPairs[uPair];
+  }
+
+  if (uValue >= 10) {
+    *--pPos = szDigitsPairs[uValue * 2 + 1];
+    *--pPos = szDigitsPairs[uValue * 2];
+  } else {
+    *--pPos = static_cast<char>('0' + uValue);
+  }
+
+  return pPos;
+}
+
+std::size_t
+command_encoder::digits_count(std::size_t uValue) {
+  std::size_t uCount = 1;
+
+  //! four digits per step for large values
+  for (;;) {
+    if (uValue < 10)
+      return uCount;
+    if (uValue < 100)
+      return uCount + 1;
+    if (uValue < 1000)
+      return uCount + 2;
+    if (uValue < 10000)
+      return uCount + 3;
+
+    uValue /= 10000;
+    uCount += 4;
+  }
+}
+
+char*
+command_encoder::write_unsigned(char* pDest, std::size_t uValue) {
+  char* pEnd = pDest + digits_count(uValue);
+  write_digits(pEnd, uValue);
+
+  return pEnd;
+}
+
+std::size_t
+command_encoder::bulk_size(std::size_t uSize) {
+  return 1 + digits_count(uSize) + 2 + uSize + 2;
+}
+
+std::size_t
+command_encoder::encoded_size(const std::vector<std::string>& vctRedisCmd) {
+  std::size_t uSize = 1 + digits_count(vctRedisCmd.size()) + 2;
+
+  for (const auto& sCmdPart : vctRedisCmd)
+    uSize += bulk_size(sCmdPart.size());
+
+  return uSize;
+}
+
+void
+command_encoder::encode(const std::vector<std::string>& vctRedisCmd, std::vector<char>& vctBuffer,
+  std::size_t uExtraArgs) {
+  std::size_t uOffset = vctBuffer.size();
+  std::size_t uSize   = encoded_size(vctRedisCmd) - digits_count(vctRedisCmd.size()) +
+                        digits_count(vctRedisCmd.size() + uExtraArgs);
+  vctBuffer.resize(uOffset + uSize);
+
+  char* pDest = write_header(vctBuffer.data() + uOffset, '*', vctRedisCmd.size() + uExtraArgs);
+  for (const auto& sCmdPart : vctRedisCmd)
+    pDest = write_bulk(pDest, sCmdPart.data(), sCmdPart.size());
+}
+
+void
+command_encoder::encode(const command_descriptor& command, const std::vector<std::string>& vctArgs,
+  std::vector<char>& vctBuffer, std::size_t uExtraArgs) {
+  std::size_t uNbArgs = command.uNbParts + vctArgs.size() + uExtraArgs;
+  std::size_t uSize   = 1 + digits_count(uNbArgs) + 2 + command.uHeaderSize;
+  for (const auto& sArg : vctArgs)
+    uSize += bulk_size(sArg.size());
+
+  std::size_t uOffset = vctBuffer.size();
+  vctBuffer.resize(uOffset + uSize);
+
+  char* pDest = write_header(vctBuffer.data() + uOffset, '*', uNbArgs);
+  std::memcpy(pDest, command.pHeader, command.uHeaderSize);
+  pDest += command.uHeaderSize;
+  for (const auto& sArg : vctArgs)
+    pDest = write_bulk(pDest, sArg.data(), sArg.size());
+}
+
+void
+command_encoder::encode_bulk(const char* pData, std::size_t uSize, std::vector<char>& vctBuffer) {
+  std::size_t uOffset = vctBuffer.size();
+  vctBuffer.resize(uOffset + bulk_size(uSize));
+
+  write_bulk(vctBuffer.data() + uOffset, pData, uSize);
+}
+
+void
+command_encoder::encode_bulk_header(std::size_t uSize, std::vector<char>& vctBuffer) {
+  std::size_t uOffset = vctBuffer.size();
+  vctBuffer.resize(uOffset + 1 + digits_count(uSize) + 2);
+
+  write_header(vctBuffer.data() + uOffset, '$', uSize);
+}
+
+char*
+command_encoder::write_header(char* pDest, char cType, std::size_t uSize) {
+  *pDest++ = cType;
+  pDest    = write_unsigned(pDest, uSize);
+  *pDest++ = '\r';
+  *pDest++ = '\n';
+
+  return pDest;
+}
+
+char*
+command_encoder::write_bulk(char* pDest, const char* pData, std::size_t uSize) {
+  pDest = write_header(pDest, '$', uSize);
+
+  if (uSize)
+    std::memcpy(pDest, pData, uSize);
+  pDest += uSize;
+
+  *pDest++ = '\r';
+  *pDest++ = '\n';
+
+  return pDest;
+}
+
+std::size_t
+command_encoder::begin_frame(std::vector<char>& vctBuffer) {
+  std::size_t uOffset = vctBuffer.size();
+  vctBuffer.resize(uOffset + max_header_size);
+
+  return uOffset;
+}
+
+void
+command_encoder::end_frame(std::vector<char>& vctBuffer, std::size_t uOffset, std::size_t uNbArgs) {
+  //! the header is written at the end of the room left for it, which is then removed
+  std::size_t uHeaderSize = 1 + digits_count(uNbArgs) + 2;
+  std::size_t uGap        = max_header_size - uHeaderSize;
+
+  write_header(vctBuffer.data() + uOffset + uGap, '*', uNbArgs);
+  vctBuffer.erase(vctBuffer.begin() + uOffset, vctBuffer.begin() + uOffset + uGap);
+}
+
+std::size_t
+command_encoder::arg_count(command_id eCommand) {
+  return command_table::get(eCommand).uNbParts;
+}
+
+std::size_t
+command_encoder::arg_count(const std::vector<std::string>& vctArgs) {
+  return vctArgs.size();
+}
+
+std::size_t
+command_encoder::arg_max_size(command_id eCommand) {
+  return command_table::get(eCommand).uHeaderSize;
+}
+
+std::size_t
+command_encoder::arg_max_size(const string_ref& sArg) {
+  return bulk_size(sArg.size());
+}
+
+std::size_t
+command_encoder::arg_max_size(const std::vector<char>& vctArg) {
+  return bulk_size(vctArg.size());
+}
+
+std::size_t
+command_encoder::arg_max_size(const std::vector<unsigned char>& vctArg) {
+  return bulk_size(vctArg.size());
+}
+
+std::size_t
+command_encoder::arg_max_size(const std::vector<std::string>& vctArgs) {
+  std::size_t uSize = 0;
+  for (const auto& sArg : vctArgs)
+    uSize += bulk_size(sArg.size());
+
+  return uSize;
+}
+
+char*
+command_encoder::write_arg(char* pDest, command_id eCommand) {
+  const command_descriptor& command = command_table::get(eCommand);
+  std::memcpy(pDest, command.pHeader, command.uHeaderSize);
+
+  return pDest + command.uHeaderSize;
+}
+
+char*
+command_encoder::write_arg(char* pDest, const string_ref& sArg) {
+  return write_bulk(pDest, sArg.data(), sArg.size());
+}
+
+char*
+command_encoder::write_arg(char* pDest, const std::vector<char>& vctArg) {
+  return write_bulk(pDest, vctArg.data(), vctArg.size());
+}
+
+char*
+command_encoder::write_arg(char* pDest, const std::vector<unsigned char>& vctArg) {
+  return write_bulk(pDest, reinterpret_cast<const char*>(vctArg.data()), vctArg.size());
+}
+
+char*
+command_encoder::write_arg(char* pDest, const std::vector<std::string>& vctArgs) {
+  for (const auto& sArg : vctArgs)
+    pDest = write_bulk(pDest, sArg.data(), sArg.size());
+
+  return pDest;
+}
+
+char*
+command_encoder::write_integer(char* pDest, std::int64_t nValue) {
+  if (nValue >= 0)
+    return write_unsigned_integer(pDest, static_cast<std::uint64_t>(nValue));
+
+  //! magnitude computed in unsigned arithmetic, as -INT64_MIN does not fit in an int64_t
+  char szDigits[20];
+  char* pEnd   = szDigits + sizeof(szDigits);
+  char* pBegin = write_digits(pEnd, 0 - static_cast<std::uint64_t>(nValue));
+  *--pBegin    = '-';
+
+  return write_bulk(pDest, pBegin, pEnd - pBegin);
+}
+
+char*
+command_encoder::write_unsigned_integer(char* pDest, std::uint64_t uValue) {
+  char szDigits[20];
+  char* pEnd   = szDigits + sizeof(szDigits);
+  char* pBegin = write_digits(pEnd, uValue);
+
+  return write_bulk(pDest, pBegin, pEnd - pBegin);
+}
+
+char*
+command_encoder::write_double(char* pDest, double dValue, int nPrecision) {
+  char szDigits[32];
+  int nSize = std::snprintf(szDigits, sizeof(szDigits), "%.*g", nPrecision, dValue);
+
+  return write_bulk(pDest, szDigits, nSize > 0 ? static_cast<std::size_t>(nSize) : 0);
+}
+
+} // namespace network
+
+} // namespace cpp_redis
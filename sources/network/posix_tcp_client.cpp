@@ -0,0 +1,364 @@
+// MIT License
+//
+// Copyright (c) 2016-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _WIN32
+
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/logger.hpp>
+#include <cpp_redis/network/posix_tcp_client.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace cpp_redis {
+
+namespace network {
+
+//! number of buffers written by a single sendmsg call
+#ifdef IOV_MAX
+static const std::size_t MAX_IOVECS = IOV_MAX;
+#else
+static const std::size_t MAX_IOVECS = 1024;
+#endif /* IOV_MAX */
+
+//! a lost connection is reported by the read thread, not through SIGPIPE
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif /* MSG_NOSIGNAL */
+
+//!
+//! connect the socket, giving up after the given time
+//!
+//! \return whether the socket is connected
+//!
+static bool
+connect_socket(int nFd, const sockaddr* pAddr, socklen_t uAddrLen, std::uint32_t uTimeoutMsecs) {
+  if (!uTimeoutMsecs)
+    return ::connect(nFd, pAddr, uAddrLen) == 0;
+
+  int nFlags = ::fcntl(nFd, F_GETFL, 0);
+  ::fcntl(nFd, F_SETFL, nFlags | O_NONBLOCK);
+
+  int nResult = ::connect(nFd, pAddr, uAddrLen);
+  if (nResult < 0 && errno == EINPROGRESS) {
+    pollfd    fdPoll = {nFd, POLLOUT, 0};
+    int       nError = 0;
+    socklen_t uLen   = sizeof(nError);
+
+    if (::poll(&fdPoll, 1, static_cast<int>(uTimeoutMsecs)) == 1
+        && ::getsockopt(nFd, SOL_SOCKET, SO_ERROR, &nError, &uLen) == 0 && nError == 0)
+      nResult = 0;
+  }
+
+  ::fcntl(nFd, F_SETFL, nFlags);
+
+  return nResult == 0;
+}
+
+//!
+//! write all the given buffers, MAX_IOVECS at a time
+//!
+//! \param written number of bytes written
+//! \return whether all the bytes have been written
+//!
+static bool
+send_iovecs(int nFd, std::vector<iovec>& vctIovecs, std::size_t& uWritten) {
+  std::size_t uIndex = 0;
+
+  while (uIndex < vctIovecs.size()) {
+    msghdr msg     = {};
+    msg.msg_iov    = &vctIovecs[uIndex];
+    msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(std::min(vctIovecs.size() - uIndex, MAX_IOVECS));
+
+    ssize_t nSent = ::sendmsg(nFd, &msg, SEND_FLAGS);
+    if (nSent < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+
+    uWritten += static_cast<std::size_t>(nSent);
+
+    //! skip the buffers fully written, and the written part of the next one
+    std::size_t uSent = static_cast<std::size_t>(nSent);
+    while (uIndex < vctIovecs.size() && uSent >= vctIovecs[uIndex].iov_len) {
+      uSent -= vctIovecs[uIndex].iov_len;
+      ++uIndex;
+    }
+
+    if (uSent) {
+      vctIovecs[uIndex].iov_base = static_cast<char*>(vctIovecs[uIndex].iov_base) + uSent;
+      vctIovecs[uIndex].iov_len -= uSent;
+    }
+  }
+
+  return true;
+}
+
+posix_tcp_client::posix_tcp_client(void)
+: m_nFd(-1)
+, m_bConnected_a(false)
+, m_uGeneration(0)
+, m_bReadPending(false) {}
+
+posix_tcp_client::~posix_tcp_client(void) {
+  disconnect(true);
+
+  //! destroyed from a read callback
+  if (m_threadRead.joinable())
+    m_threadRead.detach();
+}
+
+void
+posix_tcp_client::connect(const std::string& sAddr, std::uint32_t uPort, std::uint32_t uTimeoutMsecs) {
+  std::lock_guard<std::mutex> lock(m_mtxWrite);
+
+  if (m_bConnected_a)
+    throw redis_error("posix_tcp_client is already connected");
+
+  //! the read thread of the previous connection has stopped, or is the caller (from the disconnection handler)
+  if (m_threadRead.joinable()) {
+    if (m_threadRead.get_id() == std::this_thread::get_id())
+      m_threadRead.detach();
+    else
+      m_threadRead.join();
+  }
+
+  addrinfo hints     = {};
+  hints.ai_family    = AF_UNSPEC;
+  hints.ai_socktype  = SOCK_STREAM;
+  addrinfo* pResults = nullptr;
+
+  int nError = ::getaddrinfo(sAddr.c_str(), std::to_string(uPort).c_str(), &hints, &pResults);
+  if (nError)
+    throw redis_error("posix_tcp_client could not resolve " + sAddr + ": " + ::gai_strerror(nError));
+
+  int nFd = -1;
+  for (addrinfo* pResult = pResults; pResult && nFd < 0; pResult = pResult->ai_next) {
+    nFd = ::socket(pResult->ai_family, pResult->ai_socktype, pResult->ai_protocol);
+    if (nFd < 0)
+      continue;
+
+#ifdef SO_NOSIGPIPE
+    int nEnabled = 1;
+    ::setsockopt(nFd, SOL_SOCKET, SO_NOSIGPIPE, &nEnabled, sizeof(nEnabled));
+#endif /* SO_NOSIGPIPE */
+
+    if (!connect_socket(nFd, pResult->ai_addr, pResult->ai_addrlen, uTimeoutMsecs)) {
+      ::close(nFd);
+      nFd = -1;
+    }
+  }
+
+  ::freeaddrinfo(pResults);
+
+  if (nFd < 0)
+    throw redis_error("posix_tcp_client could not connect to " + sAddr + ":" + std::to_string(uPort));
+
+  std::uint64_t uGeneration;
+  {
+    std::lock_guard<std::mutex> lockRead(m_mtxRead);
+    uGeneration    = m_uGeneration;
+    m_bReadPending = false;
+  }
+
+  m_nFd          = nFd;
+  m_bConnected_a = true;
+  m_threadRead   = std::thread(&posix_tcp_client::read_loop, this, uGeneration, nFd);
+
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::posix_tcp_client connected");
+}
+
+void
+posix_tcp_client::disconnect(bool bWaitForRemoval) {
+  {
+    std::lock_guard<std::mutex> lock(m_mtxWrite);
+
+    if (m_bConnected_a) {
+      std::lock_guard<std::mutex> lockRead(m_mtxRead);
+
+      //! the read thread is woken up, and closes the socket
+      ++m_uGeneration;
+      m_bReadPending = false;
+      m_bConnected_a = false;
+      ::shutdown(m_nFd, SHUT_RDWR);
+      m_nFd = -1;
+    }
+  }
+
+  m_cvRead.notify_all();
+
+  if (bWaitForRemoval && m_threadRead.joinable() && m_threadRead.get_id() != std::this_thread::get_id())
+    m_threadRead.join();
+}
+
+bool
+posix_tcp_client::is_connected(void) const {
+  return m_bConnected_a;
+}
+
+void
+posix_tcp_client::async_read(read_request& requestRead) {
+  {
+    std::lock_guard<std::mutex> lock(m_mtxRead);
+
+    if (!m_bConnected_a)
+      throw redis_error("posix_tcp_client is not connected");
+
+    m_requestRead  = std::move(requestRead);
+    m_bReadPending = true;
+  }
+
+  m_cvRead.notify_all();
+}
+
+void
+posix_tcp_client::async_write(write_request& requestWrite) {
+  auto         callbackAsyncWrite = std::move(requestWrite.callbackAsyncWrite);
+  write_result resultWrite        = {false, 0};
+
+  {
+    std::lock_guard<std::mutex> lock(m_mtxWrite);
+
+    if (!m_bConnected_a)
+      throw redis_error("posix_tcp_client is not connected");
+
+    //! the ranges of the buffer around the values, and the values, as they are
+    std::vector<iovec> vctIovecs;
+    vctIovecs.reserve(2 * requestWrite.vctSegments.size() + 1);
+
+    char*       pBuffer = requestWrite.vctBuffer.data();
+    std::size_t uPos    = 0;
+
+    for (const auto& segment : requestWrite.vctSegments) {
+      if (segment.uOffset > uPos)
+        vctIovecs.push_back({pBuffer + uPos, segment.uOffset - uPos});
+      if (!segment.ptrValue->empty())
+        vctIovecs.push_back({const_cast<char*>(segment.ptrValue->data()), segment.ptrValue->size()});
+      uPos = segment.uOffset;
+    }
+
+    if (requestWrite.vctBuffer.size() > uPos)
+      vctIovecs.push_back({pBuffer + uPos, requestWrite.vctBuffer.size() - uPos});
+
+    resultWrite.bSuccess = send_iovecs(m_nFd, vctIovecs, resultWrite.nSizeWritten);
+
+    //! the read thread reports the disconnection
+    if (!resultWrite.bSuccess)
+      ::shutdown(m_nFd, SHUT_RDWR);
+  }
+
+  if (callbackAsyncWrite)
+    callbackAsyncWrite(resultWrite);
+}
+
+bool
+posix_tcp_client::supports_segments(void) const {
+  return true;
+}
+
+void
+posix_tcp_client::set_on_disconnection_handler(const disconnection_handler_t& handlerDisconnection) {
+  m_handlerDisconnection = handlerDisconnection;
+}
+
+void
+posix_tcp_client::read_loop(std::uint64_t uGeneration, int nFd) {
+  for (;;) {
+    read_request requestRead;
+    {
+      std::unique_lock<std::mutex> ulock(m_mtxRead);
+      m_cvRead.wait(ulock, [&] { return m_bReadPending || m_uGeneration != uGeneration; });
+
+      //! closed by disconnect
+      if (m_uGeneration != uGeneration)
+        break;
+
+      requestRead    = std::move(m_requestRead);
+      m_bReadPending = false;
+    }
+
+    read_result resultRead = {false, std::vector<char>(requestRead.nSizeToRead)};
+    ssize_t     nRead;
+
+    do {
+      nRead = ::recv(nFd, resultRead.vctBuffer.data(), resultRead.vctBuffer.size(), 0);
+    } while (nRead < 0 && errno == EINTR);
+
+    if (nRead > 0) {
+      resultRead.bSuccess = true;
+      resultRead.vctBuffer.resize(static_cast<std::size_t>(nRead));
+
+      if (requestRead.callbackAsyncRead)
+        requestRead.callbackAsyncRead(resultRead);
+      continue;
+    }
+
+    bool bLost;
+    {
+      std::lock_guard<std::mutex> lock(m_mtxWrite);
+      std::lock_guard<std::mutex> lockRead(m_mtxRead);
+
+      //! not lost if closed by disconnect
+      bLost = m_uGeneration == uGeneration;
+      if (bLost) {
+        ++m_uGeneration;
+        m_bReadPending = false;
+        m_bConnected_a = false;
+        m_nFd          = -1;
+      }
+    }
+
+    if (!bLost)
+      break;
+
+    ::close(nFd);
+    __CPP_REDIS_LOG(warn, "cpp_redis::network::posix_tcp_client lost the connection");
+
+    if (requestRead.callbackAsyncRead)
+      requestRead.callbackAsyncRead(resultRead);
+
+    //! the handler may reconnect, replacing the handler and the read thread: nothing is accessed once it returns
+    disconnection_handler_t handlerDisconnection = m_handlerDisconnection;
+    if (handlerDisconnection)
+      handlerDisconnection();
+    return;
+  }
+
+  ::close(nFd);
+}
+
+} // namespace network
+
+} // namespace cpp_redis
+
+#endif /* _WIN32 */
@@ -22,6 +22,7 @@
 
 #include <cpp_redis/misc/error.hpp>
 #include <cpp_redis/misc/logger.hpp>
+#include <cpp_redis/network/command_encoder.hpp>
 #include <cpp_redis/network/redis_connection.hpp>
 
 #ifndef __CPP_REDIS_USE_CUSTOM_TCP_CLIENT
@@ -41,6 +42,8 @@ redis_connection::redis_connection(void)
 redis_connection::redis_connection(const std::shared_ptr<tcp_client_iface>& ptrTcpClient)
 : m_ptrTcpClient(ptrTcpClient)
 , m_callbackReply(nullptr)
+, m_callbackReplyView(nullptr)
+, m_callbackReplies(nullptr)
 , m_handlerDisconnection(nullptr) {
   __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection created");
 }
@@ -86,7 +89,8 @@ redis_connection::disconnect(bool wait_for_removal) {
   m_ptrTcpClient->disconnect(wait_for_removal);
 
   //! clear buffer
-  m_sBuffer.clear();
+  m_vctBuffer.clear();
+  m_vctSegments.clear();
   //! clear builder
   m_builderReply.reset();
 
@@ -98,26 +102,85 @@ redis_connection::is_connected(void) const {
   return m_ptrTcpClient->is_connected();
 }
 
-std::string
-redis_connection::build_command(const std::vector<std::string>& vctRedisCmd) {
-  std::string sCmd = "*" + std::to_string(vctRedisCmd.size()) + "\r\n";
+redis_connection&
+redis_connection::send(const std::vector<std::string>& vctRedisCmd) {
+  std::lock_guard<std::mutex> lock(m_mtxBuffer);
 
-  for (const auto& sCmdPart : vctRedisCmd)
-    sCmd += "$" + std::to_string(sCmdPart.length()) + "\r\n" + sCmdPart + "\r\n";
+  command_encoder::encode(vctRedisCmd, m_vctBuffer);
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
 
-  return sCmd;
+  return *this;
 }
 
 redis_connection&
-redis_connection::send(const std::vector<std::string>& vctRedisCmd) {
+redis_connection::send(const std::vector<std::string>& vctRedisCmd, const shared_value_t& ptrValue) {
   std::lock_guard<std::mutex> lock(m_mtxBuffer);
 
-  m_sBuffer += build_command(vctRedisCmd);
+  command_encoder::encode(vctRedisCmd, m_vctBuffer, 1);
+  append_shared_value(ptrValue);
   __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
 
   return *this;
 }
 
+redis_connection&
+redis_connection::send(const command_descriptor& command, const std::vector<std::string>& vctArgs) {
+  std::lock_guard<std::mutex> lock(m_mtxBuffer);
+
+  command_encoder::encode(command, vctArgs, m_vctBuffer);
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
+
+  return *this;
+}
+
+redis_connection&
+redis_connection::send(const command_descriptor& command, const std::vector<std::string>& vctArgs,
+  const shared_value_t& ptrValue) {
+  std::lock_guard<std::mutex> lock(m_mtxBuffer);
+
+  command_encoder::encode(command, vctArgs, m_vctBuffer, 1);
+  append_shared_value(ptrValue);
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
+
+  return *this;
+}
+
+redis_connection&
+redis_connection::send_encoded(const std::vector<char>& vctFrame) {
+  std::lock_guard<std::mutex> lock(m_mtxBuffer);
+
+  m_vctBuffer.insert(m_vctBuffer.end(), vctFrame.begin(), vctFrame.end());
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
+
+  return *this;
+}
+
+redis_connection&
+redis_connection::send_encoded(const std::vector<char>& vctFrame, const shared_value_t& ptrValue) {
+  std::lock_guard<std::mutex> lock(m_mtxBuffer);
+
+  m_vctBuffer.insert(m_vctBuffer.end(), vctFrame.begin(), vctFrame.end());
+  append_shared_value(ptrValue);
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection stored new command in the send buffer");
+
+  return *this;
+}
+
+void
+redis_connection::append_shared_value(const shared_value_t& ptrValue) {
+  if (!ptrValue) {
+    command_encoder::encode_bulk("", 0, m_vctBuffer);
+  } else if (ptrValue->size() < __CPP_REDIS_SHARED_VALUE_MIN_SIZE || !m_ptrTcpClient->supports_segments()) {
+    command_encoder::encode_bulk(ptrValue->data(), ptrValue->size(), m_vctBuffer);
+  } else {
+    //! only the header and the end sequence are buffered, the value itself is written from the caller's memory
+    command_encoder::encode_bulk_header(ptrValue->size(), m_vctBuffer);
+    m_vctSegments.push_back({m_vctBuffer.size(), ptrValue});
+    m_vctBuffer.push_back('\r');
+    m_vctBuffer.push_back('\n');
+  }
+}
+
 //! commit pipelined transaction
 redis_connection&
 redis_connection::commit(void) {
@@ -125,10 +188,17 @@ redis_connection::commit(void) {
 
   //! ensure buffer is cleared
   __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection attempts to send pipelined commands");
-  std::string sBuffer = std::move(m_sBuffer);
+  //! the encoded commands are handed over to the tcp client as is, without any copy
+  tcp_client_iface::write_request requestWrite = {std::move(m_vctBuffer), nullptr, {}};
+  m_vctBuffer.clear();
+
+  //! the shared values are handed over as well, along with their offset in the send buffer
+  requestWrite.vctSegments.swap(m_vctSegments);
+
+  //! the next commands are likely to be as many: size the buffer for them at once
+  m_vctBuffer.reserve(requestWrite.vctBuffer.size());
 
   try {
-    tcp_client_iface::write_request requestWrite = {std::vector<char>{sBuffer.begin(), sBuffer.end()}, nullptr};
     m_ptrTcpClient->async_write(requestWrite);
   }
   catch (const std::exception& e) {
@@ -141,6 +211,33 @@ redis_connection::commit(void) {
   return *this;
 }
 
+void
+redis_connection::set_reply_pool_enabled(bool bEnabled) {
+  m_builderReply.set_pool_enabled(bEnabled);
+}
+
+void
+redis_connection::set_reply_limits(const builders::reply_limits& limits) {
+  m_builderReply.set_limits(limits);
+}
+
+void
+redis_connection::set_reply_view_handlers(const reply_view_predicate_t& predicate,
+  const reply_view_callback_t& callbackReplyView) {
+  m_builderReply.set_view_predicate(predicate);
+  m_callbackReplyView = callbackReplyView;
+}
+
+void
+redis_connection::set_reply_handler_selector(const reply_handler_selector_t& selector) {
+  m_builderReply.set_handler_selector(selector);
+}
+
+void
+redis_connection::set_replies_callback(const replies_callback_t& callbackReplies) {
+  m_callbackReplies = callbackReplies;
+}
+
 void
 redis_connection::call_disconnection_handler(void) {
   if (m_handlerDisconnection) {
@@ -149,33 +246,75 @@ redis_connection::call_disconnection_handler(void) {
   }
 }
 
+void
+redis_connection::flush_replies(void) {
+  if (m_vctReplies.empty())
+    return;
+
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection executes batch reply callback");
+  m_callbackReplies(*this, m_vctReplies);
+
+  //! the replies are not reachable anymore: release their storage in one shot
+  for (auto& reply : m_vctReplies)
+    m_builderReply.recycle(reply);
+
+  m_vctReplies.clear();
+}
+
 void
 redis_connection::tcp_client_receive_handler(const tcp_client_iface::read_result& resultRead) {
   if (!resultRead.bSuccess) { return; }
 
-  try {
-    __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection receives packet, attempts to build reply");
-    m_builderReply << std::string(resultRead.vctBuffer.begin(), resultRead.vctBuffer.end());
-  }
-  catch (const redis_error&) {
-    __CPP_REDIS_LOG(error, "cpp_redis::network::redis_connection could not build reply (invalid format),"
-        " disconnecting");
-    call_disconnection_handler();
-    return;
-  }
+  __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection receives packet, attempts to build reply");
+  bool bValid = m_builderReply.try_append(resultRead.vctBuffer.data(), resultRead.vctBuffer.size());
 
+  //! the replies built before the invalid data are delivered first
   while (m_builderReply.reply_available()) {
     __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection reply fully built");
 
-    auto reply = m_builderReply.get_front();
-    m_builderReply.pop_front();
+    if (m_builderReply.front_is_view() && m_callbackReplyView) {
+      //! deliver the replies received before the view first
+      flush_replies();
+
+      __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection executes reply view callback");
 
-    if (m_callbackReply) {
-      __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection executes reply callback");
-      m_callbackReply(*this, reply);
+      //! the view points into the builder buffer: pop it only once the callback returns
+      m_callbackReplyView(*this, m_builderReply.get_front_view());
+      m_builderReply.pop_front();
+    } else if (m_callbackReplies) {
+      m_vctReplies.push_back(m_builderReply.take_front());
+    } else {
+      auto reply = m_builderReply.take_front();
+
+      if (m_callbackReply) {
+        __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection executes reply callback");
+        m_callbackReply(*this, reply);
+      }
+
+      //! the reply is not reachable anymore: release its storage in one shot
+      m_builderReply.recycle(reply);
+    }
+
+    //! the parsing may have stopped before a reply passed as events, waiting for the previous ones to be popped
+    //! the batch is delivered first, as handler selectors count the replies not yet passed to a callback
+    if (!m_builderReply.reply_available()) {
+      flush_replies();
+
+      if (bValid)
+        bValid = m_builderReply.try_resume();
     }
   }
 
+  if (!bValid) {
+    __CPP_REDIS_LOG(error, std::string("cpp_redis::network::redis_connection could not build reply (")
+        + m_builderReply.get_error() + "), disconnecting");
+
+    //! drop the connection: the following data can not be parsed anymore
+    disconnect(false);
+    call_disconnection_handler();
+    return;
+  }
+
   try {
     tcp_client_iface::read_request requestRead = {__CPP_REDIS_READ_SIZE,
         std::bind(&redis_connection::tcp_client_receive_handler, this, std::placeholders::_1)};
@@ -190,7 +329,8 @@ void
 redis_connection::tcp_client_disconnection_handler(void) {
   __CPP_REDIS_LOG(debug, "cpp_redis::network::redis_connection has been disconnected");
   //! clear buffer
-  m_sBuffer.clear();
+  m_vctBuffer.clear();
+  m_vctSegments.clear();
   //! clear builder
   m_builderReply.reset();
   //! call disconnection handler
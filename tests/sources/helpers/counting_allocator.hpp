@@ -0,0 +1,101 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+//!
+//! replacement of the global allocation functions counting the allocations of the test executable
+//! every form is replaced (plain and array, sized deallocation), all of them being served by malloc and free
+//! the replacement functions are not inline: this header must be included by a single source of each executable
+//!
+
+namespace cpp_redis {
+
+namespace helpers {
+
+//!
+//! \return number of allocations made by the test executable so far
+//!
+inline std::atomic<std::size_t>&
+allocations(void) {
+  static std::atomic<std::size_t> s_uAllocations(0);
+  return s_uAllocations;
+}
+
+//!
+//! allocate a block, counting the allocation
+//!
+inline void*
+counted_malloc(std::size_t uSize) {
+  ++allocations();
+
+  void* p = std::malloc(uSize ? uSize : 1);
+  if (!p)
+    throw std::bad_alloc();
+
+  return p;
+}
+
+} // namespace helpers
+
+} // namespace cpp_redis
+
+//! the deallocation functions below are the replacements of the ones the allocation functions are paired with:
+//! gcc can not tell so when they are inlined at the call sites of delete, and would warn about free being called on
+//! memory returned by operator new
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif /* __GNUC__ >= 11 */
+
+void*
+operator new(std::size_t uSize) {
+  return cpp_redis::helpers::counted_malloc(uSize);
+}
+
+void*
+operator new[](std::size_t uSize) {
+  return cpp_redis::helpers::counted_malloc(uSize);
+}
+
+void
+operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void
+operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void
+operator delete[](void* p, std::size_t) noexcept {
+  std::free(p);
+}
@@ -0,0 +1,144 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpp_redis/network/tcp_client_iface.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cpp_redis {
+
+namespace helpers {
+
+//!
+//! tcp client writing nowhere, whose replies are fed by the test
+//!
+class fake_tcp_client : public network::tcp_client_iface {
+public:
+  //!
+  //! \param bSupportsSegments whether write requests can be made of segments
+  //!
+  explicit fake_tcp_client(bool bSupportsSegments = false)
+  : m_bSupportsSegments(bSupportsSegments) {}
+
+  void
+  connect(const std::string&, std::uint32_t, std::uint32_t) override {
+    m_bConnected = true;
+  }
+
+  void
+  disconnect(bool) override {
+    m_bConnected = false;
+  }
+
+  bool
+  is_connected(void) const override {
+    return m_bConnected;
+  }
+
+  void
+  async_read(read_request& request) override {
+    m_callbackRead = std::move(request.callbackAsyncRead);
+  }
+
+  void
+  async_write(write_request& request) override {
+    if (request.vctSegments.empty()) {
+      m_sWritten.append(request.vctBuffer.data(), request.vctBuffer.size());
+      //! counted once written, for the bytes to be read by the thread polling the count
+      ++m_uWrites;
+      return;
+    }
+
+    ++m_uSegmentedWrites;
+    std::size_t uPos = 0;
+    for (const auto& segment : request.vctSegments) {
+      m_sWritten.append(request.vctBuffer.data() + uPos, segment.uOffset - uPos);
+      m_sWritten.append(*segment.ptrValue);
+      uPos = segment.uOffset;
+    }
+    m_sWritten.append(request.vctBuffer.data() + uPos, request.vctBuffer.size() - uPos);
+    ++m_uWrites;
+  }
+
+  bool
+  supports_segments(void) const override {
+    return m_bSupportsSegments;
+  }
+
+  void
+  set_on_disconnection_handler(const disconnection_handler_t& handler) override {
+    m_handlerDisconnection = handler;
+  }
+
+public:
+  //! pass the given bytes to the pending read
+  void
+  feed(const std::string& sData) {
+    async_read_callback_t callbackRead = std::move(m_callbackRead);
+    read_result result                 = {true, std::vector<char>(sData.begin(), sData.end())};
+    callbackRead(result);
+  }
+
+  //! close the connection as if the server did, calling the disconnection handler
+  void
+  drop(void) {
+    m_bConnected = false;
+    if (m_handlerDisconnection)
+      m_handlerDisconnection();
+  }
+
+  //! \return bytes written so far
+  const std::string&
+  written(void) const {
+    return m_sWritten;
+  }
+
+  //! \return number of write requests
+  std::size_t
+  writes(void) const {
+    return m_uWrites;
+  }
+
+  //! \return number of write requests made of segments
+  std::size_t
+  segmented_writes(void) const {
+    return m_uSegmentedWrites;
+  }
+
+private:
+  bool                     m_bSupportsSegments;
+  bool                     m_bConnected       = false;
+  std::string              m_sWritten;
+  std::atomic<std::size_t> m_uWrites{0};
+  std::size_t              m_uSegmentedWrites = 0;
+  async_read_callback_t    m_callbackRead;
+  disconnection_handler_t  m_handlerDisconnection;
+};
+
+} // namespace helpers
+
+} // namespace cpp_redis
@@ -0,0 +1,73 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/batch.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(Batch, Empty) {
+  cpp_redis::batch commands;
+
+  EXPECT_TRUE(commands.empty());
+  EXPECT_EQ(commands.size(), 0U);
+  EXPECT_TRUE(commands.get_buffer().empty());
+}
+
+TEST(Batch, Commands) {
+  cpp_redis::batch commands;
+
+  commands.send({"SET", "a", "1"}).send_args(cpp_redis::command_id::incr, "a").send_args("GET", "a");
+
+  EXPECT_FALSE(commands.empty());
+  ASSERT_EQ(commands.size(), 3U);
+
+  const std::string set  = "*3\r\n$3\r\nSET\r\n$1\r\na\r\n$1\r\n1\r\n";
+  const std::string incr = "*2\r\n$4\r\nINCR\r\n$1\r\na\r\n";
+  const std::string get  = "*2\r\n$3\r\nGET\r\n$1\r\na\r\n";
+
+  const std::vector<char>& buffer = commands.get_buffer();
+  EXPECT_EQ(std::string(buffer.begin(), buffer.end()), set + incr + get);
+
+  EXPECT_EQ(commands.get_offset(0), 0U);
+  EXPECT_EQ(commands.get_size(0), set.size());
+  EXPECT_EQ(commands.get_offset(1), set.size());
+  EXPECT_EQ(commands.get_size(1), incr.size());
+  EXPECT_EQ(commands.get_offset(2), set.size() + incr.size());
+  EXPECT_EQ(commands.get_size(2), get.size());
+}
+
+TEST(Batch, Clear) {
+  cpp_redis::batch commands;
+
+  commands.reserve(64, 2);
+  commands.send({"PING"}).send({"PING"});
+  commands.clear();
+
+  EXPECT_TRUE(commands.empty());
+  EXPECT_TRUE(commands.get_buffer().empty());
+
+  commands.send({"PING"});
+
+  ASSERT_EQ(commands.size(), 1U);
+  EXPECT_EQ(commands.get_offset(0), 0U);
+  EXPECT_EQ(commands.get_size(0), commands.get_buffer().size());
+}
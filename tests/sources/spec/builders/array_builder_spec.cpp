@@ -149,3 +149,18 @@ TEST(ArrayBuilder, InvalidSize) {
   auto reply = builder.get_reply();
   EXPECT_TRUE(reply.is_null());
 }
+
+TEST(ArrayBuilder, WithNullBulkString) {
+  cpp_redis::builders::array_builder builder;
+
+  std::string buffer = "2\r\n$-1\r\n:42\r\n";
+  builder << buffer;
+
+  EXPECT_EQ(true, builder.reply_ready());
+  EXPECT_EQ("", buffer);
+
+  auto array = builder.get_reply().as_array();
+  EXPECT_EQ(2U, array.size());
+  EXPECT_TRUE(array[0].is_null());
+  EXPECT_EQ(42, array[1].as_integer());
+}
@@ -0,0 +1,78 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/bulk_sink.hpp>
+#include <cpp_redis/builders/reply_event_parser.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST(BulkSink, ChunksAsReceived) {
+  std::vector<std::string> chunks;
+  cpp_redis::builders::bulk_sink sink([&](const cpp_redis::string_ref& chunk, bool last) {
+    chunks.push_back(chunk.to_string() + (last ? "|" : ""));
+  });
+  cpp_redis::builders::reply_event_parser parser(sink);
+
+  parser << "$10\r\nabc";
+  parser << "defg";
+  parser << "hij\r\n";
+
+  ASSERT_EQ(3U, chunks.size());
+  EXPECT_EQ("abc", chunks[0]);
+  EXPECT_EQ("defg", chunks[1]);
+  EXPECT_EQ("hij|", chunks[2]);
+  EXPECT_EQ(10U, sink.size());
+  EXPECT_EQ(1U, sink.count());
+  EXPECT_FALSE(sink.is_null());
+  EXPECT_FALSE(sink.is_error());
+}
+
+TEST(BulkSink, Stream) {
+  std::ostringstream os;
+  cpp_redis::builders::bulk_sink sink(os);
+  cpp_redis::builders::reply_event_parser parser(sink);
+
+  std::string value(100000, 'v');
+  std::string data = "$100000\r\n" + value + "\r\n";
+
+  for (std::size_t i = 0; i < data.size(); i += 4096)
+    parser << data.substr(i, 4096);
+
+  EXPECT_EQ(value, os.str());
+  EXPECT_EQ(1U, parser.replies_count());
+}
+
+TEST(BulkSink, NullAndError) {
+  std::ostringstream os;
+  cpp_redis::builders::bulk_sink sink(os);
+  cpp_redis::builders::reply_event_parser parser(sink);
+
+  parser << "$-1\r\n-ERR wrong type\r\n";
+
+  EXPECT_TRUE(sink.is_null());
+  EXPECT_TRUE(sink.is_error());
+  EXPECT_EQ("ERR wrong type", sink.error());
+  EXPECT_EQ("", os.str());
+}
@@ -129,3 +129,34 @@ TEST(BulkStringBuilder, InvalidEndSequence) {
   std::string buffer = "5\r\nhello\ra";
   EXPECT_THROW(builder << buffer, cpp_redis::redis_error);
 }
+
+TEST(BulkStringBuilder, ConsumeFromPosition) {
+  cpp_redis::builders::bulk_string_builder builder;
+
+  std::string buffer = "xx5\r\nhello\r\n:1\r\n";
+  std::size_t pos    = 2;
+  builder.consume(buffer, pos);
+
+  EXPECT_EQ(true, builder.reply_ready());
+  EXPECT_EQ(12U, pos);
+  EXPECT_EQ("xx5\r\nhello\r\n:1\r\n", buffer);
+
+  auto reply = builder.get_reply();
+  EXPECT_TRUE(reply.is_bulk_string());
+  EXPECT_EQ("hello", reply.as_string());
+}
+
+TEST(BulkStringBuilder, PendingSize) {
+  cpp_redis::builders::bulk_string_builder builder;
+
+  std::string buffer = "5";
+  std::size_t pos    = 0;
+  builder.consume(buffer, pos);
+  EXPECT_EQ(0U, builder.pending_size());
+
+  buffer += "\r\nhel";
+  builder.consume(buffer, pos);
+  EXPECT_EQ(false, builder.reply_ready());
+  EXPECT_EQ(3U, pos);
+  EXPECT_EQ(7U, builder.pending_size());
+}
@@ -24,6 +24,8 @@
 #include <cpp_redis/misc/error.hpp>
 #include <gtest/gtest.h>
 
+#include <limits>
+
 TEST(IntegerBuilder, WithNoData) {
   cpp_redis::builders::integer_builder builder;
 
@@ -76,6 +78,21 @@ TEST(IntegerBuilder, With64BitInteger) {
   EXPECT_EQ(9223372036854775807L, reply.as_integer());
 }
 
+TEST(IntegerBuilder, WithMin64BitInteger) {
+  cpp_redis::builders::integer_builder builder;
+
+  std::string buffer = "-9223372036854775808\r\n";
+  builder << buffer;
+
+  EXPECT_EQ(true, builder.reply_ready());
+  EXPECT_EQ("", buffer);
+
+  auto reply = builder.get_reply();
+  EXPECT_TRUE(reply.is_integer());
+  EXPECT_EQ(std::numeric_limits<int64_t>::min(), reply.as_integer());
+  EXPECT_EQ(std::numeric_limits<int64_t>::min(), builder.get_integer());
+}
+
 TEST(IntegerBuilder, NegativeNumber) {
   cpp_redis::builders::integer_builder builder;
 
@@ -29,6 +29,8 @@
 #include <cpp_redis/misc/error.hpp>
 #include <gtest/gtest.h>
 
+#include <vector>
+
 TEST(ReplyBuilder, WithNoData) {
   cpp_redis::builders::reply_builder builder;
 
@@ -113,3 +115,263 @@ TEST(ReplyBuilder, WithAllInMultipleTimes) {
   EXPECT_TRUE(row_4.is_bulk_string());
   EXPECT_EQ("hello", row_4.as_string());
 }
+
+TEST(ReplyBuilder, WithManyRepliesInOneTime) {
+  cpp_redis::builders::reply_builder builder;
+
+  std::string buffer;
+  for (int i = 0; i < 1000; ++i)
+    buffer += ":" + std::to_string(i) + "\r\n";
+  buffer += "$5\r\nhel";
+
+  builder << buffer;
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(true, builder.reply_available());
+    EXPECT_EQ(i, builder.get_front().as_integer());
+    builder.pop_front();
+  }
+
+  EXPECT_EQ(false, builder.reply_available());
+
+  builder << "lo\r\n+OK\r\n";
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("hello", builder.get_front().as_string());
+  builder.pop_front();
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.get_front().as_string());
+}
+
+TEST(ReplyBuilder, WithBigBulkStringInMultipleTimes) {
+  cpp_redis::builders::reply_builder builder;
+
+  std::string value(100000, 'a');
+  std::string buffer = "+OK\r\n$" + std::to_string(value.size()) + "\r\n" + value + "\r\n:42\r\n";
+
+  for (std::size_t i = 0; i < buffer.size(); i += 4096)
+    builder << buffer.substr(i, 4096);
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.get_front().as_string());
+  builder.pop_front();
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ(value, builder.get_front().as_string());
+  builder.pop_front();
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ(42, builder.get_front().as_integer());
+}
+
+TEST(ReplyBuilder, Reset) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "*2\r\n:1\r\n";
+  builder.reset();
+  builder << "+OK\r\n";
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.get_front().as_string());
+}
+
+TEST(ReplyBuilder, TryAppendInvalidData) {
+  cpp_redis::builders::reply_builder builder;
+
+  EXPECT_TRUE(builder.try_append("+OK\r\n"));
+  EXPECT_FALSE(builder.try_append(":1\r\n!\r\n"));
+  EXPECT_EQ(std::string("Invalid data"), builder.get_error());
+
+  //! replies built before the invalid data are still available
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.take_front().as_string());
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ(1, builder.take_front().as_integer());
+  EXPECT_EQ(false, builder.reply_available());
+
+  EXPECT_FALSE(builder.try_resume());
+  EXPECT_THROW(builder << "+OK\r\n", cpp_redis::redis_error);
+
+  builder.reset();
+  EXPECT_TRUE(builder.try_append("+OK\r\n"));
+  EXPECT_EQ(nullptr, builder.get_error());
+}
+
+TEST(ReplyBuilder, TryAppendRange) {
+  cpp_redis::builders::reply_builder builder;
+  std::vector<char> vctData = {'$', '5', '\r', '\n', 'h', 'e', 'l', 'l', 'o', '\r', '\n', ':', '4'};
+
+  //! the range is appended as is, including a partial reply
+  EXPECT_TRUE(builder.try_append(vctData.data(), vctData.size()));
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("hello", builder.take_front().as_string());
+  EXPECT_EQ(false, builder.reply_available());
+
+  EXPECT_TRUE(builder.try_append("2\r\n", 3));
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ(42, builder.take_front().as_integer());
+}
+
+TEST(ReplyBuilder, BufferOverLimit) {
+  cpp_redis::builders::reply_builder builder;
+  cpp_redis::builders::reply_limits limits;
+  limits.uMaxBufferSize = 16;
+  builder.set_limits(limits);
+
+  //! consumed bytes do not count
+  EXPECT_TRUE(builder.try_append(std::string(10, '+') + "\r\n:12345678901234\r\n"));
+  EXPECT_TRUE(builder.try_append("$20\r\n0123456789"));
+  EXPECT_FALSE(builder.try_append("0123456789"));
+  EXPECT_EQ(std::string("Receive buffer exceeds the maximum size"), builder.get_error());
+
+  builder.reset();
+  EXPECT_EQ(nullptr, builder.get_error());
+  EXPECT_TRUE(builder.try_append("+OK\r\n"));
+}
+
+TEST(ReplyBuilder, ShrinkAfterLargeReply) {
+  cpp_redis::builders::reply_builder builder;
+  cpp_redis::builders::reply_limits limits;
+  limits.uShrinkThreshold = 1024;
+  builder.set_limits(limits);
+
+  std::string content(64 * 1024, 'a');
+  builder << "$" + std::to_string(content.size()) + "\r\n" + content.substr(0, 1000);
+  builder << content.substr(1000) + "\r\n";
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ(content, builder.take_front().as_string());
+
+  //! the buffer grew for the large bulk string, and has been released once it was used
+  builder << "+OK\r\n";
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.take_front().as_string());
+}
+
+TEST(ReplyBuilder, TakeFront) {
+  cpp_redis::builders::reply_builder builder;
+
+  builder << "*2\r\n$5\r\nhello\r\n:42\r\n+OK\r\n";
+
+  auto reply = builder.take_front();
+  ASSERT_TRUE(reply.is_array());
+  EXPECT_EQ("hello", reply.as_array()[0].as_string());
+  EXPECT_EQ(42, reply.as_array()[1].as_integer());
+
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ("OK", builder.take_front().as_string());
+  EXPECT_EQ(false, builder.reply_available());
+  EXPECT_THROW(builder.take_front(), cpp_redis::redis_error);
+}
+
+TEST(ReplyBuilder, WithReplyPool) {
+  cpp_redis::builders::reply_builder builder;
+  builder.set_pool_enabled(true);
+  EXPECT_EQ(true, builder.is_pool_enabled());
+
+  std::string value(1000, 'a');
+  std::string data = "*1\r\n$1000\r\n" + value + "\r\n";
+
+  builder << data;
+  auto reply            = builder.take_front();
+  const char* recycled  = reply.as_array()[0].as_string().data();
+  builder.recycle(reply);
+  EXPECT_TRUE(reply.is_null());
+
+  builder << data;
+  reply = builder.take_front();
+  EXPECT_EQ(value, reply.as_array()[0].as_string());
+  EXPECT_EQ(recycled, reply.as_array()[0].as_string().data());
+}
+
+TEST(ReplyBuilder, WithViewPredicate) {
+  cpp_redis::builders::reply_builder builder;
+  std::vector<std::size_t> indexes;
+
+  //! keep every other reply as a view
+  builder.set_view_predicate([&](std::size_t index) {
+    indexes.push_back(index);
+    return indexes.size() % 2 == 0;
+  });
+
+  builder << "+first\r\n*2\r\n$5\r\nhel";
+  builder << "lo\r\n:42\r\n+third\r\n";
+
+  ASSERT_EQ(3U, indexes.size());
+  EXPECT_EQ(0U, indexes[0]);
+  EXPECT_EQ(1U, indexes[1]);
+  EXPECT_EQ(2U, indexes[2]);
+
+  EXPECT_EQ(false, builder.front_is_view());
+  EXPECT_THROW(builder.get_front_view(), cpp_redis::redis_error);
+  EXPECT_EQ("first", builder.take_front().as_string());
+
+  ASSERT_EQ(true, builder.front_is_view());
+  EXPECT_THROW(builder.get_front(), cpp_redis::redis_error);
+  auto view = builder.get_front_view();
+  ASSERT_EQ(2U, view.size());
+  EXPECT_EQ("hello", view[0].as_string());
+  EXPECT_EQ(42, view[1].as_integer());
+  builder.pop_front();
+
+  EXPECT_EQ("third", builder.take_front().as_string());
+  EXPECT_EQ(false, builder.reply_available());
+}
+
+TEST(ReplyBuilder, ViewsSurviveCompaction) {
+  cpp_redis::builders::reply_builder builder;
+  builder.set_view_predicate([](std::size_t index) { return index == 0; });
+
+  std::string value(__CPP_REDIS_BUFFER_COMPACT_THRESHOLD, 'a');
+  builder << "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+
+  //! many built replies consumed after the view: the bytes of the view must be kept
+  for (int i = 0; i < 1000; ++i)
+    builder << ":1\r\n";
+
+  ASSERT_EQ(true, builder.front_is_view());
+  EXPECT_EQ(value, builder.get_front_view().as_string().to_string());
+  builder.pop_front();
+
+  //! take_front builds the view on the fly
+  builder.set_view_predicate([](std::size_t) { return true; });
+  builder << "+OK\r\n";
+  while (!builder.front_is_view())
+    builder.pop_front();
+  EXPECT_EQ("OK", builder.take_front().as_string());
+}
+
+TEST(ReplyBuilder, WithHandlerSelector) {
+  class counting_handler : public cpp_redis::builders::reply_handler_iface {
+  public:
+    void on_integer(int64_t value) override { sum += value; }
+    int64_t sum = 0;
+  };
+
+  cpp_redis::builders::reply_builder builder;
+  counting_handler handler;
+  std::size_t replies = 0;
+
+  //! the second reply is passed as events (index counts the replies available, not popped yet)
+  builder.set_handler_selector([&](std::size_t index) -> cpp_redis::builders::reply_handler_iface* {
+    return replies + index == 1 ? &handler : nullptr;
+  });
+
+  builder << "+first\r\n*2\r\n:1\r\n:2\r\n+third\r\n";
+
+  //! parsing stops before the reply passed as events, until the first reply is popped
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_EQ(0, handler.sum);
+  EXPECT_EQ("first", builder.take_front().as_string());
+  ++replies;
+
+  builder.resume();
+  EXPECT_EQ(3, handler.sum);
+  ASSERT_EQ(true, builder.reply_available());
+  EXPECT_TRUE(builder.take_front().is_null());
+  ++replies;
+
+  builder.resume();
+  EXPECT_EQ("third", builder.take_front().as_string());
+}
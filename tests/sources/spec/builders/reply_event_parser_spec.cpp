@@ -0,0 +1,115 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_event_parser.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+//!
+//! handler recording the events it receives as a string
+//!
+class recording_handler : public cpp_redis::builders::reply_handler_iface {
+public:
+  void on_array_begin(std::size_t size) override { events += "[" + std::to_string(size) + " "; }
+  void on_array_end(void) override { events += "] "; }
+  void on_bulk(const cpp_redis::string_ref& chunk, bool last) override {
+    bulk += chunk.to_string();
+    if (last) {
+      events += "$" + bulk + " ";
+      bulk.clear();
+    }
+    ++chunks;
+  }
+  void on_simple_string(const cpp_redis::string_ref& value) override { events += "+" + value.to_string() + " "; }
+  void on_error(const cpp_redis::string_ref& value) override { events += "-" + value.to_string() + " "; }
+  void on_integer(int64_t value) override { events += ":" + std::to_string(value) + " "; }
+  void on_null(void) override { events += "nil "; }
+
+  std::string events;
+  std::string bulk;
+  std::size_t chunks = 0;
+};
+
+TEST(ReplyEventParser, AllTypes) {
+  recording_handler handler;
+  cpp_redis::builders::reply_event_parser parser(handler);
+
+  parser << "*6\r\n+OK\r\n-ERR\r\n:42\r\n$5\r\nhello\r\n$-1\r\n*2\r\n$0\r\n\r\n*0\r\n:1\r\n";
+
+  EXPECT_EQ("[6 +OK -ERR :42 $hello nil [2 $ [0 ] ] ] :1 ", handler.events);
+  EXPECT_EQ(2U, parser.replies_count());
+}
+
+TEST(ReplyEventParser, WhateverTheSplit) {
+  std::string data = "*3\r\n$11\r\nhello world\r\n*1\r\n:-7\r\n+OK\r\n";
+
+  for (std::size_t split = 1; split < data.size(); ++split) {
+    recording_handler handler;
+    cpp_redis::builders::reply_event_parser parser(handler);
+
+    parser << data.substr(0, split);
+    parser << data.substr(split);
+
+    EXPECT_EQ("[3 $hello world [1 :-7 ] +OK ] ", handler.events);
+    EXPECT_EQ(1U, parser.replies_count());
+  }
+}
+
+TEST(ReplyEventParser, BulkStringInChunks) {
+  recording_handler handler;
+  cpp_redis::builders::reply_event_parser parser(handler);
+
+  std::string value(10000, 'x');
+  parser << "$10000\r\n";
+
+  for (std::size_t i = 0; i < value.size(); i += 1000) {
+    parser << value.substr(i, 1000);
+    EXPECT_EQ(i / 1000 + 1, handler.chunks);
+  }
+
+  EXPECT_EQ(0U, parser.replies_count());
+  parser << "\r\n";
+  EXPECT_EQ(1U, parser.replies_count());
+  EXPECT_EQ("$" + value + " ", handler.events);
+}
+
+TEST(ReplyEventParser, InvalidEndSequence) {
+  recording_handler handler;
+  cpp_redis::builders::reply_event_parser parser(handler);
+
+  EXPECT_THROW(parser << "$2\r\nabcd", cpp_redis::redis_error);
+}
+
+TEST(ReplyEventParser, Reset) {
+  recording_handler handler;
+  cpp_redis::builders::reply_event_parser parser(handler);
+
+  parser << "*2\r\n:1\r\n";
+  parser.reset();
+  handler.events.clear();
+  parser << "+OK\r\n";
+
+  EXPECT_EQ("+OK ", handler.events);
+  EXPECT_EQ(1U, parser.replies_count());
+}
@@ -0,0 +1,327 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/array_builder.hpp>
+#include <cpp_redis/builders/reply_parser.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+static std::string
+to_string(const cpp_redis::reply& reply) {
+  std::ostringstream oss;
+  oss << reply;
+  return oss.str();
+}
+
+TEST(ReplyParser, WithNoData) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer;
+  std::size_t pos = 0;
+
+  EXPECT_EQ(false, parser.consume(buffer, pos));
+  EXPECT_EQ(0U, pos);
+}
+
+TEST(ReplyParser, WithPartOfEndSequence) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "+hello\r";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(false, parser.consume(buffer, pos));
+  EXPECT_EQ(0U, pos);
+}
+
+TEST(ReplyParser, SimpleString) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "+simple_string\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_EQ(buffer.size(), pos);
+  EXPECT_TRUE(parser.get_reply().is_simple_string());
+  EXPECT_EQ("simple_string", parser.get_reply().as_string());
+}
+
+TEST(ReplyParser, Error) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "-ERR error\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_TRUE(parser.get_reply().is_error());
+  EXPECT_EQ("ERR error", parser.get_reply().error());
+}
+
+TEST(ReplyParser, Integer) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = ":-42\r\n:42\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_EQ(-42, parser.get_reply().as_integer());
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_EQ(42, parser.get_reply().as_integer());
+  EXPECT_EQ(buffer.size(), pos);
+}
+
+TEST(ReplyParser, InvalidInteger) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = ":4a2\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_THROW(parser.consume(buffer, pos), cpp_redis::redis_error);
+}
+
+TEST(ReplyParser, BulkString) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "$5\r\nhel";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(false, parser.consume(buffer, pos));
+  EXPECT_EQ(4U, pos);
+  EXPECT_EQ(7U, parser.pending_size());
+
+  buffer += "lo\r\n";
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_EQ(buffer.size(), pos);
+  EXPECT_EQ(0U, parser.pending_size());
+  EXPECT_TRUE(parser.get_reply().is_bulk_string());
+  EXPECT_EQ("hello", parser.get_reply().as_string());
+}
+
+TEST(ReplyParser, NullBulkString) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "$-1\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_TRUE(parser.get_reply().is_null());
+}
+
+TEST(ReplyParser, InvalidEndSequence) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "$5\r\nhello\ra";
+  std::size_t pos    = 0;
+
+  EXPECT_THROW(parser.consume(buffer, pos), cpp_redis::redis_error);
+}
+
+TEST(ReplyParser, InvalidType) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "!hello\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_THROW(parser.consume(buffer, pos), cpp_redis::redis_error);
+}
+
+TEST(ReplyParser, EmptyAndNullArrays) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "*0\r\n*-1\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_TRUE(parser.get_reply().is_array());
+  EXPECT_EQ(0U, parser.get_reply().as_array().size());
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_TRUE(parser.get_reply().is_null());
+}
+
+TEST(ReplyParser, NestedArrays) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "*3\r\n*2\r\n:1\r\n*1\r\n$1\r\na\r\n*0\r\n+OK\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_EQ(buffer.size(), pos);
+
+  const auto& array = parser.get_reply().as_array();
+  ASSERT_EQ(3U, array.size());
+  ASSERT_EQ(2U, array[0].as_array().size());
+  EXPECT_EQ(1, array[0].as_array()[0].as_integer());
+  EXPECT_EQ("a", array[0].as_array()[1].as_array()[0].as_string());
+  EXPECT_EQ(0U, array[1].as_array().size());
+  EXPECT_EQ("OK", array[2].as_string());
+}
+
+TEST(ReplyParser, TooDeeplyNested) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer;
+  for (int i = 0; i <= __CPP_REDIS_MAX_NESTING_DEPTH; ++i)
+    buffer += "*1\r\n";
+  std::size_t pos = 0;
+
+  EXPECT_THROW(parser.consume(buffer, pos), cpp_redis::redis_error);
+}
+
+TEST(ReplyParser, SameAsBuildersWhateverTheSplit) {
+  std::string data = "4\r\n+simple_string\r\n-error\r\n*2\r\n:42\r\n*1\r\n$-1\r\n$5\r\nhello\r\n";
+
+  cpp_redis::builders::array_builder builder;
+  std::string builder_buffer = data;
+  builder << builder_buffer;
+  ASSERT_TRUE(builder.reply_ready());
+  const std::string expected = to_string(builder.get_reply());
+
+  for (std::size_t split = 1; split < data.size(); ++split) {
+    cpp_redis::builders::reply_parser parser;
+
+    std::string buffer = "*" + data.substr(0, split);
+    std::size_t pos    = 0;
+    EXPECT_EQ(false, parser.consume(buffer, pos));
+
+    buffer += data.substr(split);
+    ASSERT_EQ(true, parser.consume(buffer, pos));
+    EXPECT_EQ(buffer.size(), pos);
+
+    const auto& reply = parser.get_reply();
+    ASSERT_EQ(4U, reply.as_array().size());
+    EXPECT_EQ(expected, to_string(reply));
+    EXPECT_TRUE(reply.as_array()[2].as_array()[1].as_array()[0].is_null());
+  }
+}
+
+TEST(ReplyParser, Reset) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "*2\r\n:1\r\n";
+  std::size_t pos    = 0;
+  EXPECT_EQ(false, parser.consume(buffer, pos));
+
+  parser.reset();
+
+  buffer = "+OK\r\n";
+  pos    = 0;
+  EXPECT_EQ(true, parser.consume(buffer, pos));
+  EXPECT_EQ("OK", parser.get_reply().as_string());
+}
+
+TEST(ReplyParser, SkipWhateverTheSplit) {
+  std::string data = "*3\r\n+simple_string\r\n*2\r\n:42\r\n$-1\r\n$5\r\nhello\r\n";
+
+  for (std::size_t split = 1; split < data.size(); ++split) {
+    cpp_redis::builders::reply_parser parser;
+
+    std::string buffer = data.substr(0, split);
+    std::size_t pos    = 0;
+    EXPECT_EQ(false, parser.skip(buffer, pos));
+
+    buffer += data.substr(split) + "+OK\r\n";
+    ASSERT_EQ(true, parser.skip(buffer, pos));
+    EXPECT_EQ(data.size(), pos);
+    EXPECT_TRUE(parser.get_reply().is_null());
+
+    ASSERT_EQ(true, parser.consume(buffer, pos));
+    EXPECT_EQ("OK", parser.get_reply().as_string());
+  }
+}
+
+TEST(ReplyParser, SkipInvalidData) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "*1\r\n$2\r\nabcd\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_THROW(parser.skip(buffer, pos), cpp_redis::redis_error);
+}
+
+TEST(ReplyParser, TryConsumeStatus) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = ":4";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::incomplete, parser.try_consume(buffer, pos));
+  EXPECT_EQ(nullptr, parser.get_error());
+
+  buffer += "2\r\n";
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::complete, parser.try_consume(buffer, pos));
+  EXPECT_EQ(42, parser.get_reply().as_integer());
+}
+
+TEST(ReplyParser, TryConsumeInvalidData) {
+  cpp_redis::builders::reply_parser parser;
+
+  std::string buffer = "*2\r\n:1\r\n:a\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::invalid, parser.try_consume(buffer, pos));
+  ASSERT_NE(nullptr, parser.get_error());
+  EXPECT_EQ(std::string("Invalid character for integer redis reply"), parser.get_error());
+
+  //! the error is kept until the parser is reset
+  std::string valid = "+OK\r\n";
+  pos               = 0;
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::invalid, parser.try_consume(valid, pos));
+
+  parser.reset();
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::complete, parser.try_consume(valid, pos));
+  EXPECT_EQ(nullptr, parser.get_error());
+}
+
+TEST(ReplyParser, BulkStringOverLimit) {
+  cpp_redis::builders::reply_parser parser;
+  cpp_redis::builders::reply_limits limits;
+  limits.uMaxBulkLength = 4;
+  parser.set_limits(limits);
+
+  std::string buffer = "$4\r\nabcd\r\n$5\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::complete, parser.try_consume(buffer, pos));
+  EXPECT_EQ("abcd", parser.get_reply().as_string());
+
+  //! rejected as soon as the header is read, before the content is received
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::invalid, parser.try_consume(buffer, pos));
+  EXPECT_EQ(std::string("Bulk string exceeds the maximum length"), parser.get_error());
+}
+
+TEST(ReplyParser, ArrayOverLimit) {
+  cpp_redis::builders::reply_parser parser;
+  cpp_redis::builders::reply_limits limits;
+  limits.uMaxArraySize = 2;
+  parser.set_limits(limits);
+
+  std::string buffer = "*2\r\n*2\r\n:1\r\n:2\r\n:3\r\n*3\r\n";
+  std::size_t pos    = 0;
+
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::complete, parser.try_consume(buffer, pos));
+  EXPECT_EQ(2U, parser.get_reply().as_array().size());
+
+  EXPECT_EQ(cpp_redis::builders::reply_parser::status::invalid, parser.try_skip(buffer, pos));
+  EXPECT_EQ(std::string("Array exceeds the maximum number of elements"), parser.get_error());
+}
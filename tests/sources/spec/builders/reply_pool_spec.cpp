@@ -0,0 +1,65 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/builders/reply_pool.hpp>
+#include <gtest/gtest.h>
+
+TEST(ReplyPool, EmptyPool) {
+  cpp_redis::builders::reply_pool pool;
+
+  EXPECT_EQ("", pool.acquire_string());
+  EXPECT_EQ(0U, pool.acquire_rows().size());
+}
+
+TEST(ReplyPool, ReleaseTree) {
+  cpp_redis::builders::reply_pool pool;
+
+  std::string big(1024, 'a');
+  std::vector<cpp_redis::reply> rows;
+  rows.reserve(8);
+  rows.emplace_back(big, cpp_redis::reply::string_type::bulk_string);
+  rows.emplace_back(42);
+  cpp_redis::reply r(std::move(rows));
+
+  const char* str_data             = r.as_array()[0].as_string().data();
+  const cpp_redis::reply* row_data = r.as_array().data();
+
+  pool.release(r);
+  EXPECT_TRUE(r.is_null());
+
+  std::string str = pool.acquire_string();
+  EXPECT_EQ("", str);
+  EXPECT_EQ(str_data, str.data());
+
+  std::vector<cpp_redis::reply> recycled_rows = pool.acquire_rows();
+  EXPECT_EQ(0U, recycled_rows.size());
+  EXPECT_EQ(row_data, recycled_rows.data());
+}
+
+TEST(ReplyPool, SmallStringsAreNotKept) {
+  cpp_redis::builders::reply_pool pool;
+
+  cpp_redis::reply r("OK", cpp_redis::reply::string_type::simple_string);
+  pool.release(r);
+
+  EXPECT_EQ(std::string().capacity(), pool.acquire_string().capacity());
+}
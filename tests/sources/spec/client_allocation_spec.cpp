@@ -0,0 +1,110 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/misc/mpsc_queue.hpp>
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/counting_allocator.hpp>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+static const std::size_t nb_commands = 16;
+
+//! reply to nb_commands GET
+static std::string
+get_replies(void) {
+  std::string sReplies;
+  for (std::size_t i = 0; i < nb_commands; ++i)
+    sReplies += "$5\r\nvalue\r\n";
+  return sReplies;
+}
+
+//! send nb_commands GET with a callback and nb_commands future-based GET, and receive their replies
+//! \return allocations made to submit the commands with a callback and the future-based commands
+static std::pair<std::size_t, std::size_t>
+get_round_trip(cpp_redis::client& client, fake_tcp_client& tcp_client) {
+  std::vector<cpp_redis::client::reply_future_t> futures;
+  futures.reserve(nb_commands);
+  std::string key = "key";
+
+  std::size_t uStart = cpp_redis::helpers::allocations();
+  for (std::size_t i = 0; i < nb_commands; ++i)
+    client.get(key, [](cpp_redis::reply&) {});
+  std::size_t uCallbacks = cpp_redis::helpers::allocations() - uStart;
+
+  uStart = cpp_redis::helpers::allocations();
+  for (std::size_t i = 0; i < nb_commands; ++i)
+    futures.push_back(client.get(key));
+  std::size_t uFutures = cpp_redis::helpers::allocations() - uStart;
+
+  client.commit();
+  tcp_client.feed(get_replies());
+  tcp_client.feed(get_replies());
+
+  for (auto& future : futures) {
+    cpp_redis::reply reply = future.get();
+    EXPECT_TRUE(reply.is_string());
+    EXPECT_EQ(reply.as_string(), "value");
+  }
+
+  return {uCallbacks, uFutures};
+}
+
+TEST(ClientAllocation, FutureCommand) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  //! warm up: completion slots, submission queue nodes and pending command queue are recycled
+  get_round_trip(client, *tcp_client);
+
+  std::pair<std::size_t, std::size_t> allocations = get_round_trip(client, *tcp_client);
+
+#ifdef __CPP_REDIS_USE_POOLED_FUTURES
+  //! the future and the callback of the command add no allocation
+  EXPECT_EQ(allocations.second, allocations.first);
+#else
+  //! std::promise allocates its shared state and its result
+  EXPECT_EQ(allocations.second, allocations.first + 2 * nb_commands);
+#endif /* __CPP_REDIS_USE_POOLED_FUTURES */
+}
+
+TEST(ClientAllocation, FutureRangeCommand) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  std::vector<std::pair<std::string, std::string>> key_vals = {{"a", "1"}, {"b", "2"}};
+  cpp_redis::client::reply_future_t future = client.mset(key_vals.begin(), key_vals.end());
+
+  client.commit();
+  tcp_client->feed("+OK\r\n");
+
+  cpp_redis::reply reply = future.get();
+  EXPECT_TRUE(reply.is_string());
+  EXPECT_EQ(reply.as_string(), "OK");
+}
@@ -0,0 +1,135 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+static const std::string PING = "*1\r\n$4\r\nPING\r\n";
+
+static std::string
+pings(std::size_t count) {
+  std::string encoded;
+  for (std::size_t i = 0; i < count; ++i)
+    encoded += PING;
+  return encoded;
+}
+
+TEST(ClientAutoCommit, BytesThreshold) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+  client.set_auto_commit(2 * PING.size() + 1, 0);
+
+  client.ping();
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 0U);
+
+  //! the third PING crosses the threshold: the three of them are written at once
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->written(), pings(3));
+
+  //! the count starts over
+  client.ping();
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 2U);
+  EXPECT_EQ(tcp_client->written(), pings(6));
+}
+
+TEST(ClientAutoCommit, CommandsThreshold) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+  client.set_auto_commit(0, 2);
+
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 0U);
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->written(), pings(2));
+
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 1U);
+
+  //! commit() still flushes the commands right away
+  client.commit();
+  EXPECT_EQ(tcp_client->writes(), 2U);
+  EXPECT_EQ(tcp_client->written(), pings(3));
+}
+
+TEST(ClientAutoCommit, Delay) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+  client.set_auto_commit(0, 0, std::chrono::microseconds(20000));
+
+  auto begin = std::chrono::steady_clock::now();
+  client.ping();
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 0U);
+
+  //! the commands submitted within the delay are committed together, once it elapsed
+  while (tcp_client->writes() == 0 && std::chrono::steady_clock::now() - begin < std::chrono::seconds(5))
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(20));
+  ASSERT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->written(), pings(2));
+
+  //! the next command arms the delay again
+  client.ping();
+  while (tcp_client->writes() == 1 && std::chrono::steady_clock::now() - begin < std::chrono::seconds(5))
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  ASSERT_EQ(tcp_client->writes(), 2U);
+  EXPECT_EQ(tcp_client->written(), pings(3));
+}
+
+TEST(ClientAutoCommit, Disabled) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+  client.set_auto_commit(0, 2);
+
+  //! the PING submitted before disabling does not count towards the thresholds set afterwards
+  client.ping();
+  client.set_auto_commit(0, 0);
+  client.ping();
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 0U);
+
+  client.set_auto_commit(0, 2);
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 0U);
+  client.ping();
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->written(), pings(5));
+}
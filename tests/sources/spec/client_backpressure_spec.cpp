@@ -0,0 +1,266 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/batch.hpp>
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+//! size of an encoded PING
+static const std::size_t PING_SIZE = std::string("*1\r\n$4\r\nPING\r\n").size();
+
+//! \return limits with the given policy, bounding the size of the pending commands
+static cpp_redis::backpressure_limits
+bytes_limits(cpp_redis::backpressure_policy policy, std::size_t high, std::size_t low) {
+  cpp_redis::backpressure_limits limits;
+  limits.uHighBytes    = high;
+  limits.uLowBytes     = low;
+  limits.uHighCommands = 0;
+  limits.uLowCommands  = 0;
+  limits.ePolicy       = policy;
+  return limits;
+}
+
+//! \return limits with the given policy, bounding the number of pending commands
+static cpp_redis::backpressure_limits
+commands_limits(cpp_redis::backpressure_policy policy, std::size_t high, std::size_t low) {
+  cpp_redis::backpressure_limits limits;
+  limits.uHighBytes    = 0;
+  limits.uLowBytes     = 0;
+  limits.uHighCommands = high;
+  limits.uLowCommands  = low;
+  limits.ePolicy       = policy;
+  return limits;
+}
+
+//! send a PING counting its error replies
+static void
+ping(cpp_redis::client& client, std::atomic<int>& errors) {
+  client.ping([&errors](cpp_redis::reply& reply) {
+    if (reply.is_error()) {
+      EXPECT_EQ(reply.as_string(), "too many pending commands");
+      ++errors;
+    }
+  });
+}
+
+static void
+expect_depth(const cpp_redis::client& client, std::size_t bytes, std::size_t commands) {
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, bytes);
+  EXPECT_EQ(depth.uCommands, commands);
+}
+
+TEST(ClientBackpressure, PendingDepth) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  std::atomic<int> errors(0);
+  ping(client, errors);
+  ping(client, errors);
+  expect_depth(client, 2 * PING_SIZE, 2);
+
+  client.commit();
+  expect_depth(client, 2 * PING_SIZE, 2);
+
+  tcp_client->feed("+PONG\r\n");
+  expect_depth(client, PING_SIZE, 1);
+
+  tcp_client->feed("+PONG\r\n");
+  expect_depth(client, 0, 0);
+  EXPECT_EQ(errors, 0);
+}
+
+TEST(ClientBackpressure, FailPolicy) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.set_backpressure(bytes_limits(cpp_redis::backpressure_policy::fail, 64, 32));
+  client.connect("127.0.0.1", 6379);
+
+  std::atomic<int> errors(0);
+  for (int i = 0; i < 4; ++i)
+    ping(client, errors);
+  EXPECT_EQ(errors, 0);
+
+  //! 5 PINGs are above the high watermark
+  ping(client, errors);
+  EXPECT_EQ(errors, 1);
+  expect_depth(client, 4 * PING_SIZE, 4);
+
+  client.commit();
+  EXPECT_EQ(tcp_client->written().size(), 4 * PING_SIZE);
+
+  //! still above the low watermark: the saturation applies
+  tcp_client->feed("+PONG\r\n");
+  ping(client, errors);
+  EXPECT_EQ(errors, 2);
+  expect_depth(client, 3 * PING_SIZE, 3);
+
+  //! below the low watermark: the saturation is cleared
+  tcp_client->feed("+PONG\r\n");
+  ping(client, errors);
+  EXPECT_EQ(errors, 2);
+  expect_depth(client, 3 * PING_SIZE, 3);
+}
+
+TEST(ClientBackpressure, OversizedRequest) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.set_backpressure(bytes_limits(cpp_redis::backpressure_policy::fail, 64, 32));
+  client.connect("127.0.0.1", 6379);
+
+  //! above the high watermark on its own, with nothing pending
+  std::atomic<int> errors(0);
+  client.set("key", std::string(100, 'v'), [&errors](cpp_redis::reply& reply) {
+    if (reply.is_error())
+      ++errors;
+  });
+  EXPECT_EQ(errors, 0);
+
+  client.commit();
+  tcp_client->feed("+OK\r\n");
+  expect_depth(client, 0, 0);
+
+  //! the client is not left saturated
+  ping(client, errors);
+  EXPECT_EQ(errors, 0);
+  expect_depth(client, PING_SIZE, 1);
+
+  //! neither by a batch above the high watermark, the other pending commands being below the low watermark
+  cpp_redis::batch commands;
+  for (int i = 0; i < 5; ++i)
+    commands.send({"PING"});
+
+  std::vector<cpp_redis::reply> replies;
+  client.send_batch(commands, [&replies](std::vector<cpp_redis::reply>& batch_replies) { replies = std::move(batch_replies); });
+  expect_depth(client, 6 * PING_SIZE, 6);
+
+  tcp_client->feed("+PONG\r\n+PONG\r\n+PONG\r\n+PONG\r\n+PONG\r\n+PONG\r\n");
+  ASSERT_EQ(replies.size(), 5U);
+  EXPECT_FALSE(replies[0].is_error());
+  expect_depth(client, 0, 0);
+
+  ping(client, errors);
+  EXPECT_EQ(errors, 0);
+}
+
+TEST(ClientBackpressure, BlockPolicy) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.set_backpressure(commands_limits(cpp_redis::backpressure_policy::block, 2, 1));
+  client.connect("127.0.0.1", 6379);
+
+  std::atomic<int> errors(0);
+  ping(client, errors);
+  ping(client, errors);
+
+  //! the blocked senders commit the pending commands
+  auto first  = std::async(std::launch::async, [&] { ping(client, errors); });
+  auto second = std::async(std::launch::async, [&] { ping(client, errors); });
+  EXPECT_EQ(first.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+  EXPECT_EQ(second.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+  EXPECT_EQ(tcp_client->written().size(), 2 * PING_SIZE);
+  expect_depth(client, 2 * PING_SIZE, 2);
+
+  //! both senders are woken: only one of them fits below the high watermark
+  tcp_client->feed("+PONG\r\n");
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  bool first_ready  = first.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready;
+  bool second_ready = second.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready;
+  EXPECT_NE(first_ready, second_ready);
+  expect_depth(client, 2 * PING_SIZE, 2);
+
+  tcp_client->feed("+PONG\r\n");
+  ASSERT_EQ(first.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  ASSERT_EQ(second.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  expect_depth(client, 2 * PING_SIZE, 2);
+  EXPECT_EQ(errors, 0);
+}
+
+TEST(ClientBackpressure, BlockPolicyFromCallback) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.set_backpressure(commands_limits(cpp_redis::backpressure_policy::block, 2, 0));
+  client.connect("127.0.0.1", 6379);
+
+  //! the callback of the first PING chains two PINGs: the second reaches the high watermark while the replies that
+  //! would clear the saturation can only be received once the callback returns
+  std::atomic<int> errors(0);
+  client.ping([&](cpp_redis::reply&) {
+    ping(client, errors);
+    ping(client, errors);
+  });
+  ping(client, errors);
+  client.commit();
+
+  tcp_client->feed("+PONG\r\n");
+  expect_depth(client, 3 * PING_SIZE, 3);
+
+  client.commit();
+  EXPECT_EQ(tcp_client->written().size(), 4 * PING_SIZE);
+
+  tcp_client->feed("+PONG\r\n+PONG\r\n+PONG\r\n");
+  expect_depth(client, 0, 0);
+  EXPECT_EQ(errors, 0);
+}
+
+TEST(ClientBackpressure, CallbackPolicy) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+
+  std::vector<std::pair<bool, std::size_t>> events;
+  auto limits     = commands_limits(cpp_redis::backpressure_policy::callback, 2, 1);
+  limits.callback = [&events](bool saturated, const cpp_redis::pending_depth& depth) {
+    events.emplace_back(saturated, depth.uCommands);
+  };
+  client.set_backpressure(limits);
+  client.connect("127.0.0.1", 6379);
+
+  //! the commands above the high watermark are still sent, the saturation being reported once
+  std::atomic<int> errors(0);
+  for (int i = 0; i < 4; ++i)
+    ping(client, errors);
+  EXPECT_EQ(errors, 0);
+  ASSERT_EQ(events.size(), 1U);
+  EXPECT_EQ(events[0], std::make_pair(true, std::size_t(3)));
+
+  client.commit();
+  EXPECT_EQ(tcp_client->written().size(), 4 * PING_SIZE);
+
+  tcp_client->feed("+PONG\r\n+PONG\r\n");
+  EXPECT_EQ(events.size(), 1U);
+
+  tcp_client->feed("+PONG\r\n");
+  ASSERT_EQ(events.size(), 2U);
+  EXPECT_EQ(events[1], std::make_pair(false, std::size_t(1)));
+}
@@ -0,0 +1,216 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/batch.hpp>
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+static const std::string PING = "*1\r\n$4\r\nPING\r\n";
+
+//! \return batch of three commands
+static cpp_redis::batch
+make_batch(void) {
+  cpp_redis::batch commands;
+  commands.send({"SET", "key", "value"});
+  commands.send({"GET", "key"});
+  commands.send({"INCR", "counter"});
+  return commands;
+}
+
+//! \return the encoded command of the batch at the given index
+static std::string
+frame(const cpp_redis::batch& commands, std::size_t uIndex) {
+  return std::string(commands.get_buffer().data() + commands.get_offset(uIndex), commands.get_size(uIndex));
+}
+
+static void
+expect_replies(const std::vector<cpp_redis::reply>& replies) {
+  ASSERT_EQ(replies.size(), 3U);
+  EXPECT_EQ(replies[0].as_string(), "OK");
+  EXPECT_EQ(replies[1].as_string(), "value");
+  EXPECT_EQ(replies[2].as_integer(), 1);
+}
+
+TEST(ClientBatch, SingleWrite) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  cpp_redis::batch commands = make_batch();
+  const std::vector<char>& vctBuffer = commands.get_buffer();
+
+  //! the commands submitted before the batch are written first, in the same write
+  client.ping();
+  client.send_batch(commands, nullptr);
+
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->written(), PING + std::string(vctBuffer.begin(), vctBuffer.end()));
+
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, PING.size() + vctBuffer.size());
+  EXPECT_EQ(depth.uCommands, 4U);
+}
+
+TEST(ClientBatch, RepliesAggregated) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  int calls = 0;
+  std::vector<cpp_redis::reply> replies;
+  client.send_batch(make_batch(), [&](std::vector<cpp_redis::reply>& batch_replies) {
+    ++calls;
+    replies = std::move(batch_replies);
+  });
+
+  //! the callback is called once, with all the replies in order
+  tcp_client->feed("+OK\r\n$5\r\nvalue\r\n");
+  EXPECT_EQ(calls, 0);
+
+  tcp_client->feed(":1\r\n");
+  EXPECT_EQ(calls, 1);
+  expect_replies(replies);
+
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, 0U);
+  EXPECT_EQ(depth.uCommands, 0U);
+}
+
+TEST(ClientBatch, Future) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  auto future = client.send_batch(make_batch());
+
+  tcp_client->feed("+OK\r\n$5\r\nvalue\r\n");
+  EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+  tcp_client->feed(":1\r\n");
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  expect_replies(future.get());
+}
+
+TEST(ClientBatch, EmptyBatch) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  auto future = client.send_batch(cpp_redis::batch());
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_TRUE(future.get().empty());
+  EXPECT_EQ(tcp_client->writes(), 0U);
+}
+
+TEST(ClientBatch, ReplayedPerCommand) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379, nullptr, 0, 1, 0);
+
+  cpp_redis::batch commands = make_batch();
+  auto future = client.send_batch(commands);
+
+  //! only the commands still waiting for their reply are replayed, each from its own frame
+  tcp_client->feed("+OK\r\n");
+  tcp_client->drop();
+  ASSERT_TRUE(client.is_connected());
+
+  const std::vector<char>& vctBuffer = commands.get_buffer();
+  EXPECT_EQ(tcp_client->written(), std::string(vctBuffer.begin(), vctBuffer.end()) + frame(commands, 1) + frame(commands, 2));
+
+  tcp_client->feed("$5\r\nvalue\r\n:1\r\n");
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  expect_replies(future.get());
+}
+
+TEST(ClientBatch, FailedWithoutReplay) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.set_replay_enabled(false);
+  client.connect("127.0.0.1", 6379, nullptr, 0, 1, 0);
+
+  cpp_redis::batch commands = make_batch();
+  auto future = client.send_batch(commands);
+
+  tcp_client->feed("+OK\r\n");
+  tcp_client->drop();
+
+  const std::vector<char>& vctBuffer = commands.get_buffer();
+  EXPECT_EQ(tcp_client->written(), std::string(vctBuffer.begin(), vctBuffer.end()));
+
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  std::vector<cpp_redis::reply> replies = future.get();
+  ASSERT_EQ(replies.size(), 3U);
+  EXPECT_EQ(replies[0].as_string(), "OK");
+  EXPECT_TRUE(replies[1].is_error());
+  EXPECT_EQ(replies[1].as_string(), "network failure");
+  EXPECT_TRUE(replies[2].is_error());
+}
+
+TEST(ClientBatch, FailFast) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+
+  cpp_redis::backpressure_limits limits;
+  limits.uHighBytes    = 0;
+  limits.uLowBytes     = 0;
+  limits.uHighCommands = 3;
+  limits.uLowCommands  = 1;
+  limits.ePolicy       = cpp_redis::backpressure_policy::fail;
+  client.set_backpressure(limits);
+  client.connect("127.0.0.1", 6379);
+
+  client.ping();
+  client.ping();
+
+  //! the whole batch fails right away, nothing being written nor accounted for
+  auto future = client.send_batch(make_batch());
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  std::vector<cpp_redis::reply> replies = future.get();
+  ASSERT_EQ(replies.size(), 3U);
+  for (const auto& reply : replies) {
+    EXPECT_TRUE(reply.is_error());
+    EXPECT_EQ(reply.as_string(), "too many pending commands");
+  }
+
+  EXPECT_EQ(tcp_client->written(), "");
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, 2 * PING.size());
+  EXPECT_EQ(depth.uCommands, 2U);
+
+  //! accepted again once the pending commands completed
+  client.commit();
+  tcp_client->feed("+PONG\r\n+PONG\r\n");
+
+  future = client.send_batch(make_batch());
+  tcp_client->feed("+OK\r\n$5\r\nvalue\r\n:1\r\n");
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  expect_replies(future.get());
+}
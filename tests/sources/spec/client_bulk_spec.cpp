@@ -0,0 +1,184 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+static std::string
+encode(const std::vector<std::string>& cmd) {
+  std::string encoded = "*" + std::to_string(cmd.size()) + "\r\n";
+
+  for (const auto& part : cmd)
+    encoded += "$" + std::to_string(part.size()) + "\r\n" + part + "\r\n";
+
+  return encoded;
+}
+
+//!
+//! client connected to a fake tcp client, recording the merged replies passed to its callbacks
+//!
+struct bulk_fixture {
+  bulk_fixture(std::size_t uMaxArgs, std::size_t uMaxBytes)
+  : tcp_client(std::make_shared<fake_tcp_client>())
+  , client(tcp_client) {
+    client.set_bulk_split_limits(uMaxArgs, uMaxBytes);
+    client.connect("127.0.0.1", 6379);
+  }
+
+  cpp_redis::client::reply_callback_t
+  callback(void) {
+    return [this](cpp_redis::reply& reply) { replies.push_back(reply); };
+  }
+
+  std::shared_ptr<fake_tcp_client> tcp_client;
+  cpp_redis::client                client;
+  std::vector<cpp_redis::reply>    replies;
+};
+
+TEST(ClientBulk, SplitByArgs) {
+  bulk_fixture fixture(2, 0);
+
+  std::vector<std::string> members = {"a", "b", "c", "d", "e"};
+  fixture.client.sadd("set", members.begin(), members.end(), fixture.callback());
+  fixture.client.commit();
+
+  EXPECT_EQ(fixture.tcp_client->written(),
+      encode({"SADD", "set", "a", "b"}) + encode({"SADD", "set", "c", "d"}) + encode({"SADD", "set", "e"}));
+
+  //! the callback is called once, with the sum of the integer replies
+  fixture.tcp_client->feed(":2\r\n:1\r\n");
+  EXPECT_TRUE(fixture.replies.empty());
+
+  fixture.tcp_client->feed(":0\r\n");
+  ASSERT_EQ(fixture.replies.size(), 1U);
+  ASSERT_TRUE(fixture.replies[0].is_integer());
+  EXPECT_EQ(fixture.replies[0].as_integer(), 3);
+}
+
+TEST(ClientBulk, PairsCountForTwo) {
+  bulk_fixture fixture(4, 0);
+
+  std::vector<std::pair<std::string, std::string>> scores = {{"1", "a"}, {"2", "b"}, {"3", "c"}};
+  fixture.client.zadd("zset", {"NX"}, scores.begin(), scores.end(), fixture.callback());
+  fixture.client.commit();
+
+  EXPECT_EQ(fixture.tcp_client->written(),
+      encode({"ZADD", "zset", "NX", "1", "a", "2", "b"}) + encode({"ZADD", "zset", "NX", "3", "c"}));
+
+  fixture.tcp_client->feed(":2\r\n:1\r\n");
+  ASSERT_EQ(fixture.replies.size(), 1U);
+  EXPECT_EQ(fixture.replies[0].as_integer(), 3);
+}
+
+TEST(ClientBulk, SplitByBytes) {
+  bulk_fixture fixture(0, 300);
+
+  //! the limit is checked before adding a pair: the first command only exceeds it with its second pair
+  std::string value(200, 'v');
+  std::vector<std::pair<std::string, std::string>> pairs = {{"k1", value}, {"k2", value}, {"k3", value}};
+  fixture.client.mset(pairs.begin(), pairs.end(), fixture.callback());
+  fixture.client.commit();
+
+  EXPECT_EQ(fixture.tcp_client->written(),
+      encode({"MSET", "k1", value, "k2", value}) + encode({"MSET", "k3", value}));
+
+  //! non integer replies are passed as is
+  fixture.tcp_client->feed("+OK\r\n+OK\r\n");
+  ASSERT_EQ(fixture.replies.size(), 1U);
+  ASSERT_TRUE(fixture.replies[0].is_simple_string());
+  EXPECT_EQ(fixture.replies[0].as_string(), "OK");
+}
+
+TEST(ClientBulk, NoLimits) {
+  bulk_fixture fixture(0, 0);
+
+  std::vector<std::string> members = {"a", "b", "c"};
+  fixture.client.sadd("set", members.begin(), members.end(), fixture.callback());
+  fixture.client.commit();
+
+  EXPECT_EQ(fixture.tcp_client->written(), encode({"SADD", "set", "a", "b", "c"}));
+}
+
+TEST(ClientBulk, BooleanMerge) {
+  bulk_fixture fixture(1, 0);
+
+  std::vector<std::string> elements = {"a", "b", "c"};
+  fixture.client.pfadd("hll", elements.begin(), elements.end(), fixture.callback());
+  fixture.client.pfadd("hll", elements.begin(), elements.end(), fixture.callback());
+  fixture.client.commit();
+
+  EXPECT_EQ(fixture.tcp_client->written().size(), 6 * encode({"PFADD", "hll", "a"}).size());
+
+  //! 1 if any of the commands altered the structure, 0 otherwise
+  fixture.tcp_client->feed(":0\r\n:1\r\n:1\r\n:0\r\n:0\r\n:0\r\n");
+  ASSERT_EQ(fixture.replies.size(), 2U);
+  EXPECT_EQ(fixture.replies[0].as_integer(), 1);
+  EXPECT_EQ(fixture.replies[1].as_integer(), 0);
+}
+
+TEST(ClientBulk, FirstErrorKept) {
+  bulk_fixture fixture(1, 0);
+
+  std::vector<std::string> members = {"a", "b", "c", "d"};
+  fixture.client.sadd("set", members.begin(), members.end(), fixture.callback());
+  fixture.client.commit();
+
+  fixture.tcp_client->feed(":1\r\n-WRONGTYPE first\r\n:1\r\n-ERR second\r\n");
+  ASSERT_EQ(fixture.replies.size(), 1U);
+  ASSERT_TRUE(fixture.replies[0].is_error());
+  EXPECT_EQ(fixture.replies[0].as_string(), "WRONGTYPE first");
+}
+
+TEST(ClientBulk, EmptyRange) {
+  bulk_fixture fixture(2, 0);
+
+  //! a single command without elements is sent, to get the reply redis gives to it
+  std::vector<std::string> members;
+  fixture.client.sadd("set", members.begin(), members.end(), fixture.callback());
+  fixture.client.commit();
+
+  EXPECT_EQ(fixture.tcp_client->written(), encode({"SADD", "set"}));
+
+  fixture.tcp_client->feed("-ERR wrong number of arguments for 'sadd' command\r\n");
+  ASSERT_EQ(fixture.replies.size(), 1U);
+  EXPECT_TRUE(fixture.replies[0].is_error());
+}
+
+TEST(ClientBulk, Future) {
+  bulk_fixture fixture(2, 0);
+
+  std::vector<std::string> members = {"a", "b", "c"};
+  auto future = fixture.client.sadd("set", members.begin(), members.end());
+  fixture.client.commit();
+
+  fixture.tcp_client->feed(":2\r\n:1\r\n");
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_EQ(future.get().as_integer(), 3);
+}
@@ -0,0 +1,97 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+static std::string
+encode(const std::vector<std::string>& cmd) {
+  std::string encoded = "*" + std::to_string(cmd.size()) + "\r\n";
+
+  for (const auto& part : cmd)
+    encoded += "$" + std::to_string(part.size()) + "\r\n" + part + "\r\n";
+
+  return encoded;
+}
+
+TEST(ClientCommands, FixedArguments) {
+  auto tcp_client = std::make_shared<cpp_redis::helpers::fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  client.get("key", nullptr);
+  client.hset("key", "field", "value", nullptr);
+  client.expire("key", 60, nullptr);
+  client.commit();
+
+  EXPECT_EQ(tcp_client->written(),
+      encode({"GET", "key"}) + encode({"HSET", "key", "field", "value"}) + encode({"EXPIRE", "key", "60"}));
+}
+
+TEST(ClientCommands, VariableArguments) {
+  auto tcp_client = std::make_shared<cpp_redis::helpers::fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  client.del({"a", "b", "c"}, nullptr);
+  client.blpop({"a", "b"}, 5, nullptr);
+  client.hmset("key", {{"f1", "v1"}, {"f2", "v2"}}, nullptr);
+  client.set_advanced("key", "value", true, 10, false, 0, true, false, nullptr);
+  client.commit();
+
+  EXPECT_EQ(tcp_client->written(),
+      encode({"DEL", "a", "b", "c"}) + encode({"BLPOP", "a", "b", "5"}) +
+          encode({"HMSET", "key", "f1", "v1", "f2", "v2"}) + encode({"SET", "key", "value", "EX", "10", "NX"}));
+}
+
+TEST(ClientCommands, SharedValue) {
+  auto tcp_client = std::make_shared<cpp_redis::helpers::fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  client.hset("key", "field", std::make_shared<const std::string>("value"), nullptr);
+  client.commit();
+
+  EXPECT_EQ(tcp_client->written(), encode({"HSET", "key", "field", "value"}));
+}
+
+TEST(ClientCommands, FutureOptionalArguments) {
+  auto tcp_client = std::make_shared<cpp_redis::helpers::fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  cpp_redis::client::reply_future_t get_future  = client.get("key");
+  cpp_redis::client::reply_future_t scan_future = client.scan(0, "k*", 10);
+  client.commit();
+
+  EXPECT_EQ(tcp_client->written(), encode({"GET", "key"}) + encode({"SCAN", "0", "MATCH", "k*", "COUNT", "10"}));
+
+  tcp_client->feed("$5\r\nvalue\r\n*2\r\n$1\r\n0\r\n*0\r\n");
+  EXPECT_EQ(get_future.get().as_string(), "value");
+  EXPECT_TRUE(scan_future.get().is_array());
+}
@@ -0,0 +1,103 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+//! send a GET left queued, without committing it
+//! \return future set with the reply passed to its callback
+static std::future<cpp_redis::reply>
+get_queued(cpp_redis::client& client) {
+  auto ptrPromise = std::make_shared<std::promise<cpp_redis::reply>>();
+  client.get("stale", [ptrPromise](cpp_redis::reply& reply) { ptrPromise->set_value(reply); });
+  return ptrPromise->get_future();
+}
+
+//! check the queued GET failed without being written
+static void
+expect_failed(std::future<cpp_redis::reply>& future, const cpp_redis::client& client) {
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  cpp_redis::reply reply = future.get();
+  EXPECT_TRUE(reply.is_error());
+  EXPECT_EQ(reply.as_string(), "network failure");
+
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, 0U);
+  EXPECT_EQ(depth.uCommands, 0U);
+}
+
+TEST(ClientDisconnection, DisconnectFailsQueuedCommands) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  auto future = get_queued(client);
+  client.disconnect();
+  expect_failed(future, client);
+
+  client.connect("127.0.0.1", 6379);
+  client.ping();
+  client.commit();
+  EXPECT_EQ(tcp_client->written(), "*1\r\n$4\r\nPING\r\n");
+}
+
+TEST(ClientDisconnection, GiveUpFailsQueuedCommands) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+
+  auto future = get_queued(client);
+  tcp_client->drop();
+  expect_failed(future, client);
+
+  client.connect("127.0.0.1", 6379);
+  client.ping();
+  client.commit();
+  EXPECT_EQ(tcp_client->written(), "*1\r\n$4\r\nPING\r\n");
+}
+
+TEST(ClientDisconnection, AutoCommitCountersReset) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.connect("127.0.0.1", 6379);
+  client.set_auto_commit(0, 2);
+
+  auto future = get_queued(client);
+  client.disconnect();
+  expect_failed(future, client);
+
+  //! the failed GET must not count towards the threshold: one command is not enough to commit
+  client.connect("127.0.0.1", 6379);
+  client.ping();
+  EXPECT_EQ(tcp_client->written(), "");
+
+  client.ping();
+  client.commit();
+  EXPECT_EQ(tcp_client->written(), "*1\r\n$4\r\nPING\r\n*1\r\n$4\r\nPING\r\n");
+}
@@ -0,0 +1,113 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/core/client.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+using cpp_redis::helpers::fake_tcp_client;
+
+static const std::string GET_FIRST  = "*2\r\n$3\r\nGET\r\n$5\r\nfirst\r\n";
+static const std::string GET_SECOND = "*2\r\n$3\r\nGET\r\n$6\r\nsecond\r\n";
+
+//! send and commit a GET
+//! \return future set with the reply passed to its callback
+static std::future<cpp_redis::reply>
+get_sent(cpp_redis::client& client, const std::string& sKey) {
+  auto ptrPromise = std::make_shared<std::promise<cpp_redis::reply>>();
+  client.get(sKey, [ptrPromise](cpp_redis::reply& reply) { ptrPromise->set_value(reply); });
+  client.commit();
+  return ptrPromise->get_future();
+}
+
+//! connect, reconnecting once right away when the connection is dropped
+static void
+connect(cpp_redis::client& client) {
+  client.connect("127.0.0.1", 6379, nullptr, 0, 1, 0);
+}
+
+TEST(ClientReplay, PendingCommandsReplayed) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  connect(client);
+
+  auto futureFirst  = get_sent(client, "first");
+  auto futureSecond = get_sent(client, "second");
+  EXPECT_EQ(tcp_client->written(), GET_FIRST + GET_SECOND);
+
+  //! the reply received before the disconnection dequeues its command, which is not replayed
+  tcp_client->feed("$1\r\n1\r\n");
+  ASSERT_EQ(futureFirst.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_EQ(futureFirst.get().as_string(), "1");
+
+  tcp_client->drop();
+  ASSERT_TRUE(client.is_connected());
+  EXPECT_EQ(tcp_client->written(), GET_FIRST + GET_SECOND + GET_SECOND);
+
+  tcp_client->feed("$1\r\n2\r\n");
+  ASSERT_EQ(futureSecond.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_EQ(futureSecond.get().as_string(), "2");
+
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, 0U);
+  EXPECT_EQ(depth.uCommands, 0U);
+}
+
+TEST(ClientReplay, PendingCommandsFailedWithoutReplay) {
+  auto tcp_client = std::make_shared<fake_tcp_client>();
+  cpp_redis::client client(tcp_client);
+  client.set_replay_enabled(false);
+  connect(client);
+
+  auto futureFirst  = get_sent(client, "first");
+  auto futureSecond = get_sent(client, "second");
+  EXPECT_EQ(tcp_client->written(), GET_FIRST + GET_SECOND);
+
+  //! replies are still passed to the callbacks kept once the frames are dropped
+  tcp_client->feed("$1\r\n1\r\n");
+  ASSERT_EQ(futureFirst.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_EQ(futureFirst.get().as_string(), "1");
+
+  //! the command pending on reconnection fails instead of being written again
+  tcp_client->drop();
+  ASSERT_TRUE(client.is_connected());
+
+  ASSERT_EQ(futureSecond.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  cpp_redis::reply reply = futureSecond.get();
+  EXPECT_TRUE(reply.is_error());
+  EXPECT_EQ(reply.as_string(), "network failure");
+  EXPECT_EQ(tcp_client->written(), GET_FIRST + GET_SECOND);
+
+  client.sync_commit(std::chrono::seconds(5));
+  cpp_redis::pending_depth depth = client.get_pending_depth();
+  EXPECT_EQ(depth.uBytes, 0U);
+  EXPECT_EQ(depth.uCommands, 0U);
+
+  //! the connection is usable again
+  client.ping();
+  client.commit();
+  EXPECT_EQ(tcp_client->written(), GET_FIRST + GET_SECOND + "*1\r\n$4\r\nPING\r\n");
+}
@@ -0,0 +1,77 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/command_table.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+static std::string
+header(cpp_redis::command_id id) {
+  const cpp_redis::command_descriptor& command = cpp_redis::command_table::get(id);
+  return std::string(command.pHeader, command.uHeaderSize);
+}
+
+TEST(CommandTable, Header) {
+  EXPECT_EQ("$3\r\nSET\r\n", header(cpp_redis::command_id::set));
+  EXPECT_EQ("$6\r\nAPPEND\r\n", header(cpp_redis::command_id::append));
+  EXPECT_EQ("$6\r\nCLIENT\r\n$4\r\nLIST\r\n", header(cpp_redis::command_id::client_list));
+  EXPECT_EQ("$7\r\nCLUSTER\r\n$21\r\nCOUNT-FAILURE-REPORTS\r\n",
+    header(cpp_redis::command_id::cluster_count_failure_reports));
+
+  EXPECT_EQ(1U, cpp_redis::command_table::get(cpp_redis::command_id::set).uNbParts);
+  EXPECT_EQ(2U, cpp_redis::command_table::get(cpp_redis::command_id::client_list).uNbParts);
+}
+
+TEST(CommandTable, CompileTime) {
+  static_assert(cpp_redis::command_table::get(cpp_redis::command_id::get).nArity == 2, "GET takes a key");
+  static_assert(cpp_redis::command_table::has_flag(cpp_redis::command_id::get, cpp_redis::command_table::readonly),
+    "GET is readonly");
+  static_assert(cpp_redis::command_table::size() == static_cast<std::size_t>(cpp_redis::command_id::zunionstore) + 1,
+    "one descriptor per command");
+}
+
+TEST(CommandTable, Metadata) {
+  for (std::size_t i = 0; i < cpp_redis::command_table::size(); ++i) {
+    auto eCommand                                = static_cast<cpp_redis::command_id>(i);
+    const cpp_redis::command_descriptor& command = cpp_redis::command_table::get(eCommand);
+
+    //! the arity counts the name and the subcommand
+    EXPECT_GE(command.nArity < 0 ? -command.nArity : command.nArity, static_cast<int>(command.uNbParts));
+    //! a command is never both readonly and write
+    EXPECT_FALSE(cpp_redis::command_table::has_flag(eCommand, cpp_redis::command_table::readonly) &&
+                 cpp_redis::command_table::has_flag(eCommand, cpp_redis::command_table::write));
+    //! keys follow the name
+    if (command.nFirstKey) {
+      EXPECT_GE(command.nFirstKey, static_cast<int>(command.uNbParts));
+    }
+  }
+
+  const cpp_redis::command_descriptor& mset = cpp_redis::command_table::get(cpp_redis::command_id::mset);
+  EXPECT_EQ(1, mset.nFirstKey);
+  EXPECT_EQ(-1, mset.nLastKey);
+  EXPECT_EQ(2, mset.nKeyStep);
+
+  EXPECT_TRUE(cpp_redis::command_table::has_flag(cpp_redis::command_id::blpop, cpp_redis::command_table::blocking));
+  EXPECT_TRUE(cpp_redis::command_table::has_flag(cpp_redis::command_id::set, cpp_redis::command_table::write));
+  EXPECT_FALSE(cpp_redis::command_table::has_flag(cpp_redis::command_id::set, cpp_redis::command_table::readonly));
+}
@@ -0,0 +1,145 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/misc/mpsc_queue.hpp>
+#include <gtest/gtest.h>
+#include <helpers/counting_allocator.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(MpscQueue, Empty) {
+  cpp_redis::mpsc_queue<int> queue;
+  int value = 42;
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_EQ(value, 42);
+}
+
+TEST(MpscQueue, Fifo) {
+  cpp_redis::mpsc_queue<int> queue;
+
+  for (int i = 0; i < 10; ++i)
+    queue.push(int(i));
+
+  EXPECT_FALSE(queue.empty());
+
+  int value = -1;
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpscQueue, MoveOnly) {
+  cpp_redis::mpsc_queue<std::unique_ptr<int>> queue;
+
+  queue.push(std::unique_ptr<int>(new int(1)));
+  queue.push(std::unique_ptr<int>(new int(2)));
+
+  std::unique_ptr<int> value;
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(*value, 1);
+
+  //! remaining elements are released by the destructor
+}
+
+TEST(MpscQueue, RecycledNodes) {
+  cpp_redis::mpsc_queue<int> queue(4);
+  int value = -1;
+
+  //! warm up: the consumed nodes fill the ring
+  for (int i = 0; i < 4; ++i)
+    queue.push(int(i));
+  for (int i = 0; i < 4; ++i)
+    EXPECT_TRUE(queue.pop(value));
+
+  std::size_t uAllocations = cpp_redis::helpers::allocations();
+
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 4; ++i)
+      queue.push(int(i));
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_TRUE(queue.pop(value));
+      EXPECT_EQ(value, i);
+    }
+  }
+
+  EXPECT_EQ(cpp_redis::helpers::allocations(), uAllocations);
+}
+
+TEST(MpscQueue, NoFreeNodes) {
+  cpp_redis::mpsc_queue<int> queue(0);
+  int value = -1;
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 10; ++i)
+      queue.push(int(i));
+    for (int i = 0; i < 10; ++i) {
+      EXPECT_TRUE(queue.pop(value));
+      EXPECT_EQ(value, i);
+    }
+  }
+
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueue, ConcurrentProducers) {
+  static const int nb_producers = 8;
+  static const int nb_values    = 10000;
+
+  cpp_redis::mpsc_queue<int> queue;
+  std::vector<std::thread> producers;
+
+  for (int p = 0; p < nb_producers; ++p)
+    producers.emplace_back([&queue, p] {
+      for (int i = 0; i < nb_values; ++i)
+        queue.push(p * nb_values + i);
+    });
+
+  //! consume while producing: the values of each producer must come out in order
+  std::vector<int> next(nb_producers, 0);
+  int nb_popped = 0;
+  int value     = 0;
+
+  while (nb_popped < nb_producers * nb_values) {
+    if (!queue.pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    int producer = value / nb_values;
+    EXPECT_EQ(value % nb_values, next[producer]);
+    next[producer] = value % nb_values + 1;
+    ++nb_popped;
+  }
+
+  for (auto& producer : producers)
+    producer.join();
+
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,201 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/network/command_encoder.hpp>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+static std::string
+naive_encode(const std::vector<std::string>& cmd) {
+  std::string encoded = "*" + std::to_string(cmd.size()) + "\r\n";
+
+  for (const auto& part : cmd)
+    encoded += "$" + std::to_string(part.size()) + "\r\n" + part + "\r\n";
+
+  return encoded;
+}
+
+TEST(CommandEncoder, DigitsCount) {
+  EXPECT_EQ(1U, cpp_redis::network::command_encoder::digits_count(0));
+  EXPECT_EQ(1U, cpp_redis::network::command_encoder::digits_count(9));
+  EXPECT_EQ(2U, cpp_redis::network::command_encoder::digits_count(10));
+  EXPECT_EQ(4U, cpp_redis::network::command_encoder::digits_count(9999));
+  EXPECT_EQ(5U, cpp_redis::network::command_encoder::digits_count(10000));
+  EXPECT_EQ(9U, cpp_redis::network::command_encoder::digits_count(123456789));
+}
+
+TEST(CommandEncoder, WriteUnsigned) {
+  std::size_t values[] = {0, 7, 10, 42, 99, 100, 101, 999, 1000, 65535, 1234567, 4294967295U};
+
+  for (auto value : values) {
+    char buffer[32];
+    char* end = cpp_redis::network::command_encoder::write_unsigned(buffer, value);
+
+    EXPECT_EQ(std::to_string(value), std::string(buffer, end));
+  }
+}
+
+TEST(CommandEncoder, Encode) {
+  std::vector<std::vector<std::string>> cmds = {
+    {"PING"},
+    {"GET", "HELLO"},
+    {"SET", "key", ""},
+    {"SET", "key", std::string(1000, 'a')},
+    {"SET", "bin", std::string("a\0\r\nb", 5)}};
+
+  std::vector<char> buffer;
+  std::string expected;
+
+  for (const auto& cmd : cmds) {
+    EXPECT_EQ(naive_encode(cmd).size(), cpp_redis::network::command_encoder::encoded_size(cmd));
+
+    cpp_redis::network::command_encoder::encode(cmd, buffer);
+    expected += naive_encode(cmd);
+
+    //! commands are appended to the buffer
+    EXPECT_EQ(expected, std::string(buffer.begin(), buffer.end()));
+  }
+}
+
+TEST(CommandEncoder, ManyArguments) {
+  std::vector<std::string> cmd = {"MSET"};
+  for (int i = 0; i < 20; ++i)
+    cmd.push_back(std::to_string(i));
+
+  std::vector<char> buffer;
+  cpp_redis::network::command_encoder::encode(cmd, buffer);
+
+  EXPECT_EQ(naive_encode(cmd), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, ExtraArguments) {
+  std::vector<std::string> cmd = {"SET", "key"};
+  std::string value(100, 'v');
+
+  std::vector<char> buffer;
+  cpp_redis::network::command_encoder::encode(cmd, buffer, 1);
+  cpp_redis::network::command_encoder::encode_bulk(value.data(), value.size(), buffer);
+
+  EXPECT_EQ(naive_encode({"SET", "key", value}), std::string(buffer.begin(), buffer.end()));
+
+  //! argument count growing by a digit
+  cmd = {"MSET", "0", "1", "2", "3", "4", "5", "6", "7"};
+  buffer.clear();
+  cpp_redis::network::command_encoder::encode(cmd, buffer, 1);
+  cpp_redis::network::command_encoder::encode_bulk_header(value.size(), buffer);
+
+  cmd.push_back(value);
+  std::string expected = naive_encode(cmd);
+  EXPECT_EQ(expected.substr(0, expected.size() - value.size() - 2), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, CommandTable) {
+  const cpp_redis::command_descriptor& set         = cpp_redis::command_table::get(cpp_redis::command_id::set);
+  const cpp_redis::command_descriptor& client_list = cpp_redis::command_table::get(cpp_redis::command_id::client_list);
+  std::vector<char> buffer;
+
+  cpp_redis::network::command_encoder::encode(set, {"key", "value"}, buffer);
+  EXPECT_EQ(naive_encode({"SET", "key", "value"}), std::string(buffer.begin(), buffer.end()));
+
+  buffer.clear();
+  cpp_redis::network::command_encoder::encode(client_list, {}, buffer);
+  EXPECT_EQ(naive_encode({"CLIENT", "LIST"}), std::string(buffer.begin(), buffer.end()));
+
+  buffer.clear();
+  cpp_redis::network::command_encoder::encode(set, {"key"}, buffer, 1);
+  cpp_redis::network::command_encoder::encode_bulk("v", 1, buffer);
+  EXPECT_EQ(naive_encode({"SET", "key", "v"}), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, EncodeArgs) {
+  std::vector<char> buffer;
+  std::string key = "key";
+
+  cpp_redis::network::command_encoder::encode_args(buffer, "EXPIRE", key, 60);
+  EXPECT_EQ(naive_encode({"EXPIRE", "key", "60"}), std::string(buffer.begin(), buffer.end()));
+
+  buffer.clear();
+  cpp_redis::network::command_encoder::encode_args(buffer, cpp_redis::command_id::zadd, cpp_redis::string_ref(key), 1.5,
+    std::vector<char>{'m', '\0'});
+  EXPECT_EQ(naive_encode({"ZADD", "key", "1.5", std::string("m\0", 2)}), std::string(buffer.begin(), buffer.end()));
+
+  buffer.clear();
+  cpp_redis::network::command_encoder::encode_args(buffer, cpp_redis::command_id::client_list);
+  EXPECT_EQ(naive_encode({"CLIENT", "LIST"}), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, EncodeArgsNumbers) {
+  std::vector<char> buffer;
+
+  cpp_redis::network::command_encoder::encode_args(buffer, "N", 0, -1, std::numeric_limits<int64_t>::min(),
+    std::numeric_limits<uint64_t>::max(), static_cast<short>(-42), 0.1, -2.0);
+
+  EXPECT_EQ(naive_encode({"N", "0", "-1", "-9223372036854775808", "18446744073709551615", "-42", "0.10000000000000001",
+              "-2"}),
+    std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, EncodeArgsIntegerDigits) {
+  //! every number of digits, odd and even, around each power of 10
+  for (uint64_t power = 1; power <= 1000000000000000000ULL; power *= 10) {
+    for (int64_t value : {static_cast<int64_t>(power) - 1, static_cast<int64_t>(power), static_cast<int64_t>(power) + 7}) {
+      std::vector<char> buffer;
+      cpp_redis::network::command_encoder::encode_args(buffer, "N", value, -value, static_cast<uint64_t>(value));
+
+      EXPECT_EQ(naive_encode({"N", std::to_string(value), std::to_string(-value), std::to_string(value)}),
+        std::string(buffer.begin(), buffer.end()));
+    }
+  }
+}
+
+TEST(CommandEncoder, EncodeArgsFloat) {
+  std::vector<char> buffer;
+
+  cpp_redis::network::command_encoder::encode_args(buffer, "N", 0.1f, 0.5f);
+  EXPECT_EQ(naive_encode({"N", "0.100000001", "0.5"}), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, Frame) {
+  std::vector<char> buffer = {'x'};
+  std::size_t offset       = cpp_redis::network::command_encoder::begin_frame(buffer);
+  std::size_t nb_args      = cpp_redis::network::command_encoder::append_args(buffer, "HMSET", "key");
+
+  std::vector<std::pair<std::string, int>> elements = {{"a", 1}, {"b", 2}};
+  for (const auto& element : elements)
+    nb_args += cpp_redis::network::command_encoder::append_element(buffer, element);
+
+  cpp_redis::network::command_encoder::end_frame(buffer, offset, nb_args);
+
+  EXPECT_EQ(6U, nb_args);
+  EXPECT_EQ("x" + naive_encode({"HMSET", "key", "a", "1", "b", "2"}), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(CommandEncoder, EncodeArgsVector) {
+  std::vector<char> buffer;
+  std::vector<std::string> options = {"NX", "CH"};
+
+  cpp_redis::network::command_encoder::encode_args(buffer, cpp_redis::command_id::zadd, "key", options, 1, "m");
+  EXPECT_EQ(naive_encode({"ZADD", "key", "NX", "CH", "1", "m"}), std::string(buffer.begin(), buffer.end()));
+}
@@ -0,0 +1,252 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _WIN32
+
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/network/posix_tcp_client.hpp>
+#include <cpp_redis/network/redis_connection.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using cpp_redis::network::posix_tcp_client;
+using cpp_redis::network::tcp_client_iface;
+
+//!
+//! server accepting a single connection on the loopback interface
+//!
+class local_server {
+public:
+  local_server(void) {
+    m_nListenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in addr     = {};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    ::bind(m_nListenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    ::listen(m_nListenFd, 1);
+
+    socklen_t uLen = sizeof(addr);
+    ::getsockname(m_nListenFd, reinterpret_cast<sockaddr*>(&addr), &uLen);
+    m_uPort = ntohs(addr.sin_port);
+  }
+
+  ~local_server(void) {
+    close();
+    ::close(m_nListenFd);
+  }
+
+  std::uint32_t
+  port(void) const {
+    return m_uPort;
+  }
+
+  void
+  accept(void) {
+    m_nFd = ::accept(m_nListenFd, nullptr, nullptr);
+  }
+
+  //! \return the next size bytes received
+  std::string
+  receive(std::size_t uSize) {
+    std::string sData(uSize, '\0');
+    std::size_t uReceived = 0;
+
+    while (uReceived < uSize) {
+      ssize_t nRead = ::recv(m_nFd, &sData[uReceived], uSize - uReceived, 0);
+      if (nRead <= 0)
+        break;
+      uReceived += static_cast<std::size_t>(nRead);
+    }
+
+    sData.resize(uReceived);
+    return sData;
+  }
+
+  void
+  send(const std::string& sData) {
+    ::send(m_nFd, sData.data(), sData.size(), 0);
+  }
+
+  void
+  close(void) {
+    if (m_nFd >= 0)
+      ::close(m_nFd);
+    m_nFd = -1;
+  }
+
+private:
+  int           m_nListenFd = -1;
+  int           m_nFd       = -1;
+  std::uint32_t m_uPort     = 0;
+};
+
+static std::shared_ptr<const std::string>
+value(const std::string& sValue) {
+  return std::make_shared<const std::string>(sValue);
+}
+
+TEST(PosixTcpClient, WritesSegments) {
+  local_server server;
+  posix_tcp_client client;
+  client.connect("127.0.0.1", server.port(), 1000);
+  server.accept();
+
+  EXPECT_TRUE(client.is_connected());
+  EXPECT_TRUE(client.supports_segments());
+
+  std::size_t written = 0;
+  std::string buffer  = "<a|b|>";
+
+  tcp_client_iface::write_request request = {std::vector<char>(buffer.begin(), buffer.end()),
+      [&written](tcp_client_iface::write_result& result) {
+        EXPECT_TRUE(result.bSuccess);
+        written = result.nSizeWritten;
+      },
+      {{1, value("first")}, {3, value("")}, {5, value("last")}}};
+
+  //! the request is made of offsets and owned values: a copy stays valid once the original is gone
+  std::unique_ptr<tcp_client_iface::write_request> original(new tcp_client_iface::write_request(request));
+  tcp_client_iface::write_request copy = *original;
+  original.reset();
+
+  client.async_write(copy);
+
+  EXPECT_EQ(written, 15U);
+  EXPECT_EQ(server.receive(15), "<firsta|b|last>");
+}
+
+TEST(PosixTcpClient, WritesManySegments) {
+  local_server server;
+  posix_tcp_client client;
+  client.connect("127.0.0.1", server.port(), 0);
+  server.accept();
+
+  //! more buffers than a single sendmsg call writes, larger than the socket buffers
+  tcp_client_iface::write_request request = {std::vector<char>(5000, '.'), nullptr, {}};
+  std::string expected;
+  for (std::size_t i = 0; i < 5000; ++i) {
+    request.vctSegments.push_back({i, value(std::string(100, 'v'))});
+    expected += std::string(100, 'v') + ".";
+  }
+
+  auto received = std::async(std::launch::async, [&] { return server.receive(expected.size()); });
+  client.async_write(request);
+
+  EXPECT_EQ(received.get(), expected);
+}
+
+TEST(PosixTcpClient, Reads) {
+  local_server server;
+  posix_tcp_client client;
+  client.connect("127.0.0.1", server.port(), 0);
+  server.accept();
+
+  std::promise<std::string> read;
+  tcp_client_iface::read_request request = {4096, [&read](tcp_client_iface::read_result& result) {
+                                              EXPECT_TRUE(result.bSuccess);
+                                              read.set_value(std::string(result.vctBuffer.begin(), result.vctBuffer.end()));
+                                            }};
+  client.async_read(request);
+  server.send("+PONG\r\n");
+
+  auto future = read.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_EQ(future.get(), "+PONG\r\n");
+}
+
+TEST(PosixTcpClient, ConnectionLost) {
+  local_server server;
+  posix_tcp_client client;
+  client.connect("127.0.0.1", server.port(), 0);
+  server.accept();
+
+  std::promise<void> lost;
+  bool read_failed = false;
+  client.set_on_disconnection_handler([&lost] { lost.set_value(); });
+
+  tcp_client_iface::read_request request = {4096, [&read_failed](tcp_client_iface::read_result& result) {
+                                              read_failed = !result.bSuccess;
+                                            }};
+  client.async_read(request);
+  server.close();
+
+  auto future = lost.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_TRUE(read_failed);
+  EXPECT_FALSE(client.is_connected());
+
+  tcp_client_iface::write_request write = {std::vector<char>(1, '.'), nullptr, {}};
+  EXPECT_THROW(client.async_write(write), cpp_redis::redis_error);
+}
+
+TEST(PosixTcpClient, Disconnect) {
+  local_server server;
+  posix_tcp_client client;
+  client.connect("127.0.0.1", server.port(), 0);
+  server.accept();
+
+  bool lost = false;
+  client.set_on_disconnection_handler([&lost] { lost = true; });
+
+  tcp_client_iface::read_request request = {4096, nullptr};
+  client.async_read(request);
+  client.disconnect(true);
+
+  EXPECT_FALSE(client.is_connected());
+  EXPECT_FALSE(lost);
+  EXPECT_EQ(server.receive(1), "");
+}
+
+TEST(PosixTcpClient, RedisConnectionSharedValue) {
+  local_server server;
+  auto tcp_client = std::make_shared<posix_tcp_client>();
+  cpp_redis::network::redis_connection connection(tcp_client);
+
+  connection.connect("127.0.0.1", server.port());
+  server.accept();
+
+  std::string large_value(__CPP_REDIS_SHARED_VALUE_MIN_SIZE * 2, 'v');
+  connection.send({"SET", "key"}, std::make_shared<const std::string>(large_value));
+  connection.send({"PING"});
+
+  std::string expected = "*3\r\n$3\r\nSET\r\n$3\r\nkey\r\n$" + std::to_string(large_value.size()) + "\r\n" + large_value
+                         + "\r\n*1\r\n$4\r\nPING\r\n";
+  auto received = std::async(std::launch::async, [&] { return server.receive(expected.size()); });
+  connection.commit();
+
+  EXPECT_EQ(received.get(), expected);
+  connection.disconnect(true);
+}
+
+#endif /* _WIN32 */
@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/network/redis_connection.hpp>
+#include <gtest/gtest.h>
+#include <helpers/fake_tcp_client.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//! large enough to be written as a separate segment
+static const std::string large_value(__CPP_REDIS_SHARED_VALUE_MIN_SIZE * 2, 'v');
+
+static std::string
+expected_frames(void) {
+  std::string sValue = "$" + std::to_string(large_value.size()) + "\r\n" + large_value + "\r\n";
+  return "*3\r\n$3\r\nSET\r\n$2\r\nk1\r\n" + sValue + "*3\r\n$3\r\nSET\r\n$2\r\nk2\r\n" + sValue + "*1\r\n$4\r\nPING\r\n";
+}
+
+static void
+send_frames(cpp_redis::network::redis_connection& connection) {
+  auto ptrValue = std::make_shared<const std::string>(large_value);
+
+  connection.connect();
+  connection.send({"SET", "k1"}, ptrValue);
+  connection.send({"SET", "k2"}, ptrValue);
+  connection.send({"PING"});
+  connection.commit();
+}
+
+TEST(RedisConnection, SharedValueCopied) {
+  auto tcp_client = std::make_shared<cpp_redis::helpers::fake_tcp_client>();
+  cpp_redis::network::redis_connection connection(tcp_client);
+
+  send_frames(connection);
+
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->segmented_writes(), 0U);
+  EXPECT_EQ(tcp_client->written(), expected_frames());
+}
+
+TEST(RedisConnection, SharedValueSegments) {
+  auto tcp_client = std::make_shared<cpp_redis::helpers::fake_tcp_client>(true);
+  cpp_redis::network::redis_connection connection(tcp_client);
+
+  send_frames(connection);
+
+  EXPECT_EQ(tcp_client->writes(), 1U);
+  EXPECT_EQ(tcp_client->segmented_writes(), 1U);
+  EXPECT_EQ(tcp_client->written(), expected_frames());
+}
@@ -0,0 +1,197 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/misc/error.hpp>
+#include <cpp_redis/misc/pooled_future.hpp>
+#include <gtest/gtest.h>
+#include <helpers/counting_allocator.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(PooledFuture, Invalid) {
+  cpp_redis::pooled_future<int> future;
+
+  EXPECT_FALSE(future.valid());
+  EXPECT_THROW(future.get(), cpp_redis::redis_error);
+}
+
+TEST(PooledFuture, SetThenGet) {
+  cpp_redis::pooled_promise<std::string> promise;
+  cpp_redis::pooled_future<std::string> future = promise.get_future();
+
+  EXPECT_TRUE(future.valid());
+  EXPECT_FALSE(future.is_ready());
+
+  promise.set_value("hello");
+
+  EXPECT_TRUE(future.is_ready());
+  EXPECT_EQ(future.get(), "hello");
+  EXPECT_FALSE(future.valid());
+}
+
+TEST(PooledFuture, GetThenSet) {
+  cpp_redis::pooled_promise<int> promise;
+  cpp_redis::pooled_future<int> future = promise.get_future();
+
+  //! long enough for the waiting thread to park
+  std::thread setter([promise]() mutable {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    promise.set_value(42);
+  });
+
+  EXPECT_EQ(future.get(), 42);
+  setter.join();
+}
+
+TEST(PooledFuture, WaitFor) {
+  cpp_redis::pooled_promise<int> promise;
+  cpp_redis::pooled_future<int> future = promise.get_future();
+
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+
+  promise.set_value(1);
+
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(10)), std::future_status::ready);
+  EXPECT_EQ(future.get(), 1);
+}
+
+TEST(PooledFuture, Exception) {
+  cpp_redis::pooled_promise<int> promise;
+  cpp_redis::pooled_future<int> future = promise.get_future();
+
+  promise.set_exception(std::make_exception_ptr(std::runtime_error("failure")));
+
+  EXPECT_THROW(future.get(), std::runtime_error);
+  EXPECT_FALSE(future.valid());
+}
+
+TEST(PooledFuture, SatisfiedOnce) {
+  cpp_redis::pooled_promise<int> promise;
+  cpp_redis::pooled_future<int> future = promise.get_future();
+
+  promise.set_value(1);
+
+  EXPECT_THROW(promise.set_value(2), cpp_redis::redis_error);
+  EXPECT_THROW(promise.get_future(), cpp_redis::redis_error);
+  EXPECT_EQ(future.get(), 1);
+}
+
+TEST(PooledFuture, BrokenPromise) {
+  cpp_redis::pooled_future<int> future;
+
+  {
+    cpp_redis::pooled_promise<int> promise;
+    cpp_redis::pooled_promise<int> copy = promise;
+    future                              = promise.get_future();
+  }
+
+  EXPECT_THROW(future.get(), cpp_redis::redis_error);
+}
+
+TEST(PooledFuture, CopiesShareState) {
+  cpp_redis::pooled_future<int> future;
+
+  {
+    cpp_redis::pooled_promise<int> promise;
+    future = promise.get_future();
+
+    cpp_redis::pooled_promise<int> copy = promise;
+    copy.set_value(7);
+  }
+
+  EXPECT_EQ(future.get(), 7);
+}
+
+TEST(PooledFuture, Recycled) {
+  //! slots are given back to the pool and reset before being reused
+  for (int i = 0; i < 1000; ++i) {
+    cpp_redis::pooled_promise<std::string> promise;
+    cpp_redis::pooled_future<std::string> future = promise.get_future();
+
+    EXPECT_FALSE(future.is_ready());
+    promise.set_value(std::to_string(i));
+    EXPECT_EQ(future.get(), std::to_string(i));
+  }
+}
+
+TEST(PooledFuture, RecycledWithoutAllocation) {
+  //! warm up the cache of the thread
+  for (int i = 0; i < 10; ++i) {
+    cpp_redis::pooled_promise<int> promise;
+    promise.get_future();
+  }
+
+  std::size_t uAllocations = cpp_redis::helpers::allocations();
+  for (int i = 0; i < 1000; ++i) {
+    cpp_redis::pooled_promise<int> promise;
+    cpp_redis::pooled_future<int> future = promise.get_future();
+    promise.set_value(int(i));
+    EXPECT_EQ(future.get(), i);
+  }
+
+  EXPECT_EQ(cpp_redis::helpers::allocations(), uAllocations);
+}
+
+TEST(PooledFuture, RecycledByOtherThread) {
+  static const int nb_values = 1000;
+
+  //! the slots are released by another thread, and go back to the shared pool through its cache
+  for (int round = 0; round < 3; ++round) {
+    std::vector<cpp_redis::pooled_promise<int>> promises(nb_values);
+    std::vector<cpp_redis::pooled_future<int>> futures;
+    for (auto& promise : promises)
+      futures.push_back(promise.get_future());
+
+    for (int i = 0; i < nb_values; ++i) {
+      EXPECT_FALSE(futures[i].is_ready());
+      promises[i].set_value(int(i));
+      EXPECT_EQ(futures[i].get(), i);
+    }
+    futures.clear();
+
+    std::thread releaser([&promises] { promises.clear(); });
+    releaser.join();
+  }
+}
+
+TEST(PooledFuture, ConcurrentSetters) {
+  static const int nb_values = 1000;
+
+  std::vector<cpp_redis::pooled_promise<int>> promises(nb_values);
+  std::vector<cpp_redis::pooled_future<int>> futures;
+  for (auto& promise : promises)
+    futures.push_back(promise.get_future());
+
+  std::thread setter([&promises] {
+    for (int i = 0; i < nb_values; ++i)
+      promises[i].set_value(int(i));
+  });
+
+  for (int i = 0; i < nb_values; ++i)
+    EXPECT_EQ(futures[i].get(), i);
+
+  setter.join();
+}
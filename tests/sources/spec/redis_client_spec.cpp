@@ -20,6 +20,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <functional>
+#include <memory>
 #include <thread>
 
 #include <cpp_redis/core/client.hpp>
@@ -270,6 +272,49 @@ TEST(RedisClient, MultipleSendPipeline) {
   client.sync_commit();
 }
 
+TEST(RedisClient, SendNullCallback) {
+  cpp_redis::client client;
+
+  client.connect();
+  AUTH(client);
+  //! nullptr also converts to the reply view callback, reply handler and shared value overloads
+  client.send({"SET", "HELLO", "SendNullCallback"}, nullptr);
+  client.send({"GET", "HELLO"}, [&](cpp_redis::reply& reply) {
+    EXPECT_TRUE(reply.is_string());
+    EXPECT_TRUE(reply.as_string() == "SendNullCallback");
+  });
+  client.sync_commit();
+}
+
+TEST(RedisClient, SendMoveOnlyCallback) {
+  cpp_redis::client client;
+
+  client.connect();
+  AUTH(client);
+  std::unique_ptr<std::string> ptrExpected(new std::string("PONG"));
+  client.send({"PING"}, std::bind([](const std::unique_ptr<std::string>& ptrPong, cpp_redis::reply& reply) {
+    EXPECT_TRUE(reply.is_string());
+    EXPECT_TRUE(reply.as_string() == *ptrPong);
+  },
+    std::move(ptrExpected), std::placeholders::_1));
+  client.sync_commit();
+}
+
+TEST(RedisClient, SendBatch) {
+  cpp_redis::client client;
+
+  client.connect();
+  AUTH(client);
+  cpp_redis::batch commands;
+  commands.send({"SET", "HELLO", "SendBatch"}).send({"GET", "HELLO"}).send({"PING"});
+
+  std::vector<cpp_redis::reply> replies = client.send_batch(commands).get();
+  ASSERT_EQ(replies.size(), 3U);
+  EXPECT_TRUE(replies[0].as_string() == "OK");
+  EXPECT_TRUE(replies[1].as_string() == "SendBatch");
+  EXPECT_TRUE(replies[2].as_string() == "PONG");
+}
+
 TEST(RedisClient, DisconnectionHandlerWithQuit) {
   cpp_redis::client client;
   std::condition_variable cv;
@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/reply_decoder.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template <typename T>
+static T
+decode(const std::string& buffer) {
+  return cpp_redis::decode_reply<T>(cpp_redis::reply_view(buffer.data(), buffer.size()));
+}
+
+TEST(ReplyDecoder, String) {
+  EXPECT_EQ("hello", decode<std::string>("$5\r\nhello\r\n"));
+  EXPECT_EQ("OK", decode<std::string>("+OK\r\n"));
+  EXPECT_THROW(decode<std::string>("$-1\r\n"), cpp_redis::redis_error);
+  EXPECT_THROW(decode<std::string>(":1\r\n"), cpp_redis::redis_error);
+}
+
+TEST(ReplyDecoder, Integer) {
+  EXPECT_EQ(42, decode<int64_t>(":42\r\n"));
+  EXPECT_EQ(-7, decode<int>("$2\r\n-7\r\n"));
+  EXPECT_EQ(true, decode<bool>(":1\r\n"));
+  EXPECT_THROW(decode<int64_t>("$2\r\n4a\r\n"), cpp_redis::redis_error);
+  EXPECT_THROW(decode<int64_t>("$0\r\n\r\n"), cpp_redis::redis_error);
+  EXPECT_THROW(decode<int64_t>("*0\r\n"), cpp_redis::redis_error);
+}
+
+TEST(ReplyDecoder, IntegerOverflow) {
+  EXPECT_EQ(std::numeric_limits<int64_t>::min(), decode<int64_t>("$20\r\n-9223372036854775808\r\n"));
+  EXPECT_THROW(decode<int64_t>("$20\r\n99999999999999999999\r\n"), cpp_redis::redis_error);
+  EXPECT_THROW(decode<int64_t>("$19\r\n9223372036854775808\r\n"), cpp_redis::redis_error);
+}
+
+TEST(ReplyDecoder, IntegerOutOfRange) {
+  EXPECT_EQ(2147483647, decode<int>(":2147483647\r\n"));
+  EXPECT_THROW(decode<int>(":3000000000\r\n"), cpp_redis::redis_error);
+  EXPECT_THROW(decode<int>(":-3000000000\r\n"), cpp_redis::redis_error);
+  EXPECT_EQ(3000000000U, decode<uint32_t>(":3000000000\r\n"));
+  EXPECT_THROW(decode<uint32_t>(":-1\r\n"), cpp_redis::redis_error);
+  EXPECT_THROW(decode<uint64_t>(":-1\r\n"), cpp_redis::redis_error);
+  EXPECT_EQ(false, decode<bool>(":0\r\n"));
+  EXPECT_THROW(decode<bool>(":2\r\n"), cpp_redis::redis_error);
+}
+
+TEST(ReplyDecoder, Double) {
+  EXPECT_DOUBLE_EQ(1.5, decode<double>("$3\r\n1.5\r\n"));
+  EXPECT_DOUBLE_EQ(3.0, decode<double>(":3\r\n"));
+  EXPECT_TRUE(decode<double>("$4\r\n-inf\r\n") < 0);
+  EXPECT_THROW(decode<double>("$3\r\n1.x\r\n"), cpp_redis::redis_error);
+}
+
+TEST(ReplyDecoder, Vector) {
+  auto values = decode<std::vector<std::string>>("*3\r\n$1\r\na\r\n+b\r\n$1\r\nc\r\n");
+
+  ASSERT_EQ(3U, values.size());
+  EXPECT_EQ("a", values[0]);
+  EXPECT_EQ("b", values[1]);
+  EXPECT_EQ("c", values[2]);
+
+  auto nested = decode<std::vector<std::vector<int64_t>>>("*2\r\n*1\r\n:1\r\n*2\r\n:2\r\n:3\r\n");
+  ASSERT_EQ(2U, nested.size());
+  EXPECT_EQ(3, nested[1][1]);
+}
+
+TEST(ReplyDecoder, Pairs) {
+  auto scores = decode<std::vector<std::pair<std::string, double>>>("*4\r\n$1\r\na\r\n$3\r\n1.5\r\n$1\r\nb\r\n$1\r\n2\r\n");
+
+  ASSERT_EQ(2U, scores.size());
+  EXPECT_EQ("a", scores[0].first);
+  EXPECT_DOUBLE_EQ(1.5, scores[0].second);
+  EXPECT_EQ("b", scores[1].first);
+  EXPECT_DOUBLE_EQ(2, scores[1].second);
+
+  EXPECT_THROW((decode<std::vector<std::pair<std::string, double>>>("*1\r\n$1\r\na\r\n")), cpp_redis::redis_error);
+
+  auto pair = decode<std::pair<std::string, std::string>>("*2\r\n$4\r\nlist\r\n$5\r\nvalue\r\n");
+  EXPECT_EQ("list", pair.first);
+  EXPECT_EQ("value", pair.second);
+}
+
+TEST(ReplyDecoder, Maps) {
+  std::string buffer = "*4\r\n$2\r\nf1\r\n$2\r\nv1\r\n$2\r\nf2\r\n$2\r\nv2\r\n";
+
+  auto hash = decode<std::unordered_map<std::string, std::string>>(buffer);
+  ASSERT_EQ(2U, hash.size());
+  EXPECT_EQ("v1", hash["f1"]);
+  EXPECT_EQ("v2", hash["f2"]);
+
+  auto ordered = decode<std::map<std::string, std::string>>(buffer);
+  ASSERT_EQ(2U, ordered.size());
+  EXPECT_EQ("f1", ordered.begin()->first);
+}
+
+TEST(ReplyDecoder, Reply) {
+  auto reply = decode<cpp_redis::reply>("*2\r\n:1\r\n$-1\r\n");
+
+  ASSERT_TRUE(reply.is_array());
+  EXPECT_EQ(1, reply.as_array()[0].as_integer());
+  EXPECT_TRUE(reply.as_array()[1].is_null());
+}
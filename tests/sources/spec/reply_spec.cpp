@@ -150,3 +150,101 @@ TEST(Reply, Array) {
   EXPECT_THROW(r.as_integer(), cpp_redis::redis_error);
   EXPECT_EQ(r.get_type(), cpp_redis::reply::type::array);
 }
+
+TEST(Reply, MoveArray) {
+  std::vector<cpp_redis::reply> rows;
+  rows.emplace_back(std::string(100, 'a'), cpp_redis::reply::string_type::bulk_string);
+  const char* data = rows[0].as_string().data();
+
+  cpp_redis::reply r(std::move(rows));
+  r << cpp_redis::reply(42);
+
+  cpp_redis::reply moved(std::move(r));
+
+  ASSERT_EQ(moved.is_array(), true);
+  ASSERT_EQ(moved.as_array().size(), 2U);
+  EXPECT_EQ(moved.as_array()[0].as_string().data(), data);
+  EXPECT_EQ(moved.as_array()[1].as_integer(), 42);
+}
+
+TEST(Reply, CompactLayout) {
+  //! only one of the string, rows or integer is stored at once
+  EXPECT_LE(sizeof(cpp_redis::reply), sizeof(std::string) + sizeof(int64_t));
+}
+
+TEST(Reply, ChangeType) {
+  cpp_redis::reply r(std::string(100, 'a'), cpp_redis::reply::string_type::bulk_string);
+
+  r.set(42);
+  EXPECT_EQ(r.is_integer(), true);
+  EXPECT_EQ(r.as_integer(), 42);
+
+  r << cpp_redis::reply("str", cpp_redis::reply::string_type::simple_string);
+  ASSERT_EQ(r.is_array(), true);
+  ASSERT_EQ(r.as_array().size(), 1U);
+  EXPECT_EQ(r.as_array()[0].as_string(), "str");
+
+  r.set("err", cpp_redis::reply::string_type::error);
+  EXPECT_EQ(r.is_error(), true);
+  EXPECT_EQ(r.error(), "err");
+
+  r.set();
+  EXPECT_EQ(r.is_null(), true);
+  EXPECT_THROW(r.as_string(), cpp_redis::redis_error);
+}
+
+TEST(Reply, AssignFromOwnRow) {
+  cpp_redis::reply r({cpp_redis::reply(std::string(100, 'a'), cpp_redis::reply::string_type::bulk_string), cpp_redis::reply(42)});
+  r = r.as_array()[0];
+
+  ASSERT_EQ(r.is_bulk_string(), true);
+  EXPECT_EQ(r.as_string(), std::string(100, 'a'));
+
+  cpp_redis::reply nested(std::vector<cpp_redis::reply>{cpp_redis::reply({cpp_redis::reply(1), cpp_redis::reply(2)})});
+  nested = std::move(const_cast<cpp_redis::reply&>(nested.as_array()[0]));
+
+  ASSERT_EQ(nested.is_array(), true);
+  ASSERT_EQ(nested.as_array().size(), 2U);
+  EXPECT_EQ(nested.as_array()[1].as_integer(), 2);
+}
+
+TEST(Reply, CopyKeepsSource) {
+  cpp_redis::reply r({cpp_redis::reply("str", cpp_redis::reply::string_type::simple_string), cpp_redis::reply()});
+  cpp_redis::reply copy;
+  copy = r;
+
+  ASSERT_EQ(copy.as_array().size(), 2U);
+  EXPECT_EQ(copy.as_array()[0].as_string(), "str");
+  EXPECT_EQ(copy.as_array()[1].is_null(), true);
+  EXPECT_EQ(r.as_array().size(), 2U);
+}
+
+TEST(Reply, TryAccessors) {
+  cpp_redis::reply str("str", cpp_redis::reply::string_type::bulk_string);
+  cpp_redis::reply err("err", cpp_redis::reply::string_type::error);
+  cpp_redis::reply integer(42);
+  cpp_redis::reply arr(std::vector<cpp_redis::reply>{integer});
+  cpp_redis::reply null;
+
+  ASSERT_NE(nullptr, str.try_as_string());
+  EXPECT_EQ("str", *str.try_as_string());
+  EXPECT_EQ(nullptr, str.try_error());
+  EXPECT_EQ(nullptr, str.try_as_integer());
+  EXPECT_EQ(nullptr, str.try_as_array());
+
+  ASSERT_NE(nullptr, err.try_error());
+  EXPECT_EQ("err", *err.try_error());
+  EXPECT_NE(nullptr, err.try_as_string());
+
+  ASSERT_NE(nullptr, integer.try_as_integer());
+  EXPECT_EQ(42, *integer.try_as_integer());
+  EXPECT_EQ(nullptr, integer.try_as_string());
+
+  ASSERT_NE(nullptr, arr.try_as_array());
+  EXPECT_EQ(1U, arr.try_as_array()->size());
+
+  EXPECT_EQ(nullptr, null.try_as_string());
+  EXPECT_EQ(nullptr, null.try_as_integer());
+  EXPECT_EQ(nullptr, null.try_as_array());
+  EXPECT_EQ(nullptr, null.try_error());
+}
@@ -0,0 +1,124 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/core/reply_view.hpp>
+#include <cpp_redis/misc/error.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(ReplyView, NullReply) {
+  cpp_redis::reply_view r;
+
+  EXPECT_EQ(r.is_array(), false);
+  EXPECT_EQ(r.is_string(), false);
+  EXPECT_EQ(r.is_null(), true);
+  EXPECT_EQ(r.ok(), true);
+  EXPECT_EQ((bool) r, false);
+  EXPECT_THROW(r.as_string(), cpp_redis::redis_error);
+  EXPECT_THROW(r.as_integer(), cpp_redis::redis_error);
+  EXPECT_THROW(r.size(), cpp_redis::redis_error);
+}
+
+TEST(ReplyView, NullBulkString) {
+  std::string buffer = "$-1\r\n";
+  cpp_redis::reply_view r(buffer.data(), buffer.size());
+
+  EXPECT_EQ(r.is_null(), true);
+}
+
+TEST(ReplyView, SimpleString) {
+  std::string buffer = "+OK\r\n";
+  cpp_redis::reply_view r(buffer.data(), buffer.size());
+
+  EXPECT_EQ(r.is_simple_string(), true);
+  EXPECT_EQ(r.as_string(), "OK");
+  EXPECT_EQ(r.as_string().data(), buffer.data() + 1);
+}
+
+TEST(ReplyView, BulkString) {
+  std::string buffer = std::string("$7\r\nhe\r\n\0lo\r\n", 14);
+  cpp_redis::reply_view r(buffer.data(), buffer.size());
+
+  ASSERT_EQ(r.is_bulk_string(), true);
+  EXPECT_EQ(r.as_string().size(), 7U);
+  EXPECT_EQ(r.as_string().to_string(), std::string("he\r\n\0lo", 7));
+  EXPECT_EQ(r.as_string().data(), buffer.data() + 4);
+}
+
+TEST(ReplyView, Error) {
+  std::string buffer = "-ERR unknown\r\n";
+  cpp_redis::reply_view r(buffer.data(), buffer.size());
+
+  EXPECT_EQ(r.is_error(), true);
+  EXPECT_EQ(r.ko(), true);
+  EXPECT_EQ(r.error(), "ERR unknown");
+}
+
+TEST(ReplyView, Integer) {
+  std::string buffer = ":-42\r\n";
+  cpp_redis::reply_view r(buffer.data(), buffer.size());
+
+  EXPECT_EQ(r.is_integer(), true);
+  EXPECT_EQ(r.as_integer(), -42);
+}
+
+TEST(ReplyView, Array) {
+  std::string buffer = "*4\r\n$3\r\nabc\r\n*2\r\n:1\r\n$-1\r\n+OK\r\n*0\r\n";
+  cpp_redis::reply_view r(buffer.data(), buffer.size());
+
+  ASSERT_EQ(r.is_array(), true);
+  ASSERT_EQ(r.size(), 4U);
+  EXPECT_EQ(r[0].as_string(), "abc");
+  ASSERT_EQ(r[1].size(), 2U);
+  EXPECT_EQ(r[1][0].as_integer(), 1);
+  EXPECT_EQ(r[1][1].is_null(), true);
+  EXPECT_EQ(r[2].as_string(), "OK");
+  EXPECT_EQ(r[3].size(), 0U);
+  EXPECT_THROW(r[4], cpp_redis::redis_error);
+
+  std::size_t count = 0;
+  for (const auto& element : r) {
+    EXPECT_EQ(element.get_type(), r[count].get_type());
+    ++count;
+  }
+  EXPECT_EQ(count, 4U);
+}
+
+TEST(ReplyView, ToReply) {
+  std::string buffer = "*3\r\n$3\r\nabc\r\n*1\r\n:7\r\n-ERR\r\n";
+  cpp_redis::reply r = cpp_redis::reply_view(buffer.data(), buffer.size()).to_reply();
+
+  ASSERT_EQ(r.is_array(), true);
+  ASSERT_EQ(r.as_array().size(), 3U);
+  EXPECT_EQ(r.as_array()[0].as_string(), "abc");
+  EXPECT_EQ(r.as_array()[1].as_array()[0].as_integer(), 7);
+  EXPECT_EQ(r.as_array()[2].error(), "ERR");
+}
+
+TEST(ReplyView, Skip) {
+  std::string buffer = "*2\r\n$3\r\nabc\r\n*1\r\n:7\r\n+OK\r\n";
+
+  const char* next = cpp_redis::reply_view::skip(buffer.data(), buffer.data() + buffer.size());
+
+  EXPECT_EQ(std::string(next), "+OK\r\n");
+}
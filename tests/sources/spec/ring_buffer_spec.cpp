@@ -0,0 +1,98 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/misc/ring_buffer.hpp>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+TEST(RingBuffer, Empty) {
+  cpp_redis::ring_buffer<int> queue;
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0U);
+}
+
+TEST(RingBuffer, Fifo) {
+  cpp_redis::ring_buffer<int> queue;
+
+  for (int i = 0; i < 100; ++i)
+    queue.push_back(int(i));
+
+  EXPECT_EQ(queue.size(), 100U);
+  EXPECT_EQ(queue[42], 42);
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(queue.front(), i);
+    queue.pop_front();
+  }
+
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(RingBuffer, GrowWrapped) {
+  cpp_redis::ring_buffer<int> queue;
+  int next_pushed = 0;
+  int next_popped = 0;
+
+  //! interleave pushes and pops so that the elements wrap around the end of the array when it grows
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 7; ++i)
+      queue.push_back(next_pushed++);
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(queue.front(), next_popped++);
+      queue.pop_front();
+    }
+  }
+
+  for (std::size_t i = 0; i < queue.size(); ++i)
+    EXPECT_EQ(queue[i], next_popped + int(i));
+}
+
+TEST(RingBuffer, PopReleases) {
+  cpp_redis::ring_buffer<std::shared_ptr<std::string>> queue;
+  auto value = std::make_shared<std::string>("value");
+
+  queue.push_back(std::shared_ptr<std::string>(value));
+  EXPECT_EQ(value.use_count(), 2);
+
+  queue.pop_front();
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(RingBuffer, Move) {
+  cpp_redis::ring_buffer<std::unique_ptr<int>> queue;
+
+  queue.push_back(std::unique_ptr<int>(new int(1)));
+  queue.push_back(std::unique_ptr<int>(new int(2)));
+
+  cpp_redis::ring_buffer<std::unique_ptr<int>> moved = std::move(queue);
+  EXPECT_TRUE(queue.empty());
+  ASSERT_EQ(moved.size(), 2U);
+  EXPECT_EQ(*moved.front(), 1);
+
+  queue.push_back(std::unique_ptr<int>(new int(3)));
+  EXPECT_EQ(*queue.front(), 3);
+
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+}
@@ -0,0 +1,153 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cpp_redis/misc/scan.hpp>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+static const char*
+naive_find_crlf(const char* begin, const char* end) {
+  for (const char* p = begin; p + 1 < end; ++p)
+    if (p[0] == '\r' && p[1] == '\n')
+      return p;
+
+  return end;
+}
+
+static const cpp_redis::scan::isa levels[] = {cpp_redis::scan::isa::scalar, cpp_redis::scan::isa::sse2, cpp_redis::scan::isa::avx2};
+
+TEST(Scan, FindCrlfEmpty) {
+  std::string buffer;
+
+  for (auto level : levels)
+    EXPECT_EQ(cpp_redis::scan::find_crlf(buffer.data(), buffer.data(), level), buffer.data());
+}
+
+TEST(Scan, FindCrlfAnyPosition) {
+  for (std::size_t size = 2; size < 100; ++size) {
+    for (std::size_t crlf = 0; crlf + 1 < size; ++crlf) {
+      std::string buffer(size, 'a');
+      buffer[crlf]     = '\r';
+      buffer[crlf + 1] = '\n';
+
+      for (auto level : levels)
+        EXPECT_EQ(cpp_redis::scan::find_crlf(buffer.data(), buffer.data() + size, level), buffer.data() + crlf);
+
+      EXPECT_EQ(cpp_redis::scan::find_crlf(buffer.data(), buffer.data() + size), buffer.data() + crlf);
+    }
+  }
+}
+
+TEST(Scan, FindCrlfLoneCharacters) {
+  //! lone '\r' and '\n', "\n\r" sequences and an end sequence split by the end of the data
+  std::string buffer;
+  uint32_t seed = 42;
+  for (std::size_t i = 0; i < 200; ++i) {
+    seed = seed * 1103515245 + 12345;
+    buffer += "\r\naaa"[(seed >> 16) % 5];
+    if (buffer.size() >= 2 && buffer[buffer.size() - 2] == '\r' && buffer.back() == '\n')
+      buffer.back() = 'a';
+  }
+  buffer.replace(150, 2, "\r\n");
+  buffer += "\r";
+
+  for (std::size_t offset = 0; offset < buffer.size(); ++offset) {
+    const char* begin    = buffer.data() + offset;
+    const char* end      = buffer.data() + buffer.size();
+    const char* expected = naive_find_crlf(begin, end);
+
+    for (auto level : levels)
+      EXPECT_EQ(cpp_redis::scan::find_crlf(begin, end, level), expected);
+  }
+}
+
+TEST(Scan, FindCrlfFirstOfMany) {
+  std::string buffer(70, 'a');
+  buffer.replace(33, 2, "\r\n");
+  buffer.replace(50, 2, "\r\n");
+  buffer.replace(65, 2, "\r\n");
+
+  for (auto level : levels) {
+    EXPECT_EQ(cpp_redis::scan::find_crlf(buffer.data(), buffer.data() + buffer.size(), level), buffer.data() + 33);
+    EXPECT_EQ(cpp_redis::scan::find_crlf(buffer.data() + 34, buffer.data() + buffer.size(), level), buffer.data() + 50);
+    EXPECT_EQ(cpp_redis::scan::find_crlf(buffer.data(), buffer.data() + 34, level), buffer.data() + 34);
+  }
+}
+
+TEST(Scan, ParseIntegerAnyLength) {
+  std::string digits = "1234567890123456789";
+
+  for (std::size_t len = 1; len <= digits.size(); ++len) {
+    std::string positive = digits.substr(0, len);
+    std::string negative = "-" + positive;
+    int64_t expected     = std::stoll(positive);
+    int64_t value        = 0;
+
+    EXPECT_TRUE(cpp_redis::scan::parse_integer(positive.data(), positive.data() + positive.size(), value));
+    EXPECT_EQ(value, expected);
+
+    EXPECT_TRUE(cpp_redis::scan::parse_integer(negative.data(), negative.data() + negative.size(), value));
+    EXPECT_EQ(value, -expected);
+  }
+}
+
+TEST(Scan, ParseIntegerLeadingZeros) {
+  std::string buffer = "0000000000000042";
+  int64_t value      = 0;
+
+  EXPECT_TRUE(cpp_redis::scan::parse_integer(buffer.data(), buffer.data() + buffer.size(), value));
+  EXPECT_EQ(value, 42);
+}
+
+TEST(Scan, ParseIntegerLimits) {
+  const std::string max = "9223372036854775807";
+  const std::string min = "-9223372036854775808";
+  int64_t value         = 0;
+
+  EXPECT_TRUE(cpp_redis::scan::parse_integer(max.data(), max.data() + max.size(), value));
+  EXPECT_EQ(value, std::numeric_limits<int64_t>::max());
+
+  EXPECT_TRUE(cpp_redis::scan::parse_integer(min.data(), min.data() + min.size(), value));
+  EXPECT_EQ(value, std::numeric_limits<int64_t>::min());
+}
+
+TEST(Scan, ParseIntegerOverflow) {
+  const char* overflows[] = {"9223372036854775808", "-9223372036854775809", "18446744073709551616",
+      "99999999999999999999", "-99999999999999999999", "123456789012345678901234567890"};
+  int64_t value = 42;
+
+  for (auto overflow : overflows) {
+    EXPECT_FALSE(cpp_redis::scan::parse_integer(overflow, overflow + std::strlen(overflow), value)) << overflow;
+    EXPECT_EQ(value, 42) << overflow;
+  }
+}
+
+TEST(Scan, ParseIntegerInvalid) {
+  const char* invalids[] = {"", "-", "--1", "1-", "12a4", "1234567/", "12345678:", "+1", " 1", "123456789012345x"};
+  int64_t value          = 0;
+
+  for (auto invalid : invalids)
+    EXPECT_FALSE(cpp_redis::scan::parse_integer(invalid, invalid + std::strlen(invalid), value)) << invalid;
+}
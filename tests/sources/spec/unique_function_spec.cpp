@@ -0,0 +1,117 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 Simon Ninon <simon.ninon@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpp_redis/misc/unique_function.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+static int
+twice(int value) {
+  return 2 * value;
+}
+
+TEST(UniqueFunction, Empty) {
+  cpp_redis::unique_function<void(int)> f;
+  cpp_redis::unique_function<void(int)> g = nullptr;
+
+  EXPECT_FALSE(f);
+  EXPECT_FALSE(g);
+  EXPECT_THROW(f(1), std::bad_function_call);
+}
+
+TEST(UniqueFunction, EmptyCallables) {
+  std::function<int(int)> empty;
+  int (*null_pointer)(int) = nullptr;
+
+  cpp_redis::unique_function<int(int)> f = empty;
+  cpp_redis::unique_function<int(int)> g = null_pointer;
+
+  EXPECT_FALSE(f);
+  EXPECT_FALSE(g);
+}
+
+TEST(UniqueFunction, Callables) {
+  cpp_redis::unique_function<int(int)> pointer = &twice;
+  cpp_redis::unique_function<int(int)> function = std::function<int(int)>(twice);
+  cpp_redis::unique_function<int(int)> lambda = [](int value) { return value + 1; };
+
+  EXPECT_EQ(pointer(21), 42);
+  EXPECT_EQ(function(21), 42);
+  EXPECT_EQ(lambda(41), 42);
+}
+
+TEST(UniqueFunction, ReferenceArguments) {
+  cpp_redis::unique_function<void(std::string&)> f = [](std::string& value) { value += "!"; };
+  std::string value = "hello";
+
+  f(value);
+  EXPECT_EQ(value, "hello!");
+}
+
+TEST(UniqueFunction, MoveOnlyCapture) {
+  struct move_only {
+    std::unique_ptr<int> value;
+    int operator()(void) { return *value; }
+  };
+
+  cpp_redis::unique_function<int(void)> f = move_only{std::unique_ptr<int>(new int(42))};
+  EXPECT_EQ(f(), 42);
+
+  cpp_redis::unique_function<int(void)> g = std::move(f);
+  EXPECT_FALSE(f);
+  EXPECT_EQ(g(), 42);
+}
+
+TEST(UniqueFunction, ReleasesCapture) {
+  auto inline_value = std::make_shared<int>(1);
+  auto heap_value   = std::make_shared<int>(2);
+  std::array<char, 256> large = {};
+
+  {
+    cpp_redis::unique_function<int(void)> small = [inline_value]() { return *inline_value; };
+    cpp_redis::unique_function<int(void)> big   = [heap_value, large]() { return *heap_value + large[0]; };
+
+    EXPECT_EQ(inline_value.use_count(), 2);
+    EXPECT_EQ(heap_value.use_count(), 2);
+
+    cpp_redis::unique_function<int(void)> moved_small = std::move(small);
+    cpp_redis::unique_function<int(void)> moved_big   = std::move(big);
+
+    EXPECT_EQ(inline_value.use_count(), 2);
+    EXPECT_EQ(heap_value.use_count(), 2);
+
+    moved_small = nullptr;
+    EXPECT_EQ(inline_value.use_count(), 1);
+  }
+
+  EXPECT_EQ(heap_value.use_count(), 1);
+}
+
+TEST(UniqueFunction, IsCallable) {
+  auto lambda = [](std::string&) {};
+
+  EXPECT_TRUE((cpp_redis::is_callable<decltype(lambda), std::string&>::value));
+  EXPECT_FALSE((cpp_redis::is_callable<decltype(lambda), int>::value));
+  EXPECT_FALSE((cpp_redis::is_callable<std::shared_ptr<int>, std::string&>::value));
+}